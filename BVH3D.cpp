@@ -0,0 +1,1451 @@
+/*************************************************************************
+【文件名】                 BVH3D.cpp
+【功能模块和目的】          三角形面包围体层次结构（BVH）类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加射线包与批量查询
+                          梁思奇 2026/10/18 图元保存原始顶点，增加点内外判定
+                          梁思奇 2026/10/18 增加两树同时遍历的三角形相交查询
+                          梁思奇 2026/10/18 增加最近点查询
+*************************************************************************/
+
+//自身类头文件
+#include "BVH3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//Predicates3D类所属头文件
+#include "Predicates3D.hpp"
+//std::thread所属头文件
+#include <thread>
+//std::partition、std::nth_element、std::min、std::max所属头文件
+#include <algorithm>
+//std::numeric_limits所属头文件
+#include <limits>
+//std::nextafter所属头文件
+#include <cmath>
+//std::pair所属头文件
+#include <utility>
+
+//构建期辅助函数（仅本文件可见）
+
+//空包围盒
+static const double BOX_INF{std::numeric_limits<double>::infinity()};
+
+/*************************************************************************
+【函数名称】        SurfaceArea
+【函数功能】        求包围盒表面积的一半（SAH只需相对值）
+【参数】            const Coord3D& Min, const Coord3D& Max
+【返回值】          double，半表面积，空盒为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static double SurfaceArea(const Coord3D& Min, const Coord3D& Max){
+    double X = Max[0] - Min[0];
+    double Y = Max[1] - Min[1];
+    double Z = Max[2] - Min[2];
+    if (X < 0.0 || Y < 0.0 || Z < 0.0) {
+        return 0.0;
+    }
+    return X * Y + Y * Z + Z * X;
+}
+
+/*************************************************************************
+【函数名称】        SpreadBits
+【函数功能】        将10位整数的各位间隔2位展开，用于三维Morton码交织
+【参数】            uint64_t Value：10位整数
+【返回值】          uint64_t，展开后的30位整数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static uint64_t SpreadBits(uint64_t Value){
+    Value &= 0x3FF;
+    Value = (Value | (Value << 16)) & 0x30000FF;
+    Value = (Value | (Value << 8)) & 0x300F00F;
+    Value = (Value | (Value << 4)) & 0x30C30C3;
+    Value = (Value | (Value << 2)) & 0x9249249;
+    return Value;
+}
+
+/*************************************************************************
+【函数名称】        Quantize
+【函数功能】        将坐标在[Min, Max]区间内量化为10位整数
+【参数】            double Value：坐标值
+                   double Min, double Max：量化区间
+【返回值】          uint64_t，0～1023
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static uint64_t Quantize(double Value, double Min, double Max){
+    double Ratio = Max > Min ? (Value - Min) / (Max - Min) : 0.0;
+    //NaN与越界均夹到区间内
+    if (!(Ratio > 0.0)) {
+        return 0;
+    }
+    if (Ratio >= 1.0) {
+        return 1023;
+    }
+    return static_cast<uint64_t>(Ratio * 1023.0);
+}
+
+/*************************************************************************
+【函数名称】        SpreadBits2D
+【函数功能】        将8位整数的各位间隔1位展开，用于二维Morton码交织
+【参数】            uint64_t Value：8位整数
+【返回值】          uint64_t，展开后的16位整数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static uint64_t SpreadBits2D(uint64_t Value){
+    Value &= 0xFF;
+    Value = (Value | (Value << 4)) & 0x0F0F;
+    Value = (Value | (Value << 2)) & 0x3333;
+    Value = (Value | (Value << 1)) & 0x5555;
+    return Value;
+}
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        由三角形列表并行构建BVH：先并行计算各三角形包围盒与重心，
+                   再分箱SAH递归划分，上层子树分配给不同线程
+【参数】            const std::vector<Triangle3D>& Triangles：
+                   三角形列表，下标即面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::Build(const std::vector<Triangle3D>& Triangles){
+    size_t Count = Triangles.size();
+    m_Nodes.clear();
+    m_Prims.assign(Count, Triangle3D{});
+    m_PrimTags.assign(Count, RayHit3D::NO_HIT);
+    m_PrimLeaves.assign(Count, INVALID_INDEX);
+    m_TagToPrim.assign(Count, INVALID_INDEX);
+    m_Parents.clear();
+    m_ullTombstoneNum = 0;
+    if (Count == 0) {
+        return;
+    }
+    //并行计算包围盒与重心
+    m_BuildBoxes.assign(Count, Box{});
+    m_BuildCentroids.assign(Count, Coord3D{});
+    m_BuildOrder.assign(Count, 0);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            Box& TempBox = m_BuildBoxes[i];
+            TempBox.Min = Triangles[i][0];
+            TempBox.Max = Triangles[i][0];
+            for (size_t k = 1; k < 3; k++) {
+                for (size_t Axis = 0; Axis < 3; Axis++) {
+                    TempBox.Min[Axis] = std::min(
+                        TempBox.Min[Axis], Triangles[i][k][Axis]);
+                    TempBox.Max[Axis] = std::max(
+                        TempBox.Max[Axis], Triangles[i][k][Axis]);
+                }
+            }
+            for (size_t Axis = 0; Axis < 3; Axis++) {
+                m_BuildCentroids[i][Axis]
+                    = (TempBox.Min[Axis] + TempBox.Max[Axis]) * 0.5;
+            }
+            m_BuildOrder[i] = static_cast<uint32_t>(i);
+        }
+    });
+    //上层子树并行的深度：约log2(线程数) + 1
+    size_t ParallelDepth = 1;
+    while ((static_cast<size_t>(1) << ParallelDepth)
+        < Parallel::ThreadCount() * 2) {
+        ParallelDepth++;
+    }
+    m_Nodes.reserve(Count / MAX_LEAF_SIZE * 2 + 1);
+    BuildRange(0, Count, m_Nodes, 0, ParallelDepth);
+    //按叶节点顺序整理三角形
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            uint32_t Tag = m_BuildOrder[i];
+            m_Prims[i] = Triangles[Tag];
+            m_PrimTags[i] = Tag;
+            m_TagToPrim[Tag] = static_cast<uint32_t>(i);
+        }
+    });
+    //建立父节点与图元所在叶节点表
+    m_Parents.assign(m_Nodes.size(), INVALID_INDEX);
+    for (uint32_t i = 0; i < m_Nodes.size(); i++) {
+        if (m_Nodes[i].Count == 0) {
+            m_Parents[i + 1] = i;
+            m_Parents[m_Nodes[i].Offset] = i;
+        }
+        else {
+            for (uint32_t k = 0; k < m_Nodes[i].Count; k++) {
+                m_PrimLeaves[m_Nodes[i].Offset + k] = i;
+            }
+        }
+    }
+    //释放构建期数据
+    m_BuildBoxes = std::vector<Box>{};
+    m_BuildCentroids = std::vector<Coord3D>{};
+    m_BuildOrder = std::vector<uint32_t>{};
+}
+
+/*************************************************************************
+【函数名称】        Refit
+【函数功能】        修改指定面标签的三角形，重算其叶节点包围盒并沿父链
+                   向上重拟合，包围盒不变时提前停止，代价O(树深)
+【参数】            size_t FaceTag：面标签
+                   const Triangle3D& Triangle：新三角形
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::Refit(size_t FaceTag, const Triangle3D& Triangle){
+    if (FaceTag >= m_TagToPrim.size()) {
+        return;
+    }
+    uint32_t Prim = m_TagToPrim[FaceTag];
+    m_Prims[Prim] = Triangle;
+    RefitLeaf(m_PrimLeaves[Prim]);
+    RefitParents(m_PrimLeaves[Prim]);
+}
+
+/*************************************************************************
+【函数名称】        Remove
+【函数功能】        与Model3D交换-弹出删除保持一致：FaceTag对应图元置为墓碑
+                   （不再命中），原最后一个面标签改记为FaceTag
+【参数】            size_t FaceTag：被删除的面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::Remove(size_t FaceTag){
+    if (FaceTag >= m_TagToPrim.size()) {
+        return;
+    }
+    uint32_t Prim = m_TagToPrim[FaceTag];
+    //置为墓碑：退化三角形不会命中，叶节点包围盒不再包含它
+    m_PrimTags[Prim] = RayHit3D::NO_HIT;
+    m_Prims[Prim][1] = m_Prims[Prim][0];
+    m_Prims[Prim][2] = m_Prims[Prim][0];
+    m_ullTombstoneNum++;
+    RefitLeaf(m_PrimLeaves[Prim]);
+    RefitParents(m_PrimLeaves[Prim]);
+    //原最后一个面接替被删标签
+    size_t LastTag = m_TagToPrim.size() - 1;
+    if (FaceTag != LastTag) {
+        m_PrimTags[m_TagToPrim[LastTag]] = FaceTag;
+        m_TagToPrim[FaceTag] = m_TagToPrim[LastTag];
+    }
+    m_TagToPrim.pop_back();
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        Intersect
+【函数功能】        最近交点查询
+【参数】            const Coord3D& Origin：射线起点
+                   const Coord3D& Direction：射线方向
+                   double TMax：参数上限
+                   RayHit3D& Hit：命中结果
+【返回值】          bool，命中返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::Intersect(const Coord3D& Origin, const Coord3D& Direction,
+    double TMax, RayHit3D& Hit) const{
+    Hit.FaceTag = RayHit3D::NO_HIT;
+    if (m_Nodes.empty()) {
+        return false;
+    }
+    double Closest = TMax;
+    return TraverseSingle(0, Origin, Direction, false, Closest, Hit);
+}
+
+/*************************************************************************
+【函数名称】        Occluded
+【函数功能】        任意交点（遮挡）查询，找到第一个交点即返回
+【参数】            const Coord3D& Origin：射线起点
+                   const Coord3D& Direction：射线方向
+                   double TMax：参数上限
+【返回值】          bool，(0, TMax)内存在交点返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::Occluded(const Coord3D& Origin, const Coord3D& Direction,
+    double TMax) const{
+    if (m_Nodes.empty()) {
+        return false;
+    }
+    double Closest = TMax;
+    RayHit3D Hit{RayHit3D::NO_HIT, 0.0, 0.0, 0.0};
+    return TraverseSingle(0, Origin, Direction, true, Closest, Hit);
+}
+
+/*************************************************************************
+【函数名称】        IntersectPacket
+【函数功能】        射线包最近交点查询
+【参数】            const Coord3D* Origins：各射线起点
+                   const Coord3D* Directions：各射线方向
+                   size_t Count：射线数，不超过PACKET_SIZE
+                   double TMax：参数上限
+                   RayHit3D* Hits：各射线命中结果
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::IntersectPacket(const Coord3D* Origins,
+    const Coord3D* Directions, size_t Count, double TMax,
+    RayHit3D* Hits) const{
+    TraversePacket(Origins, Directions, Count, TMax, false, Hits);
+}
+
+/*************************************************************************
+【函数名称】        OccludedPacket
+【函数功能】        射线包遮挡查询
+【参数】            const Coord3D* Origins：各射线起点
+                   const Coord3D* Directions：各射线方向
+                   size_t Count：射线数，不超过PACKET_SIZE
+                   double TMax：参数上限
+                   uint8_t* Results：各射线是否被遮挡（1/0）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::OccludedPacket(const Coord3D* Origins,
+    const Coord3D* Directions, size_t Count, double TMax,
+    uint8_t* Results) const{
+    RayHit3D Hits[PACKET_SIZE];
+    TraversePacket(Origins, Directions, Count, TMax, true, Hits);
+    for (size_t Lane = 0; Lane < Count; Lane++) {
+        Results[Lane] = Hits[Lane].FaceTag != RayHit3D::NO_HIT ? 1 : 0;
+    }
+}
+
+/*************************************************************************
+【函数名称】        IntersectBatch
+【函数功能】        批量最近交点查询：射线一致性排序后每PACKET_SIZE条
+                   组成一包，各包并行遍历，结果按原下标写回
+【参数】            const std::vector<Coord3D>& Origins：各射线起点
+                   const std::vector<Coord3D>& Directions：各射线方向，
+                   数量与Origins相同
+                   double TMax：参数上限
+                   std::vector<RayHit3D>& Hits：各射线命中结果（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::IntersectBatch(const std::vector<Coord3D>& Origins,
+    const std::vector<Coord3D>& Directions, double TMax,
+    std::vector<RayHit3D>& Hits) const{
+    size_t Count = std::min(Origins.size(), Directions.size());
+    Hits.assign(Count, RayHit3D{RayHit3D::NO_HIT, 0.0, 0.0, 0.0});
+    std::vector<size_t> Order = CoherentOrder(Origins, Directions);
+    size_t PacketNum = (Count + PACKET_SIZE - 1) / PACKET_SIZE;
+    Parallel::For(0, PacketNum, [&](size_t First, size_t Last){
+        Coord3D PacketOrigins[PACKET_SIZE];
+        Coord3D PacketDirections[PACKET_SIZE];
+        RayHit3D PacketHits[PACKET_SIZE];
+        for (size_t i = First; i < Last; i++) {
+            size_t Begin = i * PACKET_SIZE;
+            size_t Size = std::min(PACKET_SIZE, Count - Begin);
+            for (size_t Lane = 0; Lane < Size; Lane++) {
+                PacketOrigins[Lane] = Origins[Order[Begin + Lane]];
+                PacketDirections[Lane] = Directions[Order[Begin + Lane]];
+            }
+            TraversePacket(PacketOrigins, PacketDirections, Size, TMax,
+                false, PacketHits);
+            for (size_t Lane = 0; Lane < Size; Lane++) {
+                Hits[Order[Begin + Lane]] = PacketHits[Lane];
+            }
+        }
+    }, 64);
+}
+
+/*************************************************************************
+【函数名称】        OccludedBatch
+【函数功能】        批量遮挡查询，组包与并行方式同IntersectBatch
+【参数】            const std::vector<Coord3D>& Origins：各射线起点
+                   const std::vector<Coord3D>& Directions：各射线方向，
+                   数量与Origins相同
+                   double TMax：参数上限
+                   std::vector<uint8_t>& Results：各射线是否被遮挡（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::OccludedBatch(const std::vector<Coord3D>& Origins,
+    const std::vector<Coord3D>& Directions, double TMax,
+    std::vector<uint8_t>& Results) const{
+    size_t Count = std::min(Origins.size(), Directions.size());
+    Results.assign(Count, 0);
+    std::vector<size_t> Order = CoherentOrder(Origins, Directions);
+    size_t PacketNum = (Count + PACKET_SIZE - 1) / PACKET_SIZE;
+    Parallel::For(0, PacketNum, [&](size_t First, size_t Last){
+        Coord3D PacketOrigins[PACKET_SIZE];
+        Coord3D PacketDirections[PACKET_SIZE];
+        uint8_t PacketResults[PACKET_SIZE];
+        for (size_t i = First; i < Last; i++) {
+            size_t Begin = i * PACKET_SIZE;
+            size_t Size = std::min(PACKET_SIZE, Count - Begin);
+            for (size_t Lane = 0; Lane < Size; Lane++) {
+                PacketOrigins[Lane] = Origins[Order[Begin + Lane]];
+                PacketDirections[Lane] = Directions[Order[Begin + Lane]];
+            }
+            OccludedPacket(PacketOrigins, PacketDirections, Size, TMax,
+                PacketResults);
+            for (size_t Lane = 0; Lane < Size; Lane++) {
+                Results[Order[Begin + Lane]] = PacketResults[Lane];
+            }
+        }
+    }, 64);
+}
+
+/*************************************************************************
+【函数名称】        Contains
+【函数功能】        点内外判定：自点向+Z的射线深度优先遍历，只进入XY范围
+                   包含该点且盒顶不低于该点的节点，叶节点内逐个三角形
+                   精确判定是否穿过（共享边、顶点只计一次），
+                   穿过次数为奇数即在内部
+【参数】            const Coord3D& Point：待判定点
+【返回值】          bool，在内部返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::Contains(const Coord3D& Point) const{
+    if (m_Nodes.empty()) {
+        return false;
+    }
+    uint32_t Stack[STACK_SIZE];
+    size_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    bool IsInside = false;
+    while (StackSize > 0) {
+        uint32_t Current = Stack[--StackSize];
+        const Node& TempNode = m_Nodes[Current];
+        if (!ColumnNode(TempNode, Point)) {
+            continue;
+        }
+        if (TempNode.Count > 0) {
+            //墓碑退化为一点，投影面积为0，不会被穿过
+            for (uint32_t i = TempNode.Offset;
+                i < TempNode.Offset + TempNode.Count; i++) {
+                if (Predicates3D::CrossAbove(m_Prims[i], Point)) {
+                    IsInside = !IsInside;
+                }
+            }
+        }
+        else {
+            Stack[StackSize++] = TempNode.Offset;
+            Stack[StackSize++] = Current + 1;
+        }
+    }
+    return IsInside;
+}
+
+/*************************************************************************
+【函数名称】        ContainsBatch
+【函数功能】        批量点内外判定：根包围盒的XY范围划分为256×256格，
+                   格按二维Morton码编号，各点按所在格并行计数排序（竖直
+                   射线只与XY位置有关，同格的点访问几乎相同的节点），
+                   排序后分给全部线程逐点判定，最后按64点一字并行打包
+【参数】            const std::vector<double>& Coordinates：各点的X、Y、Z
+                   （末尾不足3个的分量忽略）
+                   std::vector<uint64_t>& Mask：结果位掩码（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::ContainsBatch(const std::vector<double>& Coordinates,
+    std::vector<uint64_t>& Mask) const{
+    size_t Count = Coordinates.size() / 3;
+    Mask.assign((Count + 63) / 64, 0);
+    if (m_Nodes.empty() || Count == 0) {
+        return;
+    }
+    const Node& Root = m_Nodes[0];
+    const size_t CellNum = size_t{1} << 16;
+    std::vector<uint16_t> Cells(Count);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            uint64_t X = Quantize(Coordinates[i * 3], Root.Min[0],
+                Root.Max[0]) >> 2;
+            uint64_t Y = Quantize(Coordinates[i * 3 + 1], Root.Min[1],
+                Root.Max[1]) >> 2;
+            Cells[i] = static_cast<uint16_t>(
+                SpreadBits2D(X) | (SpreadBits2D(Y) << 1));
+        }
+    });
+    //并行计数排序：各块分别计数，按（格，块）顺序求前缀和后并行填入
+    const size_t ChunkNum = std::max(size_t{1}, std::min(
+        Parallel::ThreadCount(), (Count + Parallel::DEFAULT_MIN_CHUNK - 1)
+        / Parallel::DEFAULT_MIN_CHUNK));
+    const size_t ChunkSize = (Count + ChunkNum - 1) / ChunkNum;
+    std::vector<size_t> Offsets(ChunkNum * CellNum, 0);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t End = std::min(Count, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                Offsets[c * CellNum + Cells[i]]++;
+            }
+        }
+    }, 1);
+    size_t Total = 0;
+    for (size_t Cell = 0; Cell < CellNum; Cell++) {
+        for (size_t c = 0; c < ChunkNum; c++) {
+            size_t Num = Offsets[c * CellNum + Cell];
+            Offsets[c * CellNum + Cell] = Total;
+            Total += Num;
+        }
+    }
+    std::vector<size_t> Order(Count);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t End = std::min(Count, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                Order[Offsets[c * CellNum + Cells[i]]++] = i;
+            }
+        }
+    }, 1);
+    std::vector<uint8_t> Results(Count, 0);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t Index = Order[i];
+            Coord3D Point{Coordinates[Index * 3], Coordinates[Index * 3 + 1],
+                Coordinates[Index * 3 + 2]};
+            Results[Index] = Contains(Point) ? 1 : 0;
+        }
+    }, 256);
+    Parallel::For(0, Mask.size(), [&](size_t First, size_t Last){
+        for (size_t w = First; w < Last; w++) {
+            size_t End = std::min(Count, (w + 1) * 64);
+            for (size_t i = w * 64; i < End; i++) {
+                Mask[w] |= static_cast<uint64_t>(Results[i]) << (i % 64);
+            }
+        }
+    });
+}
+
+/*************************************************************************
+【函数名称】        IntersectPairs
+【函数功能】        两BVH三角形相交查询：根节点对起逐层拆分重叠的节点对，
+                   直到任务数达到线程数的PAIR_TASKS_PER_THREAD倍或全部为
+                   叶节点对；各线程以原子计数依次领取任务同时遍历子树，
+                   结果按任务顺序拼接后排序
+【参数】            const BVH3D& Other：另一BVH
+                   bool IsAnyHit：是否找到一对即停止
+                   std::vector<std::pair<size_t, size_t>>& Pairs：相交的
+                   （本树面标签，另一树面标签）（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::IntersectPairs(const BVH3D& Other, bool IsAnyHit,
+    std::vector<std::pair<size_t, size_t>>& Pairs) const{
+    Pairs.clear();
+    if (m_Nodes.empty() || Other.m_Nodes.empty()
+        || !NodesOverlap(m_Nodes[0], Other.m_Nodes[0])) {
+        return;
+    }
+    using NodePair = std::pair<uint32_t, uint32_t>;
+    std::vector<NodePair> Tasks{NodePair{0, 0}};
+    const size_t TaskNum = Parallel::ThreadCount() * PAIR_TASKS_PER_THREAD;
+    bool IsExpanded = true;
+    while (Tasks.size() < TaskNum && IsExpanded) {
+        IsExpanded = false;
+        std::vector<NodePair> Next;
+        for (const NodePair& Task : Tasks) {
+            const Node& First = m_Nodes[Task.first];
+            const Node& Second = Other.m_Nodes[Task.second];
+            if (First.Count > 0 && Second.Count > 0) {
+                Next.push_back(Task);
+                continue;
+            }
+            IsExpanded = true;
+            if (IsSplitFirst(First, Second)) {
+                for (uint32_t Child : {Task.first + 1, First.Offset}) {
+                    if (NodesOverlap(m_Nodes[Child], Second)) {
+                        Next.emplace_back(Child, Task.second);
+                    }
+                }
+            }
+            else {
+                for (uint32_t Child : {Task.second + 1, Second.Offset}) {
+                    if (NodesOverlap(First, Other.m_Nodes[Child])) {
+                        Next.emplace_back(Task.first, Child);
+                    }
+                }
+            }
+        }
+        Tasks.swap(Next);
+    }
+    //各任务的结果，按任务顺序拼接
+    std::vector<std::vector<std::pair<size_t, size_t>>> Results(Tasks.size());
+    std::atomic<size_t> NextTask{0};
+    std::atomic<bool> IsFound{false};
+    Parallel::For(0, std::min(Parallel::ThreadCount(), Tasks.size()),
+        [&](size_t First, size_t Last){
+        for (size_t Worker = First; Worker < Last; Worker++) {
+            for (size_t i = NextTask++; i < Tasks.size(); i = NextTask++) {
+                if (IsAnyHit && IsFound) {
+                    break;
+                }
+                TraversePair(Other, Tasks[i].first, Tasks[i].second,
+                    IsAnyHit, IsFound, Results[i]);
+            }
+        }
+    }, 1);
+    for (const auto& Result : Results) {
+        Pairs.insert(Pairs.end(), Result.begin(), Result.end());
+    }
+    if (IsAnyHit) {
+        Pairs.resize(std::min(Pairs.size(), size_t{1}));
+        return;
+    }
+    Parallel::Sort(Pairs.begin(), Pairs.end(),
+        [](const std::pair<size_t, size_t>& Lhs,
+            const std::pair<size_t, size_t>& Rhs){
+            return Lhs < Rhs;});
+}
+
+/*************************************************************************
+【函数名称】        ClosestPoint
+【函数功能】        最近点查询：深度优先分支定界，内部节点的两个子节点按
+                   点到包围盒的距离先近后远，入栈节点记录该距离，
+                   距离超过当前上限的节点剪枝；叶节点内逐个三角形求
+                   最近点，更近时收紧上限；墓碑跳过
+【参数】            const Coord3D& Point：查询点
+                   double MaxDistance：距离上限（可为无穷大）
+                   size_t& FaceTag：最近三角形的面标签，仅在找到时改写
+                   Coord3D& Closest：三角形上的最近点，仅在找到时改写
+【返回值】          bool，上限内有三角形返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::ClosestPoint(const Coord3D& Point, double MaxDistance,
+    size_t& FaceTag, Coord3D& Closest) const{
+    if (m_Nodes.empty() || !(MaxDistance >= 0.0)) {
+        return false;
+    }
+    //距离平方上限
+    double Bound = MaxDistance * MaxDistance;
+    if (NodeDistance2(m_Nodes[0], Point) > Bound) {
+        return false;
+    }
+    //遍历栈：节点下标与距离平方
+    uint32_t Stack[STACK_SIZE];
+    double StackD[STACK_SIZE];
+    size_t StackSize = 0;
+    uint32_t Current = 0;
+    bool IsFound = false;
+    while (true) {
+        const Node& TempNode = m_Nodes[Current];
+        if (TempNode.Count > 0) {
+            for (uint32_t i = TempNode.Offset;
+                i < TempNode.Offset + TempNode.Count; i++) {
+                if (m_PrimTags[i] == RayHit3D::NO_HIT) {
+                    continue;
+                }
+                Coord3D Candidate
+                    = Geometry3D::ClosestPointOnTriangle(Point, m_Prims[i]);
+                Coord3D Offset = Geometry3D::Sub(Candidate, Point);
+                double Distance2 = Geometry3D::Dot(Offset, Offset);
+                if (Distance2 <= Bound) {
+                    Bound = Distance2;
+                    FaceTag = m_PrimTags[i];
+                    Closest = Candidate;
+                    IsFound = true;
+                }
+            }
+        }
+        else {
+            uint32_t Near = Current + 1;
+            uint32_t Far = TempNode.Offset;
+            double DN = NodeDistance2(m_Nodes[Near], Point);
+            double DF = NodeDistance2(m_Nodes[Far], Point);
+            if (DF < DN) {
+                std::swap(Near, Far);
+                std::swap(DN, DF);
+            }
+            if (DN <= Bound) {
+                if (DF <= Bound) {
+                    Stack[StackSize] = Far;
+                    StackD[StackSize] = DF;
+                    StackSize++;
+                }
+                Current = Near;
+                continue;
+            }
+        }
+        //出栈，跳过比已知最近点更远的节点
+        bool IsNext = false;
+        while (StackSize > 0) {
+            StackSize--;
+            if (StackD[StackSize] <= Bound) {
+                Current = Stack[StackSize];
+                IsNext = true;
+                break;
+            }
+        }
+        if (!IsNext) {
+            break;
+        }
+    }
+    return IsFound;
+}
+
+/*************************************************************************
+【函数名称】        NeedRebuild
+【函数功能】        墓碑超过四分之一时建议重建，避免遍历退化
+【参数】            无
+【返回值】          bool，建议重建返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::NeedRebuild() const{
+    return m_ullTombstoneNum * 4 > m_Prims.size();
+}
+
+/*************************************************************************
+【函数名称】        TriangleNum
+【函数功能】        获取有效三角形数
+【参数】            无
+【返回值】          size_t，三角形数（不含墓碑）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t BVH3D::TriangleNum() const{
+    return m_TagToPrim.size();
+}
+
+/*************************************************************************
+【函数名称】        NodeNum
+【函数功能】        获取节点数
+【参数】            无
+【返回值】          size_t，节点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t BVH3D::NodeNum() const{
+    return m_Nodes.size();
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        BuildRange
+【函数功能】        递归构建[Begin, End)区间：三个轴上各分BIN_NUM个箱，
+                   取SAH代价最小的划分；划分无收益且图元较少时成叶节点；
+                   超过MAX_SAH_DEPTH或重心重合时按中位划分；
+                   ParallelDepth > 0且区间较大时左子树交给新线程构建，
+                   构建结果拼接时重定位内部节点的右子节点下标
+【参数】            size_t Begin, size_t End：图元区间
+                   std::vector<Node>& Nodes：节点输出数组
+                   size_t Depth：当前深度
+                   size_t ParallelDepth：剩余并行层数
+【返回值】          uint32_t，本区间根节点在Nodes中的下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+uint32_t BVH3D::BuildRange(size_t Begin, size_t End,
+    std::vector<Node>& Nodes, size_t Depth, size_t ParallelDepth){
+    //区间包围盒与重心包围盒
+    Box Bounds{{BOX_INF, BOX_INF, BOX_INF}, {-BOX_INF, -BOX_INF, -BOX_INF}};
+    Box CentBounds = Bounds;
+    for (size_t i = Begin; i < End; i++) {
+        const Box& TempBox = m_BuildBoxes[m_BuildOrder[i]];
+        const Coord3D& TempCent = m_BuildCentroids[m_BuildOrder[i]];
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Bounds.Min[Axis] = std::min(Bounds.Min[Axis], TempBox.Min[Axis]);
+            Bounds.Max[Axis] = std::max(Bounds.Max[Axis], TempBox.Max[Axis]);
+            CentBounds.Min[Axis]
+                = std::min(CentBounds.Min[Axis], TempCent[Axis]);
+            CentBounds.Max[Axis]
+                = std::max(CentBounds.Max[Axis], TempCent[Axis]);
+        }
+    }
+    uint32_t Index = static_cast<uint32_t>(Nodes.size());
+    Nodes.push_back(Node{});
+    SetNodeBox(Nodes[Index], Bounds);
+    size_t Count = End - Begin;
+    if (Count <= MAX_LEAF_SIZE) {
+        Nodes[Index].Offset = static_cast<uint32_t>(Begin);
+        Nodes[Index].Count = static_cast<uint16_t>(Count);
+        return Index;
+    }
+    //分箱SAH选择划分轴与划分箱
+    double BestCost = BOX_INF;
+    size_t BestAxis = 0;
+    size_t BestBin = 0;
+    if (Depth < MAX_SAH_DEPTH) {
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            double Extent = CentBounds.Max[Axis] - CentBounds.Min[Axis];
+            if (!(Extent > 0.0)) {
+                continue;
+            }
+            double Scale = BIN_NUM / Extent;
+            size_t BinCount[BIN_NUM] = {0};
+            Box BinBox[BIN_NUM];
+            for (size_t b = 0; b < BIN_NUM; b++) {
+                BinBox[b] = Box{{BOX_INF, BOX_INF, BOX_INF},
+                    {-BOX_INF, -BOX_INF, -BOX_INF}};
+            }
+            for (size_t i = Begin; i < End; i++) {
+                uint32_t Prim = m_BuildOrder[i];
+                size_t Bin = std::min(BIN_NUM - 1, static_cast<size_t>(
+                    (m_BuildCentroids[Prim][Axis] - CentBounds.Min[Axis])
+                    * Scale));
+                BinCount[Bin]++;
+                for (size_t k = 0; k < 3; k++) {
+                    BinBox[Bin].Min[k] = std::min(
+                        BinBox[Bin].Min[k], m_BuildBoxes[Prim].Min[k]);
+                    BinBox[Bin].Max[k] = std::max(
+                        BinBox[Bin].Max[k], m_BuildBoxes[Prim].Max[k]);
+                }
+            }
+            //从右向左累计右侧代价
+            double RightArea[BIN_NUM];
+            size_t RightCount[BIN_NUM];
+            Box Accum = BinBox[BIN_NUM - 1];
+            size_t AccumCount = BinCount[BIN_NUM - 1];
+            for (size_t b = BIN_NUM - 1; b > 0; b--) {
+                RightArea[b] = SurfaceArea(Accum.Min, Accum.Max);
+                RightCount[b] = AccumCount;
+                for (size_t k = 0; k < 3; k++) {
+                    Accum.Min[k] = std::min(Accum.Min[k], BinBox[b - 1].Min[k]);
+                    Accum.Max[k] = std::max(Accum.Max[k], BinBox[b - 1].Max[k]);
+                }
+                AccumCount += BinCount[b - 1];
+            }
+            //从左向右扫描，划分位于箱b-1与箱b之间
+            Accum = BinBox[0];
+            AccumCount = BinCount[0];
+            for (size_t b = 1; b < BIN_NUM; b++) {
+                if (AccumCount > 0 && RightCount[b] > 0) {
+                    double Cost
+                        = AccumCount * SurfaceArea(Accum.Min, Accum.Max)
+                        + RightCount[b] * RightArea[b];
+                    if (Cost < BestCost) {
+                        BestCost = Cost;
+                        BestAxis = Axis;
+                        BestBin = b;
+                    }
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    Accum.Min[k] = std::min(Accum.Min[k], BinBox[b].Min[k]);
+                    Accum.Max[k] = std::max(Accum.Max[k], BinBox[b].Max[k]);
+                }
+                AccumCount += BinCount[b];
+            }
+        }
+    }
+    //叶节点代价（求交代价1，遍历代价1）
+    double ParentArea = SurfaceArea(Bounds.Min, Bounds.Max);
+    double LeafCost = static_cast<double>(Count);
+    double SplitCost = ParentArea > 0.0
+        ? 1.0 + BestCost / ParentArea : BOX_INF;
+    if (SplitCost >= LeafCost && Count <= MAX_LEAF_SIZE * 4) {
+        Nodes[Index].Offset = static_cast<uint32_t>(Begin);
+        Nodes[Index].Count = static_cast<uint16_t>(Count);
+        return Index;
+    }
+    size_t Mid = Begin;
+    if (BestCost < BOX_INF) {
+        //按最优箱划分
+        double Scale = BIN_NUM
+            / (CentBounds.Max[BestAxis] - CentBounds.Min[BestAxis]);
+        double MinValue = CentBounds.Min[BestAxis];
+        auto Pivot = std::partition(
+            m_BuildOrder.begin() + Begin, m_BuildOrder.begin() + End,
+            [&](uint32_t Prim){
+                size_t Bin = std::min(BIN_NUM - 1, static_cast<size_t>(
+                    (m_BuildCentroids[Prim][BestAxis] - MinValue) * Scale));
+                return Bin < BestBin;});
+        Mid = static_cast<size_t>(Pivot - m_BuildOrder.begin());
+    }
+    if (Mid == Begin || Mid == End) {
+        //中位划分：取包围盒最长轴
+        BestAxis = 0;
+        for (size_t Axis = 1; Axis < 3; Axis++) {
+            if (Bounds.Max[Axis] - Bounds.Min[Axis]
+                > Bounds.Max[BestAxis] - Bounds.Min[BestAxis]) {
+                BestAxis = Axis;
+            }
+        }
+        Mid = Begin + Count / 2;
+        std::nth_element(m_BuildOrder.begin() + Begin,
+            m_BuildOrder.begin() + Mid, m_BuildOrder.begin() + End,
+            [&](uint32_t Lhs, uint32_t Rhs){
+                return m_BuildCentroids[Lhs][BestAxis]
+                    < m_BuildCentroids[Rhs][BestAxis];});
+    }
+    Nodes[Index].Axis = static_cast<uint16_t>(BestAxis);
+    Nodes[Index].Count = 0;
+    //大区间：左子树交给新线程，左右子树分别构建后拼接
+    if (ParallelDepth > 0 && Count >= Parallel::DEFAULT_MIN_CHUNK * 4) {
+        std::vector<Node> LeftNodes;
+        std::vector<Node> RightNodes;
+        std::thread Worker([&](){
+            BuildRange(Begin, Mid, LeftNodes, Depth + 1, ParallelDepth - 1);
+        });
+        BuildRange(Mid, End, RightNodes, Depth + 1, ParallelDepth - 1);
+        Worker.join();
+        //拼接并重定位内部节点的右子节点下标
+        uint32_t LeftBase = static_cast<uint32_t>(Nodes.size());
+        for (auto TempNode : LeftNodes) {
+            if (TempNode.Count == 0) {
+                TempNode.Offset += LeftBase;
+            }
+            Nodes.push_back(TempNode);
+        }
+        uint32_t RightBase = static_cast<uint32_t>(Nodes.size());
+        for (auto TempNode : RightNodes) {
+            if (TempNode.Count == 0) {
+                TempNode.Offset += RightBase;
+            }
+            Nodes.push_back(TempNode);
+        }
+        Nodes[Index].Offset = RightBase;
+    }
+    else {
+        BuildRange(Begin, Mid, Nodes, Depth + 1, 0);
+        uint32_t Right = BuildRange(Mid, End, Nodes, Depth + 1, 0);
+        Nodes[Index].Offset = Right;
+    }
+    return Index;
+}
+
+/*************************************************************************
+【函数名称】        SetNodeBox
+【函数功能】        将双精度包围盒写入节点，单精度向外取整保证包含原盒
+【参数】            Node& Target：目标节点
+                   const Box& Source：双精度包围盒
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::SetNodeBox(Node& Target, const Box& Source){
+    const float FloatInf = std::numeric_limits<float>::infinity();
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        float Min = static_cast<float>(Source.Min[Axis]);
+        float Max = static_cast<float>(Source.Max[Axis]);
+        if (static_cast<double>(Min) > Source.Min[Axis]) {
+            Min = std::nextafter(Min, -FloatInf);
+        }
+        if (static_cast<double>(Max) < Source.Max[Axis]) {
+            Max = std::nextafter(Max, FloatInf);
+        }
+        Target.Min[Axis] = Min;
+        Target.Max[Axis] = Max;
+    }
+}
+
+/*************************************************************************
+【函数名称】        RefitLeaf
+【函数功能】        由叶节点内的有效三角形重新计算包围盒（墓碑不计入）
+【参数】            uint32_t NodeIndex：叶节点下标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::RefitLeaf(uint32_t NodeIndex){
+    Node& Leaf = m_Nodes[NodeIndex];
+    Box Bounds{{BOX_INF, BOX_INF, BOX_INF}, {-BOX_INF, -BOX_INF, -BOX_INF}};
+    for (uint32_t i = Leaf.Offset; i < Leaf.Offset + Leaf.Count; i++) {
+        if (m_PrimTags[i] == RayHit3D::NO_HIT) {
+            continue;
+        }
+        const Triangle3D& Prim = m_Prims[i];
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Bounds.Min[Axis] = std::min({Bounds.Min[Axis],
+                Prim[0][Axis], Prim[1][Axis], Prim[2][Axis]});
+            Bounds.Max[Axis] = std::max({Bounds.Max[Axis],
+                Prim[0][Axis], Prim[1][Axis], Prim[2][Axis]});
+        }
+    }
+    SetNodeBox(Leaf, Bounds);
+}
+
+/*************************************************************************
+【函数名称】        RefitParents
+【函数功能】        自指定节点沿父链向上合并子节点包围盒，
+                   某一层包围盒不变时上层必然不变，提前停止
+【参数】            uint32_t NodeIndex：起始节点下标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::RefitParents(uint32_t NodeIndex){
+    uint32_t Parent = m_Parents[NodeIndex];
+    while (Parent != INVALID_INDEX) {
+        Node& TempNode = m_Nodes[Parent];
+        const Node& Left = m_Nodes[Parent + 1];
+        const Node& Right = m_Nodes[TempNode.Offset];
+        bool IsChanged = false;
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            float Min = std::min(Left.Min[Axis], Right.Min[Axis]);
+            float Max = std::max(Left.Max[Axis], Right.Max[Axis]);
+            if (Min != TempNode.Min[Axis] || Max != TempNode.Max[Axis]) {
+                TempNode.Min[Axis] = Min;
+                TempNode.Max[Axis] = Max;
+                IsChanged = true;
+            }
+        }
+        if (!IsChanged) {
+            break;
+        }
+        Parent = m_Parents[Parent];
+    }
+}
+
+/*************************************************************************
+【函数名称】        RayNode
+【函数功能】        射线与节点包围盒求交（平板法），NaN比较为假，
+                   退化情况按不剪枝处理，保证保守；空盒不相交
+【参数】            const Node& Target：节点
+                   const Coord3D& Origin：射线起点
+                   const Coord3D& InvDirection：方向各分量倒数
+                   double TMax：参数上限
+                   double& TNear：进入参数
+【返回值】          bool，相交返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::RayNode(const Node& Target, const Coord3D& Origin,
+    const Coord3D& InvDirection, double TMax, double& TNear){
+    double TEnter = 0.0;
+    double TExit = TMax;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        //按方向符号选取近、远平面，空盒（Min > Max）因此必然不相交
+        double T1 = (Target.Min[Axis] - Origin[Axis]) * InvDirection[Axis];
+        double T2 = (Target.Max[Axis] - Origin[Axis]) * InvDirection[Axis];
+        if (InvDirection[Axis] < 0.0) {
+            std::swap(T1, T2);
+        }
+        if (T1 > TEnter) {
+            TEnter = T1;
+        }
+        if (T2 < TExit) {
+            TExit = T2;
+        }
+    }
+    TNear = TEnter;
+    return TEnter <= TExit;
+}
+
+/*************************************************************************
+【函数名称】        ColumnNode
+【函数功能】        自点向+Z的射线是否可能穿过节点：点的X、Y在包围盒
+                   范围内且盒顶不低于点（单精度包围盒向外取整，判定保守）
+【参数】            const Node& Target：节点
+                   const Coord3D& Point：射线起点
+【返回值】          bool，可能穿过返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::ColumnNode(const Node& Target, const Coord3D& Point){
+    return Target.Min[0] <= Point[0] && Point[0] <= Target.Max[0]
+        && Target.Min[1] <= Point[1] && Point[1] <= Target.Max[1]
+        && Point[2] <= Target.Max[2];
+}
+
+/*************************************************************************
+【函数名称】        NodeDistance2
+【函数功能】        点到节点包围盒的距离平方：各轴超出盒的部分平方求和
+【参数】            const Node& Target：节点
+                   const Coord3D& Point：点
+【返回值】          double，距离平方，点在盒内（含表面）为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double BVH3D::NodeDistance2(const Node& Target, const Coord3D& Point){
+    double Distance2 = 0.0;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        double Excess = std::max({0.0, Target.Min[Axis] - Point[Axis],
+            Point[Axis] - Target.Max[Axis]});
+        Distance2 += Excess * Excess;
+    }
+    return Distance2;
+}
+
+/*************************************************************************
+【函数名称】        NodesOverlap
+【函数功能】        两节点包围盒各轴区间均重叠（含接触）即重叠
+【参数】            const Node& First, Second：两节点
+【返回值】          bool，重叠返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::NodesOverlap(const Node& First, const Node& Second){
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        if (First.Max[Axis] < Second.Min[Axis]
+            || Second.Max[Axis] < First.Min[Axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        IsSplitFirst
+【函数功能】        选择节点对中要拆分的节点：叶节点不拆分，两者均为内部
+                   节点时拆分包围盒表面积较大者，两树下降的深度因此均衡
+【参数】            const Node& First, Second：节点对（不同时为叶节点）
+【返回值】          bool，拆分第一个返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::IsSplitFirst(const Node& First, const Node& Second){
+    if (Second.Count > 0) {
+        return true;
+    }
+    if (First.Count > 0) {
+        return false;
+    }
+    return SurfaceArea({First.Min[0], First.Min[1], First.Min[2]},
+        {First.Max[0], First.Max[1], First.Max[2]})
+        >= SurfaceArea({Second.Min[0], Second.Min[1], Second.Min[2]},
+        {Second.Max[0], Second.Max[1], Second.Max[2]});
+}
+
+/*************************************************************************
+【函数名称】        TraversePair
+【函数功能】        两树同时深度优先遍历：节点对包围盒不重叠即剪枝，
+                   叶节点对内先比较两三角形的包围盒，再精确判定相交
+                   （墓碑跳过）
+【参数】            const BVH3D& Other：另一BVH
+                   uint32_t First：本树起始节点
+                   uint32_t Second：另一树起始节点
+                   bool IsAnyHit：是否找到一对即停止
+                   std::atomic<bool>& IsFound：全部线程共享的找到标记
+                   std::vector<std::pair<size_t, size_t>>& Pairs：
+                   相交面标签对（追加）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::TraversePair(const BVH3D& Other, uint32_t First,
+    uint32_t Second, bool IsAnyHit, std::atomic<bool>& IsFound,
+    std::vector<std::pair<size_t, size_t>>& Pairs) const{
+    //两三角形的包围盒是否分离
+    auto IsSeparated = [](const Triangle3D& Lhs, const Triangle3D& Rhs){
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            if (std::max({Lhs[0][Axis], Lhs[1][Axis], Lhs[2][Axis]})
+                < std::min({Rhs[0][Axis], Rhs[1][Axis], Rhs[2][Axis]})
+                || std::max({Rhs[0][Axis], Rhs[1][Axis], Rhs[2][Axis]})
+                < std::min({Lhs[0][Axis], Lhs[1][Axis], Lhs[2][Axis]})) {
+                return true;
+            }
+        }
+        return false;
+    };
+    std::vector<std::pair<uint32_t, uint32_t>> Stack{{First, Second}};
+    while (!Stack.empty()) {
+        if (IsAnyHit && IsFound.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::pair<uint32_t, uint32_t> Current = Stack.back();
+        Stack.pop_back();
+        const Node& Lhs = m_Nodes[Current.first];
+        const Node& Rhs = Other.m_Nodes[Current.second];
+        if (!NodesOverlap(Lhs, Rhs)) {
+            continue;
+        }
+        if (Lhs.Count > 0 && Rhs.Count > 0) {
+            for (uint32_t i = Lhs.Offset; i < Lhs.Offset + Lhs.Count; i++) {
+                if (m_PrimTags[i] == RayHit3D::NO_HIT) {
+                    continue;
+                }
+                for (uint32_t j = Rhs.Offset; j < Rhs.Offset + Rhs.Count;
+                    j++) {
+                    if (Other.m_PrimTags[j] == RayHit3D::NO_HIT
+                        || IsSeparated(m_Prims[i], Other.m_Prims[j])
+                        || !Predicates3D::TrianglesIntersect(m_Prims[i],
+                        Other.m_Prims[j])) {
+                        continue;
+                    }
+                    Pairs.emplace_back(m_PrimTags[i], Other.m_PrimTags[j]);
+                    if (IsAnyHit) {
+                        IsFound = true;
+                        return;
+                    }
+                }
+            }
+            continue;
+        }
+        if (IsSplitFirst(Lhs, Rhs)) {
+            Stack.emplace_back(Lhs.Offset, Current.second);
+            Stack.emplace_back(Current.first + 1, Current.second);
+        }
+        else {
+            Stack.emplace_back(Current.first, Rhs.Offset);
+            Stack.emplace_back(Current.first, Current.second + 1);
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        TraverseSingle
+【函数功能】        单条射线自指定节点遍历子树：子节点按进入参数先近后远，
+                   入栈节点记录进入参数，已找到更近交点时剪枝；
+                   任意交点模式下找到交点即返回
+【参数】            uint32_t Root：子树根节点下标
+                   const Coord3D& Origin：射线起点
+                   const Coord3D& Direction：射线方向
+                   bool IsAnyHit：是否为任意交点模式
+                   double& Closest：参数上限，命中时更新为最近交点参数
+                   RayHit3D& Hit：命中结果，仅在命中更近交点时改写
+【返回值】          bool，本次遍历命中返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool BVH3D::TraverseSingle(uint32_t Root, const Coord3D& Origin,
+    const Coord3D& Direction, bool IsAnyHit, double& Closest,
+    RayHit3D& Hit) const{
+    Coord3D InvDirection{
+        1.0 / Direction[0], 1.0 / Direction[1], 1.0 / Direction[2]};
+    double TNear = 0.0;
+    if (!RayNode(m_Nodes[Root], Origin, InvDirection, Closest, TNear)) {
+        return false;
+    }
+    //遍历栈：节点下标与进入参数
+    uint32_t Stack[STACK_SIZE];
+    double StackT[STACK_SIZE];
+    size_t StackSize = 0;
+    uint32_t Current = Root;
+    bool IsHit = false;
+    while (true) {
+        const Node& TempNode = m_Nodes[Current];
+        if (TempNode.Count > 0) {
+            //叶节点：逐个三角形求交
+            for (uint32_t i = TempNode.Offset;
+                i < TempNode.Offset + TempNode.Count; i++) {
+                const Triangle3D& Prim = m_Prims[i];
+                double T, U, V;
+                if (Geometry3D::RayTriangle(Origin, Direction, Prim[0],
+                    Geometry3D::Sub(Prim[1], Prim[0]),
+                    Geometry3D::Sub(Prim[2], Prim[0]), Closest, T, U, V)) {
+                    Closest = T;
+                    Hit = RayHit3D{m_PrimTags[i], T, U, V};
+                    IsHit = true;
+                    if (IsAnyHit) {
+                        return true;
+                    }
+                }
+            }
+        }
+        else {
+            //内部节点：按方向确定远近子节点
+            uint32_t Near = Current + 1;
+            uint32_t Far = TempNode.Offset;
+            if (Direction[TempNode.Axis] < 0.0) {
+                std::swap(Near, Far);
+            }
+            double TN = 0.0;
+            double TF = 0.0;
+            bool IsNear = RayNode(
+                m_Nodes[Near], Origin, InvDirection, Closest, TN);
+            bool IsFar = RayNode(
+                m_Nodes[Far], Origin, InvDirection, Closest, TF);
+            if (IsNear && IsFar) {
+                if (TF < TN) {
+                    std::swap(Near, Far);
+                    std::swap(TN, TF);
+                }
+                Stack[StackSize] = Far;
+                StackT[StackSize] = TF;
+                StackSize++;
+                Current = Near;
+                continue;
+            }
+            if (IsNear || IsFar) {
+                Current = IsNear ? Near : Far;
+                continue;
+            }
+        }
+        //出栈，跳过比已知交点更远的节点
+        bool IsFound = false;
+        while (StackSize > 0) {
+            StackSize--;
+            if (StackT[StackSize] < Closest) {
+                Current = Stack[StackSize];
+                IsFound = true;
+                break;
+            }
+        }
+        if (!IsFound) {
+            break;
+        }
+    }
+    return IsHit;
+}
+
+/*************************************************************************
+【函数名称】        TraversePacket
+【函数功能】        射线包共同遍历：节点包围盒对所有通道逐通道求交，
+                   任一通道相交即进入；子节点访问顺序取首条射线的方向；
+                   叶节点内各三角形对相交通道逐一求交。
+                   通道数据按分量存放于定长数组，循环无分支，便于向量化；
+                   任意交点模式下命中通道的参数上限置为负数，此后不再相交；
+                   仅剩一条射线相交的子树改用单射线遍历
+【参数】            const Coord3D* Origins：各射线起点
+                   const Coord3D* Directions：各射线方向
+                   size_t Count：射线数，不超过PACKET_SIZE
+                   double TMax：参数上限
+                   bool IsAnyHit：是否为任意交点模式
+                   RayHit3D* Hits：各射线命中结果
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BVH3D::TraversePacket(const Coord3D* Origins, const Coord3D* Directions,
+    size_t Count, double TMax, bool IsAnyHit, RayHit3D* Hits) const{
+    Count = std::min(Count, PACKET_SIZE);
+    for (size_t Lane = 0; Lane < Count; Lane++) {
+        Hits[Lane] = RayHit3D{RayHit3D::NO_HIT, 0.0, 0.0, 0.0};
+    }
+    if (m_Nodes.empty() || Count == 0) {
+        return;
+    }
+    //各通道分量（空余通道上限为负，始终不相交）
+    alignas(64) double Origin[3][PACKET_SIZE];
+    alignas(64) double InvDirection[3][PACKET_SIZE];
+    alignas(64) double Closest[PACKET_SIZE];
+    for (size_t Lane = 0; Lane < PACKET_SIZE; Lane++) {
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Origin[Axis][Lane] = Lane < Count ? Origins[Lane][Axis] : 0.0;
+            InvDirection[Axis][Lane]
+                = Lane < Count ? 1.0 / Directions[Lane][Axis] : 1.0;
+        }
+        Closest[Lane] = Lane < Count ? TMax : -1.0;
+    }
+    uint32_t Stack[STACK_SIZE];
+    size_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0) {
+        const Node& TempNode = m_Nodes[Stack[--StackSize]];
+        //逐通道平板法求交，NaN比较为假，按不剪枝处理
+        alignas(64) double TEnter[PACKET_SIZE];
+        alignas(64) double TExit[PACKET_SIZE];
+        for (size_t Lane = 0; Lane < PACKET_SIZE; Lane++) {
+            TEnter[Lane] = 0.0;
+            TExit[Lane] = Closest[Lane];
+        }
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            double Min = TempNode.Min[Axis];
+            double Max = TempNode.Max[Axis];
+            for (size_t Lane = 0; Lane < PACKET_SIZE; Lane++) {
+                double T1 = (Min - Origin[Axis][Lane])
+                    * InvDirection[Axis][Lane];
+                double T2 = (Max - Origin[Axis][Lane])
+                    * InvDirection[Axis][Lane];
+                bool IsNegative = InvDirection[Axis][Lane] < 0.0;
+                double TNear = IsNegative ? T2 : T1;
+                double TFar = IsNegative ? T1 : T2;
+                TEnter[Lane] = TNear > TEnter[Lane] ? TNear : TEnter[Lane];
+                TExit[Lane] = TFar < TExit[Lane] ? TFar : TExit[Lane];
+            }
+        }
+        uint8_t IsActive[PACKET_SIZE];
+        size_t ActiveNum = 0;
+        for (size_t Lane = 0; Lane < PACKET_SIZE; Lane++) {
+            IsActive[Lane] = TEnter[Lane] <= TExit[Lane] ? 1 : 0;
+            ActiveNum += IsActive[Lane];
+        }
+        if (ActiveNum == 0) {
+            continue;
+        }
+        //仅剩一条射线相交时改为单射线遍历该子树，避免整包开销
+        if (ActiveNum == 1) {
+            size_t Lane = 0;
+            while (!IsActive[Lane]) {
+                Lane++;
+            }
+            if (TraverseSingle(static_cast<uint32_t>(&TempNode - &m_Nodes[0]),
+                Origins[Lane], Directions[Lane], IsAnyHit, Closest[Lane],
+                Hits[Lane]) && IsAnyHit) {
+                Closest[Lane] = -1.0;
+            }
+            continue;
+        }
+        if (TempNode.Count > 0) {
+            //叶节点：各三角形对相交通道求交
+            for (uint32_t i = TempNode.Offset;
+                i < TempNode.Offset + TempNode.Count; i++) {
+                const Coord3D& V0 = m_Prims[i][0];
+                Coord3D E1 = Geometry3D::Sub(m_Prims[i][1], V0);
+                Coord3D E2 = Geometry3D::Sub(m_Prims[i][2], V0);
+                for (size_t Lane = 0; Lane < Count; Lane++) {
+                    double T, U, V;
+                    if (IsActive[Lane] && Geometry3D::RayTriangle(
+                        Origins[Lane], Directions[Lane], V0, E1, E2,
+                        Closest[Lane], T, U, V)) {
+                        Hits[Lane] = RayHit3D{m_PrimTags[i], T, U, V};
+                        Closest[Lane] = IsAnyHit ? -1.0 : T;
+                    }
+                }
+            }
+        }
+        else {
+            //按首条射线方向先近后远
+            uint32_t Near = static_cast<uint32_t>(&TempNode - &m_Nodes[0]) + 1;
+            uint32_t Far = TempNode.Offset;
+            if (Directions[0][TempNode.Axis] < 0.0) {
+                std::swap(Near, Far);
+            }
+            Stack[StackSize++] = Far;
+            Stack[StackSize++] = Near;
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        CoherentOrder
+【函数功能】        射线一致性排序：键由方向卦限（3位）、起点Morton码
+                   （每轴10位，按根包围盒量化）与方向Morton码（每轴10位）
+                   拼接而成，键并行计算后并行排序
+【参数】            const std::vector<Coord3D>& Origins：各射线起点
+                   const std::vector<Coord3D>& Directions：各射线方向
+【返回值】          std::vector<size_t>，排序后的射线下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::vector<size_t> BVH3D::CoherentOrder(const std::vector<Coord3D>& Origins,
+    const std::vector<Coord3D>& Directions) const{
+    size_t Count = std::min(Origins.size(), Directions.size());
+    //起点量化区间取根节点包围盒
+    Coord3D Min{0.0, 0.0, 0.0};
+    Coord3D Max{0.0, 0.0, 0.0};
+    if (!m_Nodes.empty()) {
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Min[Axis] = m_Nodes[0].Min[Axis];
+            Max[Axis] = m_Nodes[0].Max[Axis];
+        }
+    }
+    std::vector<std::pair<uint64_t, size_t>> Keys(Count);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            const Coord3D& Direction = Directions[i];
+            double Length = Geometry3D::Length(Direction);
+            double Scale = Length > 0.0 ? 1.0 / Length : 0.0;
+            uint64_t Octant = 0;
+            uint64_t OriginCode = 0;
+            uint64_t DirectionCode = 0;
+            for (size_t Axis = 0; Axis < 3; Axis++) {
+                Octant |= static_cast<uint64_t>(Direction[Axis] < 0.0) << Axis;
+                OriginCode |= SpreadBits(Quantize(
+                    Origins[i][Axis], Min[Axis], Max[Axis])) << Axis;
+                DirectionCode |= SpreadBits(Quantize(
+                    Direction[Axis] * Scale, -1.0, 1.0)) << Axis;
+            }
+            Keys[i] = std::make_pair(
+                (Octant << 60) | (OriginCode << 30) | DirectionCode, i);
+        }
+    });
+    Parallel::Sort(Keys.begin(), Keys.end(),
+        [](const std::pair<uint64_t, size_t>& Lhs,
+            const std::pair<uint64_t, size_t>& Rhs){
+            return Lhs.first < Rhs.first;});
+    std::vector<size_t> Order(Count);
+    for (size_t i = 0; i < Count; i++) {
+        Order[i] = Keys[i].second;
+    }
+    return Order;
+}
@@ -0,0 +1,238 @@
+/*************************************************************************
+【文件名】                 BVH3D.hpp
+【功能模块和目的】          三角形面包围体层次结构（BVH）类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加射线包与批量查询
+                          梁思奇 2026/10/18 图元保存原始顶点，增加点内外判定
+                          梁思奇 2026/10/18 增加两树同时遍历的三角形相交查询
+                          梁思奇 2026/10/18 增加最近点查询
+*************************************************************************/
+
+#ifndef BVH3D_HPP
+#define BVH3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t、SIZE_MAX所属头文件
+#include <cstddef>
+//uint32_t、uint16_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::pair所属头文件
+#include <utility>
+//std::atomic所属头文件
+#include <atomic>
+
+/*************************************************************************
+【类名】             RayHit3D
+【功能】             射线求交结果
+【接口说明】         数据类：命中面标签、射线参数与重心坐标
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class RayHit3D{
+public:
+    //命中面标签，未命中为NO_HIT
+    size_t FaceTag;
+    //射线参数（方向单位化时即为距离）
+    double T;
+    //重心坐标U（对应顶点1）
+    double U;
+    //重心坐标V（对应顶点2）
+    double V;
+    //静态常量：未命中标记
+    static constexpr size_t NO_HIT{SIZE_MAX};
+};
+
+/*************************************************************************
+【类名】             BVH3D
+【功能】             三角形面的包围体层次结构，加速射线查询
+【接口说明】         分箱SAH并行构建，节点扁平存放（每节点32字节，
+                    左子节点紧随父节点，右子节点存偏移）；
+                    支持最近交点与任意交点查询；
+                    支持按面标签增量重拟合（修改面）与交换-弹出删除，
+                    墓碑过多时提示重建；三角形以面标签为下标输入
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加射线包与批量查询：
+                    射线按方向卦限与起点、方向的Morton码排序，相邻
+                    PACKET_SIZE条组成一包共同遍历，各通道以定长数组
+                    逐通道计算，便于编译器向量化；各包分配给全部线程
+                    梁思奇 2026/10/18 图元改为原样保存三顶点（边在求交时
+                    现算），相邻面共享顶点坐标完全一致；增加点内外判定：
+                    自点向+Z的射线只访问XY范围包含该点的节点，穿面判定
+                    精确且共享边只计一次，按穿过次数的奇偶判定；批量
+                    判定按点的XY格计数排序后分给全部线程，结果为位掩码
+                    梁思奇 2026/10/18 增加与另一BVH的三角形相交查询：
+                    两树同时遍历，每次拆分较大（或非叶）的节点，叶节点
+                    对内精确判定三角形相交；重叠节点对先逐层展开为足够
+                    多的子树对任务，各线程动态领取，任意相交模式下
+                    找到一对后全部线程停止
+                    梁思奇 2026/10/18 增加最近点查询：分支定界，子节点
+                    按到包围盒的距离先近后远，距离上限随找到的更近点
+                    收紧，给定较紧的初始上限时只访问少量节点
+*************************************************************************/
+class BVH3D{
+public:
+    //三角形三顶点坐标
+    using Triangle3D = ::Triangle3D;
+
+    //扁平节点：单精度包围盒（向外取整，保证保守），共32字节
+    class Node{
+    public:
+        //包围盒最小角点
+        float Min[3];
+        //包围盒最大角点
+        float Max[3];
+        //叶节点：首个图元下标；内部节点：右子节点下标
+        uint32_t Offset;
+        //叶节点图元数，内部节点为0
+        uint16_t Count;
+        //内部节点划分轴
+        uint16_t Axis;
+    };
+
+    //默认构造函数，空结构
+    BVH3D() = default;
+    //拷贝构造函数
+    BVH3D(const BVH3D& Source) = default;
+    //虚析构函数
+    virtual ~BVH3D() = default;
+    //赋值运算符
+    BVH3D& operator=(const BVH3D& Source) = default;
+
+    //Setter
+    //由三角形列表并行构建（下标即面标签）
+    void Build(const std::vector<Triangle3D>& Triangles);
+    //修改指定面标签的三角形并沿父链重拟合包围盒
+    void Refit(size_t FaceTag, const Triangle3D& Triangle);
+    //交换-弹出删除：删除FaceTag，原最后一个标签改记为FaceTag
+    void Remove(size_t FaceTag);
+
+    //Getter
+    //最近交点查询
+    bool Intersect(const Coord3D& Origin, const Coord3D& Direction,
+        double TMax, RayHit3D& Hit) const;
+    //任意交点（遮挡）查询
+    bool Occluded(const Coord3D& Origin, const Coord3D& Direction,
+        double TMax) const;
+    //射线包最近交点查询（Count不超过PACKET_SIZE）
+    void IntersectPacket(const Coord3D* Origins, const Coord3D* Directions,
+        size_t Count, double TMax, RayHit3D* Hits) const;
+    //射线包遮挡查询（Count不超过PACKET_SIZE）
+    void OccludedPacket(const Coord3D* Origins, const Coord3D* Directions,
+        size_t Count, double TMax, uint8_t* Results) const;
+    //批量最近交点查询：一致性排序后组包，全部线程并行
+    void IntersectBatch(const std::vector<Coord3D>& Origins,
+        const std::vector<Coord3D>& Directions, double TMax,
+        std::vector<RayHit3D>& Hits) const;
+    //批量遮挡查询：一致性排序后组包，全部线程并行
+    void OccludedBatch(const std::vector<Coord3D>& Origins,
+        const std::vector<Coord3D>& Directions, double TMax,
+        std::vector<uint8_t>& Results) const;
+    //点是否在封闭网格内（自点向+Z的射线穿面次数为奇数），
+    //点恰在面上时结果不定
+    bool Contains(const Coord3D& Point) const;
+    //批量内外判定：Coordinates依次为各点的X、Y、Z，
+    //Mask第i / 64个字的第i % 64位为第i个点的结果
+    void ContainsBatch(const std::vector<double>& Coordinates,
+        std::vector<uint64_t>& Mask) const;
+    //与另一BVH的三角形相交查询：Pairs为相交的（本树面标签，另一树
+    //面标签），按标签升序；IsAnyHit为true时至多找出一对即停止
+    void IntersectPairs(const BVH3D& Other, bool IsAnyHit,
+        std::vector<std::pair<size_t, size_t>>& Pairs) const;
+    //最近点查询：距Point不超过MaxDistance的三角形中最近的一个，
+    //找到时FaceTag为其面标签、Closest为其上的最近点
+    bool ClosestPoint(const Coord3D& Point, double MaxDistance,
+        size_t& FaceTag, Coord3D& Closest) const;
+    //墓碑比例过高，建议重建
+    bool NeedRebuild() const;
+    //三角形数（不含墓碑）
+    size_t TriangleNum() const;
+    //节点数
+    size_t NodeNum() const;
+
+    //静态常量：叶节点最大图元数
+    static constexpr size_t MAX_LEAF_SIZE{4};
+    //静态常量：SAH分箱数
+    static constexpr size_t BIN_NUM{16};
+    //静态常量：无效下标
+    static constexpr uint32_t INVALID_INDEX{UINT32_MAX};
+    //静态常量：超过此深度改为中位划分，限制树深
+    static constexpr size_t MAX_SAH_DEPTH{96};
+    //静态常量：遍历栈容量
+    static constexpr size_t STACK_SIZE{256};
+    //静态常量：射线包宽度（AVX-512双精度通道数）
+    static constexpr size_t PACKET_SIZE{8};
+    //静态常量：相交查询展开的子树对任务数（每线程）
+    static constexpr size_t PAIR_TASKS_PER_THREAD{16};
+
+private:
+    //构建期双精度包围盒
+    class Box{
+    public:
+        Coord3D Min;
+        Coord3D Max;
+    };
+
+    //递归构建[Begin, End)区间，节点追加到Nodes，返回节点下标
+    uint32_t BuildRange(size_t Begin, size_t End, std::vector<Node>& Nodes,
+        size_t Depth, size_t ParallelDepth);
+    //由包围盒写节点（向外取整）
+    static void SetNodeBox(Node& Target, const Box& Source);
+    //重新计算叶节点包围盒
+    void RefitLeaf(uint32_t NodeIndex);
+    //沿父链向上重拟合
+    void RefitParents(uint32_t NodeIndex);
+    //射线与节点包围盒相交，返回进入参数
+    static bool RayNode(const Node& Target, const Coord3D& Origin,
+        const Coord3D& InvDirection, double TMax, double& TNear);
+    //单射线自指定节点遍历子树，IsAnyHit为true时命中即停止
+    bool TraverseSingle(uint32_t Root, const Coord3D& Origin,
+        const Coord3D& Direction, bool IsAnyHit, double& Closest,
+        RayHit3D& Hit) const;
+    //射线包共同遍历，IsAnyHit为true时各射线命中即停止
+    void TraversePacket(const Coord3D* Origins, const Coord3D* Directions,
+        size_t Count, double TMax, bool IsAnyHit, RayHit3D* Hits) const;
+    //竖直线是否穿过节点包围盒的XY范围，且盒顶不低于Point
+    static bool ColumnNode(const Node& Target, const Coord3D& Point);
+    //点到节点包围盒的距离平方（点在盒内为0）
+    static double NodeDistance2(const Node& Target, const Coord3D& Point);
+    //两节点包围盒是否重叠（含接触）
+    static bool NodesOverlap(const Node& First, const Node& Second);
+    //节点对应拆分第一个节点：第二个为叶节点，或两者均为内部节点
+    //且第一个包围盒表面积不小于第二个
+    static bool IsSplitFirst(const Node& First, const Node& Second);
+    //自节点对同时遍历两棵树，相交面标签对追加到Pairs；
+    //任意相交模式下找到一对时置位IsFound，其他线程见到后停止
+    void TraversePair(const BVH3D& Other, uint32_t First, uint32_t Second,
+        bool IsAnyHit, std::atomic<bool>& IsFound,
+        std::vector<std::pair<size_t, size_t>>& Pairs) const;
+    //射线一致性排序，返回射线下标序列
+    std::vector<size_t> CoherentOrder(const std::vector<Coord3D>& Origins,
+        const std::vector<Coord3D>& Directions) const;
+
+    //扁平节点数组，0号为根
+    std::vector<Node> m_Nodes;
+    //按叶节点顺序排列的三角形（原样保存顶点，墓碑退化为一点）
+    std::vector<Triangle3D> m_Prims;
+    //每个图元对应的面标签，墓碑为RayHit3D::NO_HIT
+    std::vector<size_t> m_PrimTags;
+    //每个图元所在叶节点
+    std::vector<uint32_t> m_PrimLeaves;
+    //每个节点的父节点
+    std::vector<uint32_t> m_Parents;
+    //面标签到图元下标
+    std::vector<uint32_t> m_TagToPrim;
+    //构建期：各三角形包围盒与重心（构建后释放）
+    std::vector<Box> m_BuildBoxes;
+    std::vector<Coord3D> m_BuildCentroids;
+    //构建期：图元排列
+    std::vector<uint32_t> m_BuildOrder;
+    //墓碑数
+    size_t m_ullTombstoneNum{0};
+};
+
+#endif //BVH3D_HPP
@@ -0,0 +1,420 @@
+/*************************************************************************
+【文件名】                 BoundingVolume3D.cpp
+【功能模块和目的】          有向包围盒与包围球计算类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "BoundingVolume3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::numeric_limits所属头文件
+#include <limits>
+//std::sqrt、std::abs所属头文件
+#include <cmath>
+//std::min、std::max、std::sort所属头文件
+#include <algorithm>
+//std::pair所属头文件
+#include <utility>
+
+/*************************************************************************
+【函数名称】        OrientedBox
+【函数功能】        计算有向包围盒：PCA主轴为初值，每轮依次固定一条轴，
+                   在其余两轴平面上求投影凸包的最小面积外接矩形，
+                   得到新的候选轴组，保留体积最小者，直到不再变小
+【参数】            const std::vector<Coord3D>& Points：点集
+【返回值】          OrientedBox3D，有向包围盒
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+OrientedBox3D BoundingVolume3D::OrientedBox(
+    const std::vector<Coord3D>& Points){
+    std::array<Coord3D, 3> Identity{{
+        {{1.0, 0.0, 0.0}}, {{0.0, 1.0, 0.0}}, {{0.0, 0.0, 1.0}}}};
+    if (Points.empty()) {
+        return OrientedBox3D{{{0.0, 0.0, 0.0}}, Identity,
+            {{0.0, 0.0, 0.0}}, 0.0};
+    }
+    //并行求均值与协方差（先求均值再中心化，避免大坐标相消）
+    size_t Count = Points.size();
+    Coord3D Mean = Parallel::Reduce(0, Count, Coord3D{{0.0, 0.0, 0.0}},
+        [&](size_t First, size_t Last){
+            Coord3D Sum{{0.0, 0.0, 0.0}};
+            for (size_t i = First; i < Last; i++) {
+                Sum = Geometry3D::Add(Sum, Points[i]);
+            }
+            return Sum;
+        },
+        [](const Coord3D& Lhs, const Coord3D& Rhs){
+            return Geometry3D::Add(Lhs, Rhs);});
+    Mean = Geometry3D::Scale(Mean, 1.0 / static_cast<double>(Count));
+    using Covariance = std::array<Coord3D, 3>;
+    Covariance Zero{{{{0.0, 0.0, 0.0}}, {{0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0}}}};
+    Covariance Matrix = Parallel::Reduce(0, Count, Zero,
+        [&](size_t First, size_t Last){
+            Covariance Sum{};
+            for (size_t i = First; i < Last; i++) {
+                Coord3D D = Geometry3D::Sub(Points[i], Mean);
+                for (size_t r = 0; r < 3; r++) {
+                    for (size_t c = 0; c < 3; c++) {
+                        Sum[r][c] += D[r] * D[c];
+                    }
+                }
+            }
+            return Sum;
+        },
+        [](Covariance Lhs, const Covariance& Rhs){
+            for (size_t r = 0; r < 3; r++) {
+                Lhs[r] = Geometry3D::Add(Lhs[r], Rhs[r]);
+            }
+            return Lhs;
+        });
+    std::array<Coord3D, 3> Vectors;
+    SymmetricEigen(Matrix, Vectors);
+    //特征向量按列存储，转为轴并保证右手系
+    std::array<Coord3D, 3> Axes;
+    for (size_t k = 0; k < 3; k++) {
+        Axes[k] = Coord3D{{Vectors[0][k], Vectors[1][k], Vectors[2][k]}};
+    }
+    Axes[2] = Geometry3D::Cross(Axes[0], Axes[1]);
+    OrientedBox3D Best = FitBox(Points, Axes);
+    //候选盒是否更小：比较体积，共面点集（体积为0）比较表面积；
+    //相对改进过小时视为收敛，避免舍入误差导致的反复
+    auto SurfaceArea = [](const OrientedBox3D& Box){
+        const Coord3D& H = Box.HalfExtents;
+        return 8.0 * (H[0] * H[1] + H[1] * H[2] + H[2] * H[0]);
+    };
+    auto IsSmaller = [&](const OrientedBox3D& Box){
+        if (Best.Volume > 0.0) {
+            return Box.Volume < Best.Volume * (1.0 - 1e-9);
+        }
+        return SurfaceArea(Box) < SurfaceArea(Best) * (1.0 - 1e-9);
+    };
+    //凸包细化
+    std::vector<std::array<double, 2>> Projected(Count);
+    for (size_t Round = 0; Round < MAX_REFINE_ROUND; Round++) {
+        bool IsImproved = false;
+        for (size_t k = 0; k < 3; k++) {
+            const Coord3D& Fixed = Best.Axes[k];
+            const Coord3D& U = Best.Axes[(k + 1) % 3];
+            const Coord3D& V = Best.Axes[(k + 2) % 3];
+            Parallel::For(0, Count, [&](size_t First, size_t Last){
+                for (size_t i = First; i < Last; i++) {
+                    Projected[i] = std::array<double, 2>{{
+                        Geometry3D::Dot(Points[i], U),
+                        Geometry3D::Dot(Points[i], V)}};
+                }
+            });
+            std::vector<std::array<double, 2>> Hull
+                = ConvexHull2D(Projected);
+            if (Hull.size() < 3) {
+                continue;
+            }
+            std::array<double, 2> Direction = MinAreaRectangle(Hull);
+            std::array<Coord3D, 3> Candidate;
+            Candidate[0] = Fixed;
+            Candidate[1] = Geometry3D::Add(Geometry3D::Scale(U, Direction[0]),
+                Geometry3D::Scale(V, Direction[1]));
+            Candidate[1] = Geometry3D::Scale(Candidate[1],
+                1.0 / Geometry3D::Length(Candidate[1]));
+            Candidate[2] = Geometry3D::Cross(Candidate[0], Candidate[1]);
+            OrientedBox3D Box = FitBox(Points, Candidate);
+            if (IsSmaller(Box)) {
+                Best = Box;
+                IsImproved = true;
+            }
+        }
+        if (!IsImproved) {
+            break;
+        }
+    }
+    return Best;
+}
+
+/*************************************************************************
+【函数名称】        BoundingSphere
+【函数功能】        计算近似最小包围球：Ritter法取初始直径（任一点的最远点
+                   及其最远点），之后反复并行求距球心最远的点，
+                   若在球外则扩大球恰好包含该点与原球，直到全部点在球内
+【参数】            const std::vector<Coord3D>& Points：点集
+【返回值】          BoundingSphere3D，包围球
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+BoundingSphere3D BoundingVolume3D::BoundingSphere(
+    const std::vector<Coord3D>& Points){
+    if (Points.empty()) {
+        return BoundingSphere3D{{{0.0, 0.0, 0.0}}, 0.0};
+    }
+    double DistanceSquared = 0.0;
+    const Coord3D& Y = Points[Farthest(Points, Points[0], DistanceSquared)];
+    const Coord3D& Z = Points[Farthest(Points, Y, DistanceSquared)];
+    Coord3D Center = Geometry3D::Scale(Geometry3D::Add(Y, Z), 0.5);
+    double Radius = 0.5 * std::sqrt(DistanceSquared);
+    while (true) {
+        size_t Index = Farthest(Points, Center, DistanceSquared);
+        double Distance = std::sqrt(DistanceSquared);
+        //最远点已在球内（留相对余量，避免舍入误差导致的反复）
+        if (Distance <= Radius * (1.0 + 1e-12)) {
+            Radius = std::max(Radius, Distance);
+            break;
+        }
+        //新球与原球内切于远离该点的一侧，并经过该点
+        double NewRadius = 0.5 * (Radius + Distance);
+        Coord3D Offset = Geometry3D::Sub(Points[Index], Center);
+        Center = Geometry3D::Add(Center,
+            Geometry3D::Scale(Offset, (Distance - NewRadius) / Distance));
+        Radius = NewRadius;
+    }
+    return BoundingSphere3D{Center, Radius};
+}
+
+/*************************************************************************
+【函数名称】        FitBox
+【函数功能】        按指定轴并行求点集投影极值，得到有向包围盒
+【参数】            const std::vector<Coord3D>& Points：点集（非空）
+                   const std::array<Coord3D, 3>& Axes：单位正交轴
+【返回值】          OrientedBox3D，有向包围盒
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+OrientedBox3D BoundingVolume3D::FitBox(const std::vector<Coord3D>& Points,
+    const std::array<Coord3D, 3>& Axes){
+    using Extents = std::array<double, 6>;
+    double Infinity = std::numeric_limits<double>::infinity();
+    Extents Init{{Infinity, Infinity, Infinity,
+        -Infinity, -Infinity, -Infinity}};
+    Extents Range = Parallel::Reduce(0, Points.size(), Init,
+        [&](size_t First, size_t Last){
+            Extents Partial = Init;
+            for (size_t i = First; i < Last; i++) {
+                for (size_t k = 0; k < 3; k++) {
+                    double T = Geometry3D::Dot(Points[i], Axes[k]);
+                    Partial[k] = std::min(Partial[k], T);
+                    Partial[3 + k] = std::max(Partial[3 + k], T);
+                }
+            }
+            return Partial;
+        },
+        [](Extents Lhs, const Extents& Rhs){
+            for (size_t k = 0; k < 3; k++) {
+                Lhs[k] = std::min(Lhs[k], Rhs[k]);
+                Lhs[3 + k] = std::max(Lhs[3 + k], Rhs[3 + k]);
+            }
+            return Lhs;
+        });
+    OrientedBox3D Box;
+    Box.Axes = Axes;
+    Box.Center = Coord3D{{0.0, 0.0, 0.0}};
+    Box.Volume = 1.0;
+    for (size_t k = 0; k < 3; k++) {
+        Box.HalfExtents[k] = 0.5 * (Range[3 + k] - Range[k]);
+        Box.Center = Geometry3D::Add(Box.Center, Geometry3D::Scale(Axes[k],
+            0.5 * (Range[3 + k] + Range[k])));
+        Box.Volume *= 2.0 * Box.HalfExtents[k];
+    }
+    return Box;
+}
+
+/*************************************************************************
+【函数名称】        SymmetricEigen
+【函数功能】        对称3×3矩阵的特征向量（循环Jacobi旋转，至多50轮）
+【参数】            std::array<Coord3D, 3> Matrix：对称矩阵（按值传入）
+                   std::array<Coord3D, 3>& Vectors：特征向量（按列，
+                   单位正交）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void BoundingVolume3D::SymmetricEigen(std::array<Coord3D, 3> Matrix,
+    std::array<Coord3D, 3>& Vectors){
+    Vectors = std::array<Coord3D, 3>{{
+        {{1.0, 0.0, 0.0}}, {{0.0, 1.0, 0.0}}, {{0.0, 0.0, 1.0}}}};
+    for (size_t Sweep = 0; Sweep < 50; Sweep++) {
+        double OffDiagonal = std::abs(Matrix[0][1]) + std::abs(Matrix[0][2])
+            + std::abs(Matrix[1][2]);
+        if (OffDiagonal == 0.0) {
+            return;
+        }
+        for (size_t p = 0; p < 2; p++) {
+            for (size_t q = p + 1; q < 3; q++) {
+                if (Matrix[p][q] == 0.0) {
+                    continue;
+                }
+                //求使Matrix[p][q]为0的旋转角
+                double Theta = (Matrix[q][q] - Matrix[p][p])
+                    / (2.0 * Matrix[p][q]);
+                double T = (Theta >= 0.0 ? 1.0 : -1.0)
+                    / (std::abs(Theta) + std::sqrt(Theta * Theta + 1.0));
+                double C = 1.0 / std::sqrt(T * T + 1.0);
+                double S = T * C;
+                for (size_t k = 0; k < 3; k++) {
+                    double Mkp = Matrix[k][p];
+                    double Mkq = Matrix[k][q];
+                    Matrix[k][p] = C * Mkp - S * Mkq;
+                    Matrix[k][q] = S * Mkp + C * Mkq;
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    double Mpk = Matrix[p][k];
+                    double Mqk = Matrix[q][k];
+                    Matrix[p][k] = C * Mpk - S * Mqk;
+                    Matrix[q][k] = S * Mpk + C * Mqk;
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    double Vkp = Vectors[k][p];
+                    double Vkq = Vectors[k][q];
+                    Vectors[k][p] = C * Vkp - S * Vkq;
+                    Vectors[k][q] = S * Vkp + C * Vkq;
+                }
+            }
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        ConvexHull2D
+【函数功能】        二维点集凸包（Andrew单调链），点按坐标并行排序
+【参数】            std::vector<std::array<double, 2>>& Points：点集
+                   （被排序）
+【返回值】          std::vector<std::array<double, 2>>，凸包顶点，
+                   逆时针且无共线点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::vector<std::array<double, 2>> BoundingVolume3D::ConvexHull2D(
+    std::vector<std::array<double, 2>>& Points){
+    using Point2D = std::array<double, 2>;
+    Parallel::Sort(Points.begin(), Points.end(),
+        [](const Point2D& Lhs, const Point2D& Rhs){return Lhs < Rhs;});
+    auto Cross = [](const Point2D& O, const Point2D& A, const Point2D& B){
+        return (A[0] - O[0]) * (B[1] - O[1]) - (A[1] - O[1]) * (B[0] - O[0]);
+    };
+    std::vector<Point2D> Hull(2 * Points.size());
+    size_t Size = 0;
+    //下链
+    for (size_t i = 0; i < Points.size(); i++) {
+        while (Size >= 2 && Cross(Hull[Size - 2], Hull[Size - 1],
+            Points[i]) <= 0.0) {
+            Size--;
+        }
+        Hull[Size++] = Points[i];
+    }
+    //上链
+    size_t LowerSize = Size + 1;
+    for (size_t i = Points.size() - 1; i > 0; i--) {
+        while (Size >= LowerSize && Cross(Hull[Size - 2], Hull[Size - 1],
+            Points[i - 1]) <= 0.0) {
+            Size--;
+        }
+        Hull[Size++] = Points[i - 1];
+    }
+    //末点与起点重合
+    Hull.resize(Size > 1 ? Size - 1 : Size);
+    return Hull;
+}
+
+/*************************************************************************
+【函数名称】        MinAreaRectangle
+【函数功能】        旋转卡壳求凸多边形最小面积外接矩形：
+                   矩形必有一边与多边形某边共线，依次以各边为底，
+                   沿边方向最大、最小与法向最远三个支撑点单调前进，O(h)
+【参数】            const std::vector<std::array<double, 2>>& Hull：
+                   逆时针凸多边形（至少3个顶点）
+【返回值】          std::array<double, 2>，矩形一边的单位方向
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::array<double, 2> BoundingVolume3D::MinAreaRectangle(
+    const std::vector<std::array<double, 2>>& Hull){
+    using Point2D = std::array<double, 2>;
+    size_t Size = Hull.size();
+    auto Dot = [](const Point2D& A, const Point2D& B){
+        return A[0] * B[0] + A[1] * B[1];
+    };
+    auto EdgeAt = [&](size_t i){
+        const Point2D& A = Hull[i];
+        const Point2D& B = Hull[(i + 1) % Size];
+        double Length = std::sqrt((B[0] - A[0]) * (B[0] - A[0])
+            + (B[1] - A[1]) * (B[1] - A[1]));
+        return Point2D{{(B[0] - A[0]) / Length, (B[1] - A[1]) / Length}};
+    };
+    //支撑点：Right沿边方向最大，Top沿内法向最远，Left沿边方向最小
+    size_t Right = 0;
+    size_t Top = 0;
+    size_t Left = 0;
+    double BestArea = std::numeric_limits<double>::infinity();
+    Point2D BestDirection{{1.0, 0.0}};
+    for (size_t i = 0; i < Size; i++) {
+        Point2D Edge = EdgeAt(i);
+        //逆时针多边形的内法向在边的左侧
+        Point2D Normal{{-Edge[1], Edge[0]}};
+        if (i == 0) {
+            for (size_t j = 1; j < Size; j++) {
+                if (Dot(Hull[j], Edge) > Dot(Hull[Right], Edge)) {
+                    Right = j;
+                }
+                if (Dot(Hull[j], Normal) > Dot(Hull[Top], Normal)) {
+                    Top = j;
+                }
+                if (Dot(Hull[j], Edge) < Dot(Hull[Left], Edge)) {
+                    Left = j;
+                }
+            }
+        }
+        else {
+            //各支撑点随边转动单调前进，总步数O(h)
+            for (size_t Step = 0; Step < Size && Dot(Hull[(Right + 1) % Size],
+                Edge) >= Dot(Hull[Right], Edge); Step++) {
+                Right = (Right + 1) % Size;
+            }
+            for (size_t Step = 0; Step < Size && Dot(Hull[(Top + 1) % Size],
+                Normal) >= Dot(Hull[Top], Normal); Step++) {
+                Top = (Top + 1) % Size;
+            }
+            for (size_t Step = 0; Step < Size && Dot(Hull[(Left + 1) % Size],
+                Edge) <= Dot(Hull[Left], Edge); Step++) {
+                Left = (Left + 1) % Size;
+            }
+        }
+        double Width = Dot(Hull[Right], Edge) - Dot(Hull[Left], Edge);
+        double Height = Dot(Hull[Top], Normal) - Dot(Hull[i], Normal);
+        if (Width * Height < BestArea) {
+            BestArea = Width * Height;
+            BestDirection = Edge;
+        }
+    }
+    return BestDirection;
+}
+
+/*************************************************************************
+【函数名称】        Farthest
+【函数功能】        并行求距指定点最远的点（距离相同取下标最小者）
+【参数】            const std::vector<Coord3D>& Points：点集（非空）
+                   const Coord3D& From：指定点
+                   double& DistanceSquared：最远距离的平方
+【返回值】          size_t，最远点下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t BoundingVolume3D::Farthest(const std::vector<Coord3D>& Points,
+    const Coord3D& From, double& DistanceSquared){
+    using Candidate = std::pair<double, size_t>;
+    Candidate Best = Parallel::Reduce(0, Points.size(), Candidate{-1.0, 0},
+        [&](size_t First, size_t Last){
+            Candidate Partial{-1.0, First};
+            for (size_t i = First; i < Last; i++) {
+                Coord3D D = Geometry3D::Sub(Points[i], From);
+                double Squared = Geometry3D::Dot(D, D);
+                if (Squared > Partial.first) {
+                    Partial = Candidate{Squared, i};
+                }
+            }
+            return Partial;
+        },
+        [](const Candidate& Lhs, const Candidate& Rhs){
+            return Rhs.first > Lhs.first ? Rhs : Lhs;});
+    DistanceSquared = Best.first;
+    return Best.second;
+}
@@ -0,0 +1,101 @@
+/*************************************************************************
+【文件名】                 BoundingVolume3D.hpp
+【功能模块和目的】          有向包围盒与包围球计算类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef BOUNDINGVOLUME3D_HPP
+#define BOUNDINGVOLUME3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+
+/*************************************************************************
+【类名】             OrientedBox3D
+【功能】             有向包围盒
+【接口说明】         数据类：中心、三条单位正交轴（右手系）与各轴半长；
+                    盒内点为Center + Σ t_k·Axes[k]，|t_k| ≤ HalfExtents[k]
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class OrientedBox3D{
+public:
+    //中心
+    Coord3D Center;
+    //三条单位正交轴
+    std::array<Coord3D, 3> Axes;
+    //各轴半长
+    Coord3D HalfExtents;
+    //体积
+    double Volume;
+};
+
+/*************************************************************************
+【类名】             BoundingSphere3D
+【功能】             包围球
+【接口说明】         数据类：球心与半径
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class BoundingSphere3D{
+public:
+    //球心
+    Coord3D Center;
+    //半径
+    double Radius;
+};
+
+/*************************************************************************
+【类名】             BoundingVolume3D
+【功能】             点集的有向包围盒与近似最小包围球计算
+【接口说明】         只含静态函数；
+                    有向包围盒：以协方差矩阵主轴（PCA）为初值，
+                    再依次固定一条轴，求其余两轴平面上投影点的二维凸包，
+                    旋转卡壳得到最小面积外接矩形，取体积最小者，
+                    直到不再变小；
+                    包围球：Ritter初始球，再反复把最远点纳入球内，
+                    直到全部点在球内；
+                    各轮投影、求极值与最远点均并行
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class BoundingVolume3D{
+public:
+    //工具类，无需实例
+    BoundingVolume3D() = delete;
+
+    //有向包围盒，点集为空时为原点处的零盒
+    static OrientedBox3D OrientedBox(const std::vector<Coord3D>& Points);
+    //近似最小包围球，点集为空时为原点处半径0的球
+    static BoundingSphere3D BoundingSphere(
+        const std::vector<Coord3D>& Points);
+
+    //静态常量：有向包围盒凸包细化的最多轮数
+    static constexpr size_t MAX_REFINE_ROUND{4};
+
+private:
+    //按指定轴并行求包围盒（轴须单位正交）
+    static OrientedBox3D FitBox(const std::vector<Coord3D>& Points,
+        const std::array<Coord3D, 3>& Axes);
+    //对称3×3矩阵特征向量（Jacobi旋转），按列存于Vectors
+    static void SymmetricEigen(std::array<Coord3D, 3> Matrix,
+        std::array<Coord3D, 3>& Vectors);
+    //二维点集凸包（单调链，逆时针，去除共线点）
+    static std::vector<std::array<double, 2>> ConvexHull2D(
+        std::vector<std::array<double, 2>>& Points);
+    //凸多边形最小面积外接矩形的边方向（旋转卡壳），返回单位方向
+    static std::array<double, 2> MinAreaRectangle(
+        const std::vector<std::array<double, 2>>& Hull);
+    //距指定点最远的点的下标与距离平方
+    static size_t Farthest(const std::vector<Coord3D>& Points,
+        const Coord3D& From, double& DistanceSquared);
+};
+
+#endif //BOUNDINGVOLUME3D_HPP
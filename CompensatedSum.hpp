@@ -0,0 +1,110 @@
+/*************************************************************************
+【文件名】                 CompensatedSum.hpp
+【功能模块和目的】          补偿求和（Neumaier算法）类声明与实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef COMPENSATEDSUM_HPP
+#define COMPENSATEDSUM_HPP
+
+//std::abs所属头文件
+#include <cmath>
+
+/*************************************************************************
+【类名】             CompensatedSum
+【功能】             补偿求和累加器，累计误差与项数无关
+【接口说明】         Neumaier改进的Kahan求和：另存每次加法的舍入误差，
+                    取值时补回；两个累加器可合并，供并行归约按块合并
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class CompensatedSum{
+public:
+    //默认构造函数，和为0
+    CompensatedSum() = default;
+    //带参构造函数，初值为Value
+    explicit CompensatedSum(double Value);
+    //拷贝构造函数
+    CompensatedSum(const CompensatedSum& Source) = default;
+    //虚析构函数
+    virtual ~CompensatedSum() = default;
+    //赋值运算符
+    CompensatedSum& operator=(const CompensatedSum& Source) = default;
+
+    //Setter
+    //累加一个数
+    CompensatedSum& operator+=(double Value);
+    //合并另一个累加器
+    CompensatedSum& operator+=(const CompensatedSum& Other);
+
+    //Getter
+    //补偿后的和
+    double Value() const;
+
+private:
+    //未补偿的和
+    double m_rSum{0.0};
+    //累计舍入误差
+    double m_rCompensation{0.0};
+};
+
+/*************************************************************************
+【函数名称】        CompensatedSum
+【函数功能】        带参构造函数
+【参数】            double Value：初值
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline CompensatedSum::CompensatedSum(double Value) : m_rSum(Value){
+}
+
+/*************************************************************************
+【函数名称】        operator+=
+【函数功能】        累加一个数，大数吃小数时丢失的低位记入误差项
+【参数】            double Value：加数
+【返回值】          CompensatedSum&，自身引用
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline CompensatedSum& CompensatedSum::operator+=(double Value){
+    double Sum = m_rSum + Value;
+    if (std::abs(m_rSum) >= std::abs(Value)) {
+        m_rCompensation += (m_rSum - Sum) + Value;
+    }
+    else {
+        m_rCompensation += (Value - Sum) + m_rSum;
+    }
+    m_rSum = Sum;
+    return *this;
+}
+
+/*************************************************************************
+【函数名称】        operator+=
+【函数功能】        合并另一个累加器（和与误差分别累加）
+【参数】            const CompensatedSum& Other：另一个累加器
+【返回值】          CompensatedSum&，自身引用
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline CompensatedSum& CompensatedSum::operator+=(
+    const CompensatedSum& Other){
+    *this += Other.m_rSum;
+    m_rCompensation += Other.m_rCompensation;
+    return *this;
+}
+
+/*************************************************************************
+【函数名称】        Value
+【函数功能】        获取补偿后的和
+【参数】            无
+【返回值】          double，和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline double CompensatedSum::Value() const{
+    return m_rSum + m_rCompensation;
+}
+
+#endif //COMPENSATEDSUM_HPP
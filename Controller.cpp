@@ -3,6 +3,29 @@
 【功能模块和目的】          控制器类实现
 【开发者及日期】            梁思奇 2024/8/8
 【更改记录】               梁思奇 2024/8/10 改进功能函数实现方式
+                          梁思奇 2026/10/18 按标签删除改为O(1)，增加批量删除
+                          梁思奇 2026/10/18 改点经由模型接口，增加射线查询
+                          梁思奇 2026/10/18 增加射线查询性能测试
+                          梁思奇 2026/10/18 增加顶点近邻、半径与计数查询
+                          梁思奇 2026/10/18 增加包围盒与球区域元素选择
+                          梁思奇 2026/10/18 增加顶点焊接与导入焊接选项
+                          梁思奇 2026/10/18 增加拓扑统计与相邻面查询
+                          梁思奇 2026/10/18 增加连通分量拆分与小碎块删除
+                          梁思奇 2026/10/18 增加网格校验报告
+                          梁思奇 2026/10/18 模型信息增加体积、质心与惯性张量
+                          梁思奇 2026/10/18 增加有向包围盒与包围球查询
+                          梁思奇 2026/10/18 增加凸包模型生成
+                          梁思奇 2026/10/18 增加面积、长度内核性能测试
+                          梁思奇 2026/10/18 增加面积、长度总和漂移校验
+                          梁思奇 2026/10/18 增加QEM网格简化
+                          梁思奇 2026/10/18 增加多细节层次链的后台生成与缓存
+                          梁思奇 2026/10/18 增加水平平面切片轮廓生成
+                          梁思奇 2026/10/18 增加表面与实体体素化
+                          梁思奇 2026/10/18 增加模型间碰撞与重叠面查询
+                          梁思奇 2026/10/18 增加模型间表面距离比较
+                          梁思奇 2026/10/18 增加模型结构差异与补丁应用
+                          梁思奇 2026/10/18 增加模型平移、旋转、缩放与仿射变换
+                          梁思奇 2026/10/18 增加共享顶点移动
 *************************************************************************/
 
 //自身类头文件
@@ -25,6 +48,22 @@
 #include <memory>
 //std::string所属头文件
 #include <string>
+//std::mt19937、std::uniform_real_distribution所属头文件
+#include <random>
+//std::chrono::steady_clock所属头文件
+#include <chrono>
+//std::sqrt、std::abs所属头文件
+#include <cmath>
+//std::move所属头文件
+#include <utility>
+//std::max所属头文件
+#include <algorithm>
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//MeasureKernel3D类所属头文件
+#include "MeasureKernel3D.hpp"
+//std::numeric_limits所属头文件
+#include <limits>
 
 //控制器本身类操作函数实现
 
@@ -72,7 +111,12 @@ const std::string Controller::RESNAME[] {
     "REPEAT_POINT",
     "TAG_OUT_OF_RANGE",
     "FAIL_TO_IMPORT",
-    "FAIL_TO_EXPORT"
+    "FAIL_TO_EXPORT",
+    "DEGENERATE_MODEL",
+    "MODEL_TOO_LARGE",
+    "PATCH_MISMATCH",
+    "INVALID_TRANSFORM",
+    "VERTEX_NOT_FOUND"
 };
 
 /*************************************************************************
@@ -80,12 +124,17 @@ const std::string Controller::RESNAME[] {
 【函数功能】          导入指定文件到指定模型
 【参数】              const std::string& FileName：文件名
                      size_t ModelTag：模型标记
+                     double WeldTolerance：焊接容差，大于0时导入后
+                     焊接相距不超过容差的顶点
+                     bool WithLOD：是否一并读入同目录下保存的多细节层次
+                     （任一层读入失败则都不采用）
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 增加导入后焊接顶点选项
+                    梁思奇 2026/10/18 增加读入多细节层次选项
 *************************************************************************/
-Controller::RES Controller::ImportModel
-(const std::string& FileName, size_t ModelTag){
+Controller::RES Controller::ImportModel(const std::string& FileName, 
+    size_t ModelTag, double WeldTolerance, bool WithLOD){
     if (ModelTag >= m_Models.size()) {
         //标签越界错误
         return RES::TAG_OUT_OF_RANGE;
@@ -101,6 +150,36 @@ Controller::RES Controller::ImportModel
     catch (const Importer3D::FAIL_TO_IMPORT& e) {
         return RES::FAIL_TO_IMPORT;
     }
+    //按需焊接顶点
+    if (WeldTolerance > 0.0) {
+        size_t RemovedFaceNum = 0;
+        size_t RemovedLineNum = 0;
+        m_Models[ModelTag]->WeldVertices(
+            WeldTolerance, RemovedFaceNum, RemovedLineNum);
+    }
+    //按需读入保存的多细节层次，视为与导入后的模型一致
+    if (WithLOD) {
+        std::vector<std::shared_ptr<const Model3D>> Levels;
+        try {
+            for (size_t Level = 1; Level < ModelLOD3D::LEVEL_NUM; Level++) {
+                std::string LODName = LODFileName(FileName, Level);
+                Levels.push_back(std::make_shared<Model3D>(
+                    Importer3D::GetImporter(LODName)
+                    ->ImportFromFile(LODName)));
+            }
+        }
+        catch (const Importer3D::FAIL_TO_IMPORT& e) {
+            Levels.clear();
+        }
+        if (!Levels.empty()) {
+            std::shared_ptr<ModelLOD3D>& LOD 
+                = m_LODs[m_Models[ModelTag].get()];
+            if (LOD == nullptr) {
+                LOD = std::make_shared<ModelLOD3D>();
+            }
+            LOD->Adopt(*m_Models[ModelTag], std::move(Levels));
+        }
+    }
     //若没有遇到异常错误，则返回“成功”
     return RES::SUCCESS;
 }
@@ -110,12 +189,15 @@ Controller::RES Controller::ImportModel
 【函数功能】          导出指定模型到指定文件
 【参数】              const std::string& FileName：文件名
                      size_t ModelTag：模型标记
+                     bool WithLOD：是否在同目录下一并保存多细节层次
+                     （第K层保存为扩展名前加“_lodK”的文件）
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 增加保存多细节层次选项，层次链
+                    过期或未生成时先生成
 *************************************************************************/
-Controller::RES Controller::ExportModel
-(const std::string& FileName, size_t ModelTag){
+Controller::RES Controller::ExportModel(const std::string& FileName, 
+    size_t ModelTag, bool WithLOD){
     if (ModelTag >= m_Models.size()) {
         //标签越界错误
         return RES::TAG_OUT_OF_RANGE;
@@ -126,6 +208,18 @@ Controller::RES Controller::ExportModel
             = Exporter3D::GetExporter(FileName);
         //导出模型到文件
         ExporterPtr->ExportToFile(FileName, (*m_Models[ModelTag]));
+        //按需保存多细节层次
+        if (WithLOD) {
+            ModelLOD3D& LOD = StartLOD(ModelTag);
+            for (size_t Level = 1; Level < ModelLOD3D::LEVEL_NUM; Level++) {
+                std::shared_ptr<const Model3D> LODModel 
+                    = LOD.GetLevel(Level);
+                if (LODModel != nullptr) {
+                    ExporterPtr->ExportToFile(
+                        LODFileName(FileName, Level), *LODModel);
+                }
+            }
+        }
     }
     //文件导出失败
     catch (const Exporter3D::FAIL_TO_EXPORT& e) {
@@ -177,13 +271,15 @@ Controller::RES Controller::ChooseModel(size_t ModelTag){
 【参数】              size_t ModelTag：模型标记
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 同时丢弃模型的多细节层次链
 *************************************************************************/
 Controller::RES Controller::DeleteModel(size_t ModelTag){
     if (ModelTag >= m_Models.size()) {
         //标签越界错误
         return RES::TAG_OUT_OF_RANGE;
     }
+    //丢弃多细节层次链（后台仍在生成时等待其结束）
+    m_LODs.erase(m_Models[ModelTag].get());
     //删除模型
     m_Models.erase(m_Models.begin() + ModelTag);
     //若无模型，更新标签为无模型
@@ -223,7 +319,8 @@ Controller::RES Controller::ModelAddFace(const Face3D& AFace){
 【参数】              size_t FaceTag：面标记
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 改为按标签交换-弹出删除，O(1)，
+                    原最后一个面接替被删标签
 *************************************************************************/
 Controller::RES Controller::ModelDeleteFace(size_t FaceTag){
     if (FaceTag >= m_Models[m_ChosenModelTag]->FaceNum) {
@@ -231,8 +328,257 @@ Controller::RES Controller::ModelDeleteFace(size_t FaceTag){
         return RES::TAG_OUT_OF_RANGE;
     }
     //删除指定面
-    Face3D TempFace = *(m_Models[m_ChosenModelTag]->Faces[FaceTag]);
-    m_Models[m_ChosenModelTag]->DeleteFace(TempFace);
+    m_Models[m_ChosenModelTag]->DeleteFaceByTag(FaceTag);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelDeleteFaces
+【函数功能】          批量删除当前模型的指定面，幸存面保持原相对顺序
+【参数】              const std::vector<size_t>& FaceTags：面标记集合
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     任一标签越界则不删除任何面
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelDeleteFaces(
+    const std::vector<size_t>& FaceTags){
+    for (auto Tag : FaceTags) {
+        if (Tag >= m_Models[m_ChosenModelTag]->FaceNum) {
+            //标签越界错误
+            return RES::TAG_OUT_OF_RANGE;
+        }
+    }
+    //批量删除指定面
+    m_Models[m_ChosenModelTag]->DeleteFacesByTags(FaceTags);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelWeldVertices
+【函数功能】          按容差焊接当前模型的顶点，塌缩或重复的面、线被删除
+【参数】              double Tolerance：焊接容差
+                     Info_Weld& Info：焊接信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelWeldVertices(
+    double Tolerance, Info_Weld& Info){
+    Info.WeldedPointNumber = m_Models[m_ChosenModelTag]->WeldVertices(
+        Tolerance, Info.RemovedFaceNumber, Info.RemovedLineNumber);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          SplitModelComponents
+【函数功能】          把当前模型按连通分量拆分为新模型，依次加入模型列表
+                     末尾（标签为原模型数起），原模型保留，当前模型不变
+【参数】              size_t& ComponentNum：连通分量数（即新增模型数）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::SplitModelComponents(size_t& ComponentNum){
+    std::vector<std::shared_ptr<Model3D>> Components 
+        = m_Models[m_ChosenModelTag]->SplitComponents();
+    ComponentNum = Components.size();
+    //添加新模型到模型类列表
+    m_Models.insert(m_Models.end(), Components.begin(), Components.end());
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelRemoveSmallComponents
+【函数功能】          删除当前模型中面数少于MinFaceNum或面积小于MinArea的
+                     连通分量
+【参数】              size_t MinFaceNum：分量最少面数，0表示不限
+                     double MinArea：分量最小面积，不大于0表示不限
+                     Info_RemoveComponents& Info：删除信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelRemoveSmallComponents(
+    size_t MinFaceNum, double MinArea, Info_RemoveComponents& Info){
+    Info.RemovedComponentNumber 
+        = m_Models[m_ChosenModelTag]->RemoveSmallComponents(MinFaceNum,
+        MinArea, Info.RemovedFaceNumber, Info.RemovedLineNumber);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelConvexHull
+【函数功能】          计算当前模型的凸包，作为新模型加入模型列表末尾，
+                     当前模型不变
+【参数】              size_t& HullModelTag：凸包模型标记
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     顶点全部共面返回RES::DEGENERATE_MODEL
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelConvexHull(size_t& HullModelTag){
+    std::shared_ptr<Model3D> Hull = m_Models[m_ChosenModelTag]->ConvexHull();
+    if (Hull == nullptr) {
+        //顶点全部共面，无三维凸包
+        return RES::DEGENERATE_MODEL;
+    }
+    //添加新模型到模型类列表
+    m_Models.push_back(Hull);
+    HullModelTag = m_Models.size() - 1;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelDecimate
+【函数功能】          以QEM边塌缩简化当前模型，作为新模型加入模型列表末尾，
+                     当前模型不变
+【参数】              size_t TargetFaceNum：目标面数
+                     double MaxError：单次塌缩允许的最大误差（距离平方和），
+                     不大于0表示不限
+                     size_t& NewModelTag：简化模型标记
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     规模超出简化器范围返回RES::MODEL_TOO_LARGE
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelDecimate(size_t TargetFaceNum,
+    double MaxError, size_t& NewModelTag){
+    if (MaxError <= 0.0) {
+        MaxError = std::numeric_limits<double>::infinity();
+    }
+    std::shared_ptr<Model3D> Simplified 
+        = m_Models[m_ChosenModelTag]->Decimate(TargetFaceNum, MaxError);
+    if (Simplified == nullptr) {
+        return RES::MODEL_TOO_LARGE;
+    }
+    //添加新模型到模型类列表
+    m_Models.push_back(Simplified);
+    NewModelTag = m_Models.size() - 1;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          BuildModelLOD
+【函数功能】          在后台线程生成当前模型的多细节层次链（各层面数比例见
+                     ModelLOD3D::LEVEL_RATIOS），立即返回；层次链已由
+                     当前几何生成或正在生成时不重复生成
+【参数】              无
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::BuildModelLOD(){
+    StartLOD(m_ChosenModelTag);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelSlice
+【函数功能】          用一组等距水平平面切割当前模型，各层轮廓的每一段
+                     作为一条Line3D（闭合轮廓含末点到首点的一段），组成
+                     新模型（命名为“原名_slices”）加入模型列表末尾，
+                     当前模型不变
+【参数】              double FirstHeight：第一层高度
+                     double LayerSpacing：层间距
+                     size_t LayerNum：层数
+                     size_t& SliceModelTag：切片模型标记
+                     Info_Slice& Info：切片信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelSlice(double FirstHeight,
+    double LayerSpacing, size_t LayerNum, size_t& SliceModelTag,
+    Info_Slice& Info){
+    const Model3D& Model = *m_Models[m_ChosenModelTag];
+    std::vector<double> Heights(LayerNum);
+    for (size_t k = 0; k < LayerNum; k++) {
+        Heights[k] = FirstHeight + static_cast<double>(k) * LayerSpacing;
+    }
+    //网格索引在计时前准备好
+    Model.GetMeshIndex();
+    std::vector<SliceLayer3D> Layers;
+    auto Start = std::chrono::steady_clock::now();
+    Model.Slice(Heights, Layers);
+    Info.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    //各层轮廓展开为线段
+    Info.LayerNumber = LayerNum;
+    Info.ClosedContourNumber = 0;
+    Info.OpenContourNumber = 0;
+    std::vector<Segment3D> Segments;
+    for (const SliceLayer3D& Layer : Layers) {
+        for (const SliceContour3D& Contour : Layer.Contours) {
+            const std::vector<Coord3D>& Points = Contour.Points;
+            for (size_t i = 0; i + 1 < Points.size(); i++) {
+                Segments.push_back({{Points[i], Points[i + 1]}});
+            }
+            if (Contour.IsClosed) {
+                Segments.push_back({{Points.back(), Points.front()}});
+                Info.ClosedContourNumber++;
+            }
+            else {
+                Info.OpenContourNumber++;
+            }
+        }
+    }
+    Info.SegmentNumber = Segments.size();
+    //添加新模型到模型类列表
+    m_Models.push_back(Model3D::FromMesh(Model.Name + "_slices", {}, {},
+        Segments));
+    SliceModelTag = m_Models.size() - 1;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelVoxelize
+【函数功能】          体素化当前模型的面（表面体素，需要时填充内部），
+                     统计占据体素数、块存储与吞吐量
+【参数】              double VoxelSize：体素边长
+                     bool IsSolid：是否填充内部
+                     std::shared_ptr<const VoxelGrid3D>& Grid：体素网格
+                     Info_Voxelize& Info：体素化信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     模型无面返回RES::DEGENERATE_MODEL，
+                     边长不为正或单轴体素数超限返回RES::MODEL_TOO_LARGE
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelVoxelize(double VoxelSize, bool IsSolid,
+    std::shared_ptr<const VoxelGrid3D>& Grid, Info_Voxelize& Info){
+    const Model3D& Model = *m_Models[m_ChosenModelTag];
+    if (Model.FaceNum == 0) {
+        return RES::DEGENERATE_MODEL;
+    }
+    std::shared_ptr<VoxelGrid3D> Result = std::make_shared<VoxelGrid3D>();
+    auto Start = std::chrono::steady_clock::now();
+    bool IsBuilt = Model.Voxelize(VoxelSize, IsSolid, *Result);
+    Info.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    if (!IsBuilt) {
+        return RES::MODEL_TOO_LARGE;
+    }
+    double GridVoxelNum = 1.0;
+    for (size_t a = 0; a < 3; a++) {
+        Info.Resolution[a] = Result->Resolution()[a];
+        GridVoxelNum *= static_cast<double>(Info.Resolution[a]);
+    }
+    Info.VoxelNumber = Result->VoxelNum();
+    Info.BlockNumber = Result->BlockNum();
+    Info.MemoryBytes = Result->MemoryBytes();
+    Info.VoxelsPerSecond = Info.Seconds > 0.0 ?
+        GridVoxelNum / Info.Seconds : 0.0;
+    Grid = Result;
     //若没有遇到异常错误，则返回“成功”
     return RES::SUCCESS;
 }
@@ -262,7 +608,8 @@ Controller::RES Controller::ModelAddLine(const Line3D& ALine){
 【参数】              size_t LineTag：线标记
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 改为按标签交换-弹出删除，O(1)，
+                    原最后一条线接替被删标签
 *************************************************************************/
 Controller::RES Controller::ModelDeleteLine(size_t LineTag){
     if (LineTag >= m_Models[m_ChosenModelTag]->LineNum) {
@@ -270,8 +617,30 @@ Controller::RES Controller::ModelDeleteLine(size_t LineTag){
         return RES::TAG_OUT_OF_RANGE;
     }
     //删除指定线
-    Line3D TempLine = *(m_Models[m_ChosenModelTag]->Lines[LineTag]);
-    m_Models[m_ChosenModelTag]->DeleteLine(TempLine);
+    m_Models[m_ChosenModelTag]->DeleteLineByTag(LineTag);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelDeleteLines
+【函数功能】          批量删除当前模型的指定线，幸存线保持原相对顺序
+【参数】              const std::vector<size_t>& LineTags：线标记集合
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     任一标签越界则不删除任何线
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelDeleteLines(
+    const std::vector<size_t>& LineTags){
+    for (auto Tag : LineTags) {
+        if (Tag >= m_Models[m_ChosenModelTag]->LineNum) {
+            //标签越界错误
+            return RES::TAG_OUT_OF_RANGE;
+        }
+    }
+    //批量删除指定线
+    m_Models[m_ChosenModelTag]->DeleteLinesByTags(LineTags);
     //若没有遇到异常错误，则返回“成功”
     return RES::SUCCESS;
 }
@@ -284,7 +653,7 @@ Controller::RES Controller::ModelDeleteLine(size_t LineTag){
                      const Point3D& Point1：点对象
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】          梁思奇 2026/10/18 改为调用Model3D::ChangeFacePoint
 *************************************************************************/
 Controller::RES Controller::ModelChangeFacePoint
 (size_t FaceTag, size_t PointTag, const Point3D& Point1){
@@ -296,14 +665,9 @@ Controller::RES Controller::ModelChangeFacePoint
         //标签越界错误
         return RES::TAG_OUT_OF_RANGE;
     }
-    //修改点
-    try {
-        //这里按从第2行开始均缩进4格的规范
-        m_Models[m_ChosenModelTag]->Faces[FaceTag]->ChangePoint(
-            m_Models[m_ChosenModelTag]->Faces[FaceTag]->Points[PointTag],
-            Point1);
-    }
-    catch (Point3DGroup::REPEAT_ELEMENT) {
+    //修改点（经由模型接口，同步更新面积、包围长方体与BVH）
+    if (!m_Models[m_ChosenModelTag]->ChangeFacePoint(
+        FaceTag, PointTag, Point1)) {
         //重复点错误
         return RES::REPEAT_POINT;
     }
@@ -319,7 +683,7 @@ Controller::RES Controller::ModelChangeFacePoint
                      const Point3D& Point1：点对象
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】          梁思奇 2026/10/18 改为调用Model3D::ChangeLinePoint
 *************************************************************************/
 Controller::RES Controller::ModelChangeLinePoint
 (size_t LineTag, size_t PointTag, const Point3D& Point1){
@@ -331,14 +695,9 @@ Controller::RES Controller::ModelChangeLinePoint
         //标签越界错误
         return RES::TAG_OUT_OF_RANGE;
     }
-    //修改
-    try {
-        //这里按从第2行开始均缩进4格的规范
-        m_Models[m_ChosenModelTag]->Lines[LineTag]->ChangePoint(
-            m_Models[m_ChosenModelTag]->Lines[LineTag]->Points[PointTag], 
-            Point1);
-    }
-    catch (Point3DGroup::REPEAT_ELEMENT) {
+    //修改（经由模型接口，同步更新线长与包围长方体）
+    if (!m_Models[m_ChosenModelTag]->ChangeLinePoint(
+        LineTag, PointTag, Point1)) {
         //重复点错误
         return RES::REPEAT_POINT;
     }
@@ -350,7 +709,8 @@ Controller::RES Controller::ModelChangeLinePoint
 
 /*************************************************************************
 【函数名称】          ShowAllModels
-【函数功能】          列出所有模型信息
+【函数功能】          列出所有模型信息（不含质量属性，质量属性需遍历全部
+                     面计算，由ShowModle按需给出，列表保持廉价）
 【参数】              List_Model3DInfo& InfoList：信息列表（会被清空列表重写）
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
@@ -388,7 +748,7 @@ Controller::RES Controller::ShowAllModels(List_Model3DInfo& InfoList){
                      Info_Model3D& Info：信息列表
 【返回值】            RES：执行结果，成功返回RES::SUCCESS
 【开发者及日期】      梁思奇 2024/8/8
-【更改记录】         
+【更改记录】         梁思奇 2026/10/18 增加质量属性
 *************************************************************************/
 Controller::RES Controller::ShowModle(size_t ModelTag, Info_Model3D& Info){
     if (ModelTag >= m_Models.size()) {
@@ -413,6 +773,8 @@ Controller::RES Controller::ShowModle(size_t ModelTag, Info_Model3D& Info){
         //包围盒体积
         m_Models[ModelTag]->EncaseCuboid_Volume
     };
+    //质量属性
+    FillMassInfo(*m_Models[ModelTag], Info);
     //若没有遇到异常错误，则返回“成功”
     return RES::SUCCESS;
 }
@@ -547,3 +909,941 @@ Controller::RES Controller::ShowModelLineAllPoints(
     //若没有遇到异常错误，则返回“成功”
     return RES::SUCCESS;
 }
+
+/*************************************************************************
+【函数名称】          ModelRayCast
+【函数功能】          求射线与当前模型所有面的最近交点
+【参数】              const Point3D& Origin：射线起点
+                     const Point3D& Direction：射线方向（无需单位化）
+                     Info_RayHit& Info：命中信息（未命中时IsHit为false）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelRayCast(
+    const Point3D& Origin, const Point3D& Direction, Info_RayHit& Info){
+    RayHit3D Hit;
+    Info.IsHit = m_Models[m_ChosenModelTag]->RayCast(Origin, Direction, Hit);
+    Info.FaceTag = Info.IsHit ? Hit.FaceTag : NO_TAG_NUMBER;
+    Info.Distance = Info.IsHit ? Hit.T : 0.0;
+    //交点 = 起点 + 距离 × 单位方向
+    Point3D HitPoint{Origin};
+    if (Info.IsHit) {
+        HitPoint = Point3D{
+            Origin + Direction * (Hit.T / Direction.Length())};
+    }
+    Info.Point = Info_Point3D{
+        HitPoint.GetX(), HitPoint.GetY(), HitPoint.GetZ()};
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelRayOccluded
+【函数功能】          判断射线在指定距离内是否被当前模型的面遮挡
+【参数】              const Point3D& Origin：射线起点
+                     const Point3D& Direction：射线方向（无需单位化）
+                     double MaxDistance：最大距离
+                     bool& IsOccluded：是否被遮挡
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelRayOccluded(const Point3D& Origin, 
+    const Point3D& Direction, double MaxDistance, bool& IsOccluded){
+    IsOccluded = m_Models[m_ChosenModelTag]->RayOccluded(
+        Origin, Direction, MaxDistance);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          BenchmarkRayCast
+【函数功能】          当前模型射线查询性能测试：从包围长方体外接球面上的
+                     16个视点向长方体内随机目标点发射射线（可视性扫描），
+                     分别以逐条单线程与批量射线包全部线程方式查询并计时，
+                     同时核对两种方式结果（BVH构建不计入时间）
+【参数】              size_t RayNum：射线数
+                     Info_RayBenchmark& Info：测试结果
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::BenchmarkRayCast(
+    size_t RayNum, Info_RayBenchmark& Info){
+    const Model3D& TempModel = *m_Models[m_ChosenModelTag];
+    //视点数
+    const size_t VIEW_NUM = 16;
+    //包围长方体中心与外接球半径
+    Coord3D Center;
+    double Radius = 0.0;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        Center[Axis] = (TempModel.EncaseCuboid_Min[Axis] 
+            + TempModel.EncaseCuboid_Max[Axis]) * 0.5;
+        double Half = (TempModel.EncaseCuboid_Max[Axis] 
+            - TempModel.EncaseCuboid_Min[Axis]) * 0.5;
+        Radius += Half * Half;
+    }
+    Radius = Radius > 0.0 ? 2.0 * std::sqrt(Radius) : 1.0;
+    //生成射线（固定种子，结果可复现）
+    std::mt19937 Engine{2026};
+    std::uniform_real_distribution<double> Unit{0.0, 1.0};
+    std::vector<Coord3D> Origins(RayNum);
+    std::vector<Coord3D> Directions(RayNum);
+    size_t PerView = (RayNum + VIEW_NUM - 1) / VIEW_NUM;
+    Coord3D ViewPoint{0.0, 0.0, 0.0};
+    for (size_t i = 0; i < RayNum; i++) {
+        if (i % PerView == 0) {
+            //球面均匀取视点
+            double Z = 2.0 * Unit(Engine) - 1.0;
+            double Phi = 2.0 * 3.14159265358979323846 * Unit(Engine);
+            double R = std::sqrt(1.0 - Z * Z);
+            ViewPoint = Coord3D{Center[0] + Radius * R * std::cos(Phi),
+                Center[1] + Radius * R * std::sin(Phi),
+                Center[2] + Radius * Z};
+        }
+        Coord3D Target;
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Target[Axis] = TempModel.EncaseCuboid_Min[Axis] + Unit(Engine)
+                * (TempModel.EncaseCuboid_Max[Axis] 
+                - TempModel.EncaseCuboid_Min[Axis]);
+        }
+        Origins[i] = ViewPoint;
+        Directions[i] = Geometry3D::Sub(Target, ViewPoint);
+    }
+    //预先构建BVH，不计入时间
+    RayHit3D Hit;
+    TempModel.RayCast(Point3D{0.0, 0.0, 0.0}, Point3D{1.0, 0.0, 0.0}, Hit);
+    //逐条查询
+    std::vector<RayHit3D> SingleHits(RayNum);
+    auto Start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < RayNum; i++) {
+        TempModel.RayCast(Point3D{Origins[i][0], Origins[i][1], Origins[i][2]},
+            Point3D{Directions[i][0], Directions[i][1], Directions[i][2]},
+            SingleHits[i]);
+    }
+    double SingleSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    //批量查询
+    std::vector<RayHit3D> BatchHits;
+    Start = std::chrono::steady_clock::now();
+    TempModel.RayCastBatch(Origins, Directions, BatchHits);
+    double BatchSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    //统计并核对（距离相同的不同面视为一致）
+    Info = Info_RayBenchmark{RayNum, 0, Parallel::ThreadCount(), 0.0, 0.0, 0};
+    for (size_t i = 0; i < RayNum; i++) {
+        bool IsSingleHit = SingleHits[i].FaceTag != RayHit3D::NO_HIT;
+        bool IsBatchHit = BatchHits[i].FaceTag != RayHit3D::NO_HIT;
+        if (IsSingleHit) {
+            Info.HitNumber++;
+        }
+        if (IsSingleHit != IsBatchHit || (IsSingleHit 
+            && SingleHits[i].FaceTag != BatchHits[i].FaceTag
+            && std::abs(SingleHits[i].T - BatchHits[i].T) > 1e-9)) {
+            Info.MismatchNumber++;
+        }
+    }
+    Info.SingleRaysPerSecond 
+        = SingleSeconds > 0.0 ? RayNum / SingleSeconds : 0.0;
+    Info.BatchRaysPerSecond 
+        = BatchSeconds > 0.0 ? RayNum / BatchSeconds : 0.0;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          BenchmarkMeasureKernels
+【函数功能】          当前模型面积、长度计算性能测试：以原有海伦公式
+                     （三次求边长，含临时向量）为基准，与逐对象调用虚函数
+                     GetArea/GetLength、坐标预先按分量排列后
+                     的标量内核、SIMD内核，以及模型批量查询（收集坐标+
+                     SIMD内核，并行）分别重复计时，折算为每元素耗时，
+                     并核对SIMD结果，逐对象结果与海伦公式的误差单独给出
+                     （坐标打包不计入时间）
+【参数】              size_t RoundNum：重复轮数（为0时按1轮）
+                     Info_MeasureBenchmark& Info：测试结果
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 GetArea已改用叉积公式，
+                    增加海伦公式基准与其误差
+*************************************************************************/
+Controller::RES Controller::BenchmarkMeasureKernels(
+    size_t RoundNum, Info_MeasureBenchmark& Info){
+    const Model3D& TempModel = *m_Models[m_ChosenModelTag];
+    const size_t FaceCount = TempModel.Faces.size();
+    const size_t LineCount = TempModel.Lines.size();
+    RoundNum = std::max<size_t>(RoundNum, 1);
+    //坐标按分量打包：面0~8为三顶点坐标分量，线0~5为两端点坐标分量
+    std::vector<std::vector<double>> FaceSoA(9, 
+        std::vector<double>(FaceCount));
+    std::vector<std::vector<double>> LineSoA(6, 
+        std::vector<double>(LineCount));
+    for (size_t i = 0; i < FaceCount; i++) {
+        for (size_t k = 0; k < 3; k++) {
+            std::array<double, 3> XYZ 
+                = TempModel.Faces[i]->Points[k].GetXYZ();
+            for (size_t Axis = 0; Axis < 3; Axis++) {
+                FaceSoA[3 * k + Axis][i] = XYZ[Axis];
+            }
+        }
+    }
+    for (size_t i = 0; i < LineCount; i++) {
+        for (size_t k = 0; k < 2; k++) {
+            std::array<double, 3> XYZ 
+                = TempModel.Lines[i]->Points[k].GetXYZ();
+            for (size_t Axis = 0; Axis < 3; Axis++) {
+                LineSoA[3 * k + Axis][i] = XYZ[Axis];
+            }
+        }
+    }
+    //计时工具：重复RoundNum轮，返回每元素纳秒
+    auto TimePerElement = [RoundNum](size_t Count, auto Func){
+        auto Start = std::chrono::steady_clock::now();
+        for (size_t Round = 0; Round < RoundNum; Round++) {
+            Func();
+        }
+        double Seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - Start).count();
+        return Count > 0 ? Seconds * 1e9 / (Count * RoundNum) : 0.0;
+    };
+    std::vector<double> HeronAreas(FaceCount);
+    std::vector<double> ObjectAreas(FaceCount);
+    std::vector<double> KernelAreas(FaceCount);
+    std::vector<double> BulkAreas;
+    std::vector<double> ObjectLengths(LineCount);
+    std::vector<double> KernelLengths(LineCount);
+    std::vector<double> BulkLengths;
+    const MeasureKernel3D::ISA Best = MeasureKernel3D::BestISA();
+    Info.ISAName = MeasureKernel3D::ISAName(Best);
+    Info.FaceNumber = FaceCount;
+    Info.LineNumber = LineCount;
+    Info.RoundNumber = RoundNum;
+    Info.ThreadNumber = Parallel::ThreadCount();
+    //面积：原有海伦公式基准
+    Info.FaceHeronNs = TimePerElement(FaceCount, [&](){
+        for (size_t i = 0; i < FaceCount; i++) {
+            const Face3D& TempFace = *TempModel.Faces[i];
+            //三边长
+            double a = (TempFace.Points[0] - TempFace.Points[1]).Length();
+            double b = (TempFace.Points[1] - TempFace.Points[2]).Length();
+            double c = (TempFace.Points[0] - TempFace.Points[2]).Length();
+            //海伦公式求三角形面积
+            double p = (a + b + c) * 0.5;
+            HeronAreas[i] = std::sqrt(p * (p - a) * (p - b) * (p - c));
+        }
+    });
+    Info.FaceObjectNs = TimePerElement(FaceCount, [&](){
+        for (size_t i = 0; i < FaceCount; i++) {
+            ObjectAreas[i] = TempModel.Faces[i]->GetArea();
+        }
+    });
+    auto FaceKernel = [&](MeasureKernel3D::ISA Isa){
+        MeasureKernel3D::TriangleAreas(Isa, FaceCount, FaceSoA[0].data(),
+            FaceSoA[1].data(), FaceSoA[2].data(), FaceSoA[3].data(),
+            FaceSoA[4].data(), FaceSoA[5].data(), FaceSoA[6].data(),
+            FaceSoA[7].data(), FaceSoA[8].data(), KernelAreas.data());
+    };
+    Info.FaceScalarNs = TimePerElement(FaceCount, [&](){
+        FaceKernel(MeasureKernel3D::ISA::SCALAR);
+    });
+    Info.FaceSimdNs = TimePerElement(FaceCount, [&](){
+        FaceKernel(Best);
+    });
+    Info.FaceBulkNs = TimePerElement(FaceCount, [&](){
+        TempModel.GetFaceAreas(BulkAreas);
+    });
+    //长度
+    Info.LineObjectNs = TimePerElement(LineCount, [&](){
+        for (size_t i = 0; i < LineCount; i++) {
+            ObjectLengths[i] = TempModel.Lines[i]->GetLength();
+        }
+    });
+    auto LineKernel = [&](MeasureKernel3D::ISA Isa){
+        MeasureKernel3D::SegmentLengths(Isa, LineCount, LineSoA[0].data(),
+            LineSoA[1].data(), LineSoA[2].data(), LineSoA[3].data(),
+            LineSoA[4].data(), LineSoA[5].data(), KernelLengths.data());
+    };
+    Info.LineScalarNs = TimePerElement(LineCount, [&](){
+        LineKernel(MeasureKernel3D::ISA::SCALAR);
+    });
+    Info.LineSimdNs = TimePerElement(LineCount, [&](){
+        LineKernel(Best);
+    });
+    Info.LineBulkNs = TimePerElement(LineCount, [&](){
+        TempModel.GetLineLengths(BulkLengths);
+    });
+    //核对SIMD与批量查询结果
+    auto RelativeError = [](double Value, double Reference){
+        double Scale = std::max(std::abs(Reference), 1e-300);
+        return std::abs(Value - Reference) / Scale;
+    };
+    Info.MaxRelativeError = 0.0;
+    for (size_t i = 0; i < FaceCount; i++) {
+        Info.MaxRelativeError = std::max({Info.MaxRelativeError,
+            RelativeError(KernelAreas[i], ObjectAreas[i]),
+            RelativeError(BulkAreas[i], ObjectAreas[i])});
+    }
+    for (size_t i = 0; i < LineCount; i++) {
+        Info.MaxRelativeError = std::max({Info.MaxRelativeError,
+            RelativeError(KernelLengths[i], ObjectLengths[i]),
+            RelativeError(BulkLengths[i], ObjectLengths[i])});
+    }
+    //海伦公式相对叉积公式的误差（狭长三角形上相减抵消，误差较大；
+    //根号下为负得到NaN时记为无穷大）
+    Info.HeronRelativeError = 0.0;
+    for (size_t i = 0; i < FaceCount; i++) {
+        double Error = RelativeError(HeronAreas[i], ObjectAreas[i]);
+        Info.HeronRelativeError = std::max(Info.HeronRelativeError,
+            std::isnan(Error) ? std::numeric_limits<double>::infinity()
+            : Error);
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          VerifyModelMeasures
+【函数功能】          校验当前模型增量维护的面积、长度总和：与并行全量
+                     重算（补偿求和）的结果比较，给出相对漂移
+【参数】              Info_MeasureDrift& Info：校验结果
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::VerifyModelMeasures(Info_MeasureDrift& Info){
+    MeasureDrift3D Drift;
+    m_Models[m_ChosenModelTag]->VerifyMeasureSums(Drift);
+    Info.MaintainedArea = Drift.MaintainedArea;
+    Info.RecomputedArea = Drift.RecomputedArea;
+    Info.AreaRelativeDrift = Drift.AreaRelativeDrift;
+    Info.MaintainedLength = Drift.MaintainedLength;
+    Info.RecomputedLength = Drift.RecomputedLength;
+    Info.LengthRelativeDrift = Drift.LengthRelativeDrift;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ShowModelNearestVertices
+【函数功能】          列出当前模型中距指定点最近的K个顶点（重合点只计一次）
+【参数】              const Point3D& Point1：查询点
+                     size_t K：顶点数
+                     List_Point3DInfo& InfoList：信息列表（会被清空列表重写），
+                     按距离升序
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelNearestVertices(
+    const Point3D& Point1, size_t K, List_Point3DInfo& InfoList){
+    const Model3D& TempModel = *m_Models[m_ChosenModelTag];
+    std::vector<size_t> Indices;
+    std::vector<double> Distances;
+    TempModel.GetVertexTree().KNearest(
+        Point1.GetXYZ(), K, Indices, Distances);
+    //清空列表
+    InfoList.clear();
+    //逐一生成写入
+    for (auto Index : Indices) {
+        const Coord3D& TempVertex = TempModel.GetMeshIndex().Vertices[Index];
+        InfoList.push_back(
+            Info_Point3D{TempVertex[0], TempVertex[1], TempVertex[2]});
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ShowModelVerticesInRadius
+【函数功能】          列出当前模型中距指定点不超过半径的顶点（重合点只计一次）
+【参数】              const Point3D& Point1：查询点
+                     double Radius：半径
+                     List_Point3DInfo& InfoList：信息列表（会被清空列表重写）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelVerticesInRadius(
+    const Point3D& Point1, double Radius, List_Point3DInfo& InfoList){
+    const Model3D& TempModel = *m_Models[m_ChosenModelTag];
+    std::vector<size_t> Indices;
+    TempModel.GetVertexTree().RadiusSearch(Point1.GetXYZ(), Radius, Indices);
+    //清空列表
+    InfoList.clear();
+    //逐一生成写入
+    for (auto Index : Indices) {
+        const Coord3D& TempVertex = TempModel.GetMeshIndex().Vertices[Index];
+        InfoList.push_back(
+            Info_Point3D{TempVertex[0], TempVertex[1], TempVertex[2]});
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          CountModelVerticesInBox
+【函数功能】          统计当前模型中位于指定包围盒（含边界）内的顶点数
+                     （重合点只计一次）
+【参数】              const Point3D& MinPoint：包围盒最小角点
+                     const Point3D& MaxPoint：包围盒最大角点
+                     size_t& Count：顶点数
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::CountModelVerticesInBox(
+    const Point3D& MinPoint, const Point3D& MaxPoint, size_t& Count){
+    Count = m_Models[m_ChosenModelTag]->GetVertexTree().BoxCount(
+        MinPoint.GetXYZ(), MaxPoint.GetXYZ());
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          SelectModelElementsInBox
+【函数功能】          选择当前模型中与包围盒（含边界）相交的面、线
+【参数】              const Point3D& MinPoint：包围盒最小角点
+                     const Point3D& MaxPoint：包围盒最大角点
+                     std::vector<size_t>& FaceTags：面标记（重写，升序）
+                     std::vector<size_t>& LineTags：线标记（重写，升序）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::SelectModelElementsInBox(
+    const Point3D& MinPoint, const Point3D& MaxPoint,
+    std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags){
+    m_Models[m_ChosenModelTag]->FindElementsInBox(
+        MinPoint, MaxPoint, FaceTags, LineTags);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          SelectModelElementsInSphere
+【函数功能】          选择当前模型中与球（含边界）相交的面、线
+【参数】              const Point3D& Center：球心
+                     double Radius：半径
+                     std::vector<size_t>& FaceTags：面标记（重写，升序）
+                     std::vector<size_t>& LineTags：线标记（重写，升序）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::SelectModelElementsInSphere(
+    const Point3D& Center, double Radius,
+    std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags){
+    m_Models[m_ChosenModelTag]->FindElementsInSphere(
+        Center, Radius, FaceTags, LineTags);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelCollide
+【函数功能】          当前模型与指定模型的面相交查询：两模型的面BVH同时
+                     遍历，精确判定三角形相交（接触也算相交）；
+                     只判断是否相交时找到一对即停止
+【参数】              size_t OtherModelTag：指定模型标记
+                     bool IsAnyHit：是否只判断是否相交
+                     std::vector<std::pair<size_t, size_t>>& FacePairs：
+                     相交面对（重写，按标签升序）
+                     Info_Collision& Info：相交信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     标记越界返回RES::TAG_OUT_OF_RANGE
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelCollide(size_t OtherModelTag,
+    bool IsAnyHit, std::vector<std::pair<size_t, size_t>>& FacePairs,
+    Info_Collision& Info){
+    if (OtherModelTag >= m_Models.size()) {
+        //标签越界错误
+        return RES::TAG_OUT_OF_RANGE;
+    }
+    const Model3D& Model = *m_Models[m_ChosenModelTag];
+    const Model3D& Other = *m_Models[OtherModelTag];
+    //预先构建两模型的BVH，不计入时间
+    RayHit3D Hit;
+    Model.RayCast(Point3D{0.0, 0.0, 0.0}, Point3D{1.0, 0.0, 0.0}, Hit);
+    Other.RayCast(Point3D{0.0, 0.0, 0.0}, Point3D{1.0, 0.0, 0.0}, Hit);
+    auto Start = std::chrono::steady_clock::now();
+    Info.IsIntersecting = Model.Intersects(Other, IsAnyHit, FacePairs);
+    Info.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    Info.PairNumber = FacePairs.size();
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelSurfaceDistance
+【函数功能】          当前模型与指定模型的表面距离：一个模型表面的采样点
+                     在另一模型的面BVH上并行求最近距离，得到单向
+                     Hausdorff、平均与均方根距离；双向时再反向求一次，
+                     Hausdorff取较大者，平均与均方根按采样点数合并；
+                     超过误差界而提前停止时不再求反向
+【参数】              size_t OtherModelTag：指定模型标记
+                     double SampleDensity：每单位面积的面内采样点数
+                     bool IsSymmetric：是否求双向距离
+                     Info_SurfaceDistance& Info：距离信息
+                     double ErrorBound：误差界，默认为无穷大
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     标记越界返回RES::TAG_OUT_OF_RANGE，
+                     任一模型无面返回RES::DEGENERATE_MODEL
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelSurfaceDistance(size_t OtherModelTag,
+    double SampleDensity, bool IsSymmetric, Info_SurfaceDistance& Info,
+    double ErrorBound){
+    if (OtherModelTag >= m_Models.size()) {
+        //标签越界错误
+        return RES::TAG_OUT_OF_RANGE;
+    }
+    const Model3D& Model = *m_Models[m_ChosenModelTag];
+    const Model3D& Other = *m_Models[OtherModelTag];
+    if (Model.FaceNum == 0 || Other.FaceNum == 0) {
+        //无面可比较
+        return RES::DEGENERATE_MODEL;
+    }
+    //预先构建两模型的BVH，不计入时间
+    RayHit3D Hit;
+    Model.RayCast(Point3D{0.0, 0.0, 0.0}, Point3D{1.0, 0.0, 0.0}, Hit);
+    Other.RayCast(Point3D{0.0, 0.0, 0.0}, Point3D{1.0, 0.0, 0.0}, Hit);
+    auto Start = std::chrono::steady_clock::now();
+    SurfaceDistance3D Forward;
+    SurfaceDistance3D Backward{0.0, 0.0, 0.0, {{0.0, 0.0, 0.0}}, 0, false};
+    Model.SurfaceDistanceTo(Other, SampleDensity, Forward, ErrorBound);
+    if (IsSymmetric && !Forward.IsStopped) {
+        Other.SurfaceDistanceTo(Model, SampleDensity, Backward, ErrorBound);
+    }
+    Info.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    Info.ForwardHausdorff = Forward.Hausdorff;
+    Info.BackwardHausdorff = Backward.Hausdorff;
+    Info.Hausdorff = std::max(Forward.Hausdorff, Backward.Hausdorff);
+    Info.SampleNumber = Forward.SampleNum + Backward.SampleNum;
+    Info.IsStopped = Forward.IsStopped || Backward.IsStopped;
+    Info.MeanDistance = 0.0;
+    Info.RMSDistance = 0.0;
+    if (Info.SampleNumber > 0) {
+        double Number = static_cast<double>(Info.SampleNumber);
+        Info.MeanDistance = (Forward.Mean * Forward.SampleNum
+            + Backward.Mean * Backward.SampleNum) / Number;
+        Info.RMSDistance = std::sqrt((Forward.RMS * Forward.RMS
+            * Forward.SampleNum + Backward.RMS * Backward.RMS
+            * Backward.SampleNum) / Number);
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelDiff
+【函数功能】          当前模型与修订版模型的结构差异：面、线按规范键散列
+                     配对，只差一个顶点的未配对元素记为移动
+【参数】              size_t RevisedModelTag：修订版模型标记
+                     double Tolerance：坐标取整容差，不为正时精确比较
+                     ModelPatch3D& Patch：由当前模型得到修订版的补丁（重写）
+                     Info_Diff& Info：差异信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     标记越界返回RES::TAG_OUT_OF_RANGE
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelDiff(size_t RevisedModelTag,
+    double Tolerance, ModelPatch3D& Patch, Info_Diff& Info){
+    if (RevisedModelTag >= m_Models.size()) {
+        //标签越界错误
+        return RES::TAG_OUT_OF_RANGE;
+    }
+    auto Start = std::chrono::steady_clock::now();
+    m_Models[m_ChosenModelTag]->DiffTo(*m_Models[RevisedModelTag], Patch,
+        Info.UnchangedFaceNumber, Info.UnchangedLineNumber, Tolerance);
+    Info.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    Info.MovedFaceNumber = Patch.MovedFaces.size();
+    Info.RemovedFaceNumber = Patch.RemovedFaceTags.size();
+    Info.AddedFaceNumber = Patch.AddedFaces.size();
+    Info.MovedLineNumber = Patch.MovedLines.size();
+    Info.RemovedLineNumber = Patch.RemovedLineTags.size();
+    Info.AddedLineNumber = Patch.AddedLines.size();
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelApplyPatch
+【函数功能】          把补丁应用于当前模型：移动的元素改为新坐标，删除的
+                     元素移除（幸存元素保持原相对顺序），新增的元素追加
+【参数】              const ModelPatch3D& Patch：补丁
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，补丁与当前模型
+                     不符（面数、线数不等或标签越界、重复）或移动、新增
+                     的元素点重合、与其他元素相同时返回
+                     RES::PATCH_MISMATCH，此时模型不变
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 补丁元素点重合或重复时同样不符
+*************************************************************************/
+Controller::RES Controller::ModelApplyPatch(const ModelPatch3D& Patch){
+    if (!m_Models[m_ChosenModelTag]->ApplyPatch(Patch)) {
+        //补丁不是由当前模型得到的，或会产生退化、重复元素
+        return RES::PATCH_MISMATCH;
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelTransform
+【函数功能】          对当前模型的全部点做仿射变换，面积、长度总和与最小
+                     包围长方体随之更新
+【参数】              const std::array<double, 16>& Matrix：按行存放的
+                     4×4矩阵，末行须为(0, 0, 0, 1)
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，矩阵含非有限值、
+                     末行不符或不可逆，或变换后有元素的点重合时返回
+                     RES::INVALID_TRANSFORM，此时模型不变
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelTransform(
+    const std::array<double, 16>& Matrix){
+    if (!m_Models[m_ChosenModelTag]->Transform(Matrix)) {
+        //矩阵无效
+        return RES::INVALID_TRANSFORM;
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ModelTranslate
+【函数功能】          平移当前模型
+【参数】              double DX, double DY, double DZ：各轴平移量
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，平移量含非有限值
+                     返回RES::INVALID_TRANSFORM
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelTranslate(double DX, double DY, double DZ){
+    return ModelTransform({
+        1.0, 0.0, 0.0, DX,
+        0.0, 1.0, 0.0, DY,
+        0.0, 0.0, 1.0, DZ,
+        0.0, 0.0, 0.0, 1.0});
+}
+
+/*************************************************************************
+【函数名称】          ModelRotate
+【函数功能】          当前模型绕过原点的轴旋转（Rodrigues公式构造矩阵）
+【参数】              double AxisX, double AxisY, double AxisZ：轴方向
+                     （无需单位化）
+                     double Degree：旋转角（度），沿轴方向看去逆时针为正
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，轴方向为零向量
+                     或含非有限值时返回RES::INVALID_TRANSFORM
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ModelRotate(double AxisX, double AxisY,
+    double AxisZ, double Degree){
+    double Norm = std::sqrt(AxisX * AxisX + AxisY * AxisY + AxisZ * AxisZ);
+    if (!(Norm > 0.0) || !std::isfinite(Norm)) {
+        //轴方向无效
+        return RES::INVALID_TRANSFORM;
+    }
+    double X = AxisX / Norm;
+    double Y = AxisY / Norm;
+    double Z = AxisZ / Norm;
+    double Radian = Degree * std::acos(-1.0) / 180.0;
+    double Cos = std::cos(Radian);
+    double Sin = std::sin(Radian);
+    double OneMinusCos = 1.0 - Cos;
+    return ModelTransform({
+        Cos + X * X * OneMinusCos,
+        X * Y * OneMinusCos - Z * Sin,
+        X * Z * OneMinusCos + Y * Sin,
+        0.0,
+        Y * X * OneMinusCos + Z * Sin,
+        Cos + Y * Y * OneMinusCos,
+        Y * Z * OneMinusCos - X * Sin,
+        0.0,
+        Z * X * OneMinusCos - Y * Sin,
+        Z * Y * OneMinusCos + X * Sin,
+        Cos + Z * Z * OneMinusCos,
+        0.0,
+        0.0, 0.0, 0.0, 1.0});
+}
+
+/*************************************************************************
+【函数名称】          ModelScale
+【函数功能】          以原点为中心均匀缩放当前模型（面积总和乘以Factor²，
+                     长度总和乘以|Factor|，无需逐元素重算）
+【参数】              double Factor：缩放倍数，负值同时关于原点对称（各面
+                     顶点顺序随之翻转，外法向与有向体积保持不变号）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，倍数为0或含
+                     非有限值时返回RES::INVALID_TRANSFORM
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 说明负倍数下的顶点顺序
+*************************************************************************/
+Controller::RES Controller::ModelScale(double Factor){
+    return ModelTransform({
+        Factor, 0.0, 0.0, 0.0,
+        0.0, Factor, 0.0, 0.0,
+        0.0, 0.0, Factor, 0.0,
+        0.0, 0.0, 0.0, 1.0});
+}
+
+/*************************************************************************
+【函数名称】          ModelMoveVertex
+【函数功能】          移动当前模型的一个顶点：含该点的全部面、线同时修改，
+                     耗时与该顶点的相邻元素数成正比
+【参数】              const Point3D& OldPoint：顶点原坐标
+                     const Point3D& NewPoint：顶点新坐标
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，原坐标不是顶点
+                     返回RES::VERTEX_NOT_FOUND，新点与某个相邻元素的其他点
+                     重复返回RES::REPEAT_POINT，修改后的面、线与已有的
+                     面、线重复返回RES::REPEAT_ELEMENT，此时模型不变
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 区分元素重复
+*************************************************************************/
+Controller::RES Controller::ModelMoveVertex(const Point3D& OldPoint,
+    const Point3D& NewPoint){
+    std::shared_ptr<Model3D> TempModel = m_Models[m_ChosenModelTag];
+    if (TempModel->VertexValence(OldPoint) == 0) {
+        //原坐标不是顶点
+        return RES::VERTEX_NOT_FOUND;
+    }
+    //移动失败的原因是否为元素重复
+    bool IsRepeatElement = false;
+    if (!TempModel->MoveVertex(OldPoint, NewPoint, IsRepeatElement)) {
+        if (IsRepeatElement) {
+            //修改后的元素与已有元素重复
+            return RES::REPEAT_ELEMENT;
+        }
+        //新点与相邻元素的其他点重复
+        return RES::REPEAT_POINT;
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ShowModelTopology
+【函数功能】          列出当前模型的拓扑统计信息（由半边结构得到）
+【参数】              Info_Topology& Info：拓扑信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelTopology(Info_Topology& Info){
+    const HalfEdgeMesh3D& Mesh 
+        = m_Models[m_ChosenModelTag]->GetHalfEdgeMesh();
+    Info.VertexNumber = Mesh.VertexNum();
+    Info.EdgeNumber = Mesh.EdgeNum();
+    Info.BoundaryEdgeNumber = Mesh.BoundaryEdgeNum();
+    Info.NonManifoldEdgeNumber = Mesh.NonManifoldEdgeNum();
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ShowModelFaceNeighbors
+【函数功能】          列出当前模型中与指定面共边的面
+【参数】              size_t FaceTag：面标记
+                     std::vector<size_t>& FaceTags：相邻面标记（重写，升序）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelFaceNeighbors(
+    size_t FaceTag, std::vector<size_t>& FaceTags){
+    if (FaceTag >= m_Models[m_ChosenModelTag]->FaceNum) {
+        //标签越界错误
+        return RES::TAG_OUT_OF_RANGE;
+    }
+    m_Models[m_ChosenModelTag]->GetHalfEdgeMesh().FaceNeighbors(
+        FaceTag, FaceTags);
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ValidateModel
+【函数功能】          校验当前模型网格：退化面、重复面、非流形边、
+                     边界边与绕向一致性
+【参数】              Info_Validation& Info：校验信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ValidateModel(Info_Validation& Info){
+    MeshReport3D Report;
+    m_Models[m_ChosenModelTag]->Validate(Report);
+    Info.IsValid = Report.IsValid;
+    Info.DegenerateFaceTags = std::move(Report.DegenerateFaceTags);
+    Info.DuplicateFaceTags = std::move(Report.DuplicateFaceTags);
+    Info.EdgeNumber = Report.EdgeNum;
+    Info.BoundaryEdgeNumber = Report.BoundaryEdgeNum;
+    Info.NonManifoldEdgeNumber = Report.NonManifoldEdgeNum;
+    Info.InconsistentEdgeNumber = Report.InconsistentEdgeNum;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          FillMassInfo
+【函数功能】          向模型信息填入质量属性（模型内按几何版本缓存）
+【参数】              const Model3D& Model：模型
+                     Info_Model3D& Info：模型信息
+【返回值】            无
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Controller::FillMassInfo(const Model3D& Model, Info_Model3D& Info){
+    const MassProperties3D& Mass = Model.GetMassProperties();
+    Info.SignedVolume = Mass.Volume;
+    Info.SurfaceCentroid = Info_Point3D{Mass.SurfaceCentroid[0],
+        Mass.SurfaceCentroid[1], Mass.SurfaceCentroid[2]};
+    Info.VolumeCentroid = Info_Point3D{Mass.VolumeCentroid[0],
+        Mass.VolumeCentroid[1], Mass.VolumeCentroid[2]};
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            Info.Inertia[i][j] = Mass.Inertia[i][j];
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】          ShowModelBounds
+【函数功能】          列出当前模型的有向包围盒与近似最小包围球
+【参数】              Info_Bounds& Info：包围体信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelBounds(Info_Bounds& Info){
+    const OrientedBox3D& Box = m_Models[m_ChosenModelTag]->GetOrientedBox();
+    const BoundingSphere3D& Sphere 
+        = m_Models[m_ChosenModelTag]->GetBoundingSphere();
+    Info.BoxCenter = Info_Point3D{
+        Box.Center[0], Box.Center[1], Box.Center[2]};
+    for (size_t i = 0; i < 3; i++) {
+        Info.BoxAxes[i] = Info_Point3D{
+            Box.Axes[i][0], Box.Axes[i][1], Box.Axes[i][2]};
+        Info.BoxHalfExtents[i] = Box.HalfExtents[i];
+    }
+    Info.BoxVolume = Box.Volume;
+    Info.SphereCenter = Info_Point3D{
+        Sphere.Center[0], Sphere.Center[1], Sphere.Center[2]};
+    Info.SphereRadius = Sphere.Radius;
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          ShowModelLOD
+【函数功能】          列出当前模型多细节层次链的状态，不等待后台生成
+【参数】              Info_LOD& Info：层次链信息
+【返回值】            RES：执行结果，成功返回RES::SUCCESS
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::ShowModelLOD(Info_LOD& Info){
+    const Model3D& Source = *m_Models[m_ChosenModelTag];
+    auto It = m_LODs.find(&Source);
+    Info.IsFresh = It != m_LODs.end() && It->second->IsFresh(Source);
+    Info.IsReady = Info.IsFresh && It->second->IsReady();
+    for (size_t Level = 0; Level < ModelLOD3D::LEVEL_NUM; Level++) {
+        Info.LevelRatios[Level] = ModelLOD3D::LEVEL_RATIOS[Level];
+        Info.LevelFaceNumbers[Level] = 0;
+    }
+    Info.LevelFaceNumbers[0] = Source.FaceNum;
+    if (Info.IsReady) {
+        for (size_t Level = 1; Level < ModelLOD3D::LEVEL_NUM; Level++) {
+            std::shared_ptr<const Model3D> LODModel 
+                = It->second->GetLevel(Level);
+            if (LODModel != nullptr) {
+                Info.LevelFaceNumbers[Level] = LODModel->FaceNum;
+            }
+        }
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          GetModelLOD
+【函数功能】          获取当前模型的第Level层细节：第0层为模型本身；
+                     层次链已就绪时立即返回，后台仍在生成时等待，
+                     过期或未生成时先启动生成再等待
+【参数】              size_t Level：层号
+                     std::shared_ptr<const Model3D>& LODModel：该层模型
+                     （只读，由缓存共享）
+【返回值】            RES：执行结果，成功返回RES::SUCCESS，
+                     层号越界返回RES::TAG_OUT_OF_RANGE，
+                     规模超出简化器范围返回RES::MODEL_TOO_LARGE
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Controller::RES Controller::GetModelLOD(size_t Level, 
+    std::shared_ptr<const Model3D>& LODModel){
+    if (Level >= ModelLOD3D::LEVEL_NUM) {
+        //标签越界错误
+        return RES::TAG_OUT_OF_RANGE;
+    }
+    if (Level == 0) {
+        LODModel = m_Models[m_ChosenModelTag];
+        //若没有遇到异常错误，则返回“成功”
+        return RES::SUCCESS;
+    }
+    LODModel = StartLOD(m_ChosenModelTag).GetLevel(Level);
+    if (LODModel == nullptr) {
+        return RES::MODEL_TOO_LARGE;
+    }
+    //若没有遇到异常错误，则返回“成功”
+    return RES::SUCCESS;
+}
+
+/*************************************************************************
+【函数名称】          StartLOD
+【函数功能】          获取指定模型的多细节层次链，过期或未生成时以模型
+                     当前几何启动后台生成
+【参数】              size_t ModelTag：模型标记
+【返回值】            ModelLOD3D&，该模型的多细节层次链
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+ModelLOD3D& Controller::StartLOD(size_t ModelTag){
+    const Model3D& Source = *m_Models[ModelTag];
+    std::shared_ptr<ModelLOD3D>& LOD = m_LODs[&Source];
+    if (LOD == nullptr) {
+        LOD = std::make_shared<ModelLOD3D>();
+    }
+    if (!LOD->IsFresh(Source)) {
+        LOD->Start(Source);
+    }
+    return *LOD;
+}
+
+/*************************************************************************
+【函数名称】          LODFileName
+【函数功能】          第Level层细节的保存文件名：在扩展名前加“_lodK”，
+                     无扩展名时加在末尾
+【参数】              const std::string& FileName：模型文件名
+                     size_t Level：层号
+【返回值】            std::string，该层文件名
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::string Controller::LODFileName(const std::string& FileName, 
+    size_t Level){
+    size_t Dot = FileName.find_last_of('.');
+    size_t Slash = FileName.find_last_of("/\\");
+    if (Dot == std::string::npos 
+        || (Slash != std::string::npos && Dot < Slash)) {
+        Dot = FileName.size();
+    }
+    return FileName.substr(0, Dot) + "_lod" + std::to_string(Level)
+        + FileName.substr(Dot);
+}
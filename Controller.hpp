@@ -3,6 +3,29 @@
 【功能模块和目的】          控制器类声明
 【开发者及日期】            梁思奇 2024/8/8
 【更改记录】               梁思奇 2024/8/10 改进功能函数实现方式
+                          梁思奇 2026/10/18 按标签删除改为O(1)，增加批量删除
+                          梁思奇 2026/10/18 改点经由模型接口，增加射线查询
+                          梁思奇 2026/10/18 增加射线查询性能测试
+                          梁思奇 2026/10/18 增加顶点近邻、半径与计数查询
+                          梁思奇 2026/10/18 增加包围盒与球区域元素选择
+                          梁思奇 2026/10/18 增加顶点焊接与导入焊接选项
+                          梁思奇 2026/10/18 增加拓扑统计与相邻面查询
+                          梁思奇 2026/10/18 增加连通分量拆分与小碎块删除
+                          梁思奇 2026/10/18 增加网格校验报告
+                          梁思奇 2026/10/18 模型信息增加体积、质心与惯性张量
+                          梁思奇 2026/10/18 增加有向包围盒与包围球查询
+                          梁思奇 2026/10/18 增加凸包模型生成
+                          梁思奇 2026/10/18 增加面积、长度内核性能测试
+                          梁思奇 2026/10/18 增加面积、长度总和漂移校验
+                          梁思奇 2026/10/18 增加QEM网格简化
+                          梁思奇 2026/10/18 增加多细节层次链的后台生成与缓存
+                          梁思奇 2026/10/18 增加水平平面切片轮廓生成
+                          梁思奇 2026/10/18 增加表面与实体体素化
+                          梁思奇 2026/10/18 增加模型间碰撞与重叠面查询
+                          梁思奇 2026/10/18 增加模型间表面距离比较
+                          梁思奇 2026/10/18 增加模型结构差异与补丁应用
+                          梁思奇 2026/10/18 增加模型平移、旋转、缩放与仿射变换
+                          梁思奇 2026/10/18 增加共享顶点移动
 *************************************************************************/
 
 #ifndef CONTROLLER_HPP
@@ -24,6 +47,16 @@
 #include <memory>
 //std::string所属头文件
 #include <string>
+//ModelLOD3D类所属头文件
+#include "ModelLOD3D.hpp"
+//std::map所属头文件
+#include <map>
+//std::pair所属头文件
+#include <utility>
+//std::numeric_limits所属头文件
+#include <limits>
+//std::array所属头文件
+#include <array>
 
 //定义常量NO_TAG_NUMBER，表示无标签号
 const size_t NO_TAG_NUMBER = SIZE_MAX;
@@ -36,6 +69,36 @@ const size_t NO_TAG_NUMBER = SIZE_MAX;
                     以及模型相关信息的获取接口
 【开发者及日期】     梁思奇 2024/8/8
 【更改记录】         梁思奇 2024/8/10 改进功能函数实现方式
+                    梁思奇 2026/10/18 按标签删除改为O(1)，增加批量删除
+                    梁思奇 2026/10/18 改点经由模型接口，增加射线查询
+                    梁思奇 2026/10/18 增加射线查询性能测试
+                    梁思奇 2026/10/18 增加顶点近邻、半径与计数查询
+                    梁思奇 2026/10/18 增加包围盒与球区域元素选择
+                    梁思奇 2026/10/18 增加顶点焊接与导入焊接选项
+                    梁思奇 2026/10/18 增加拓扑统计与相邻面查询
+                    梁思奇 2026/10/18 增加连通分量拆分与小碎块删除
+                    梁思奇 2026/10/18 增加网格校验报告
+                    梁思奇 2026/10/18 模型信息增加体积、质心与惯性张量
+                    梁思奇 2026/10/18 增加有向包围盒与包围球查询
+                    梁思奇 2026/10/18 增加凸包模型生成
+                    梁思奇 2026/10/18 增加面积、长度内核性能测试
+                    梁思奇 2026/10/18 增加面积、长度总和漂移校验
+                    梁思奇 2026/10/18 增加QEM网格简化
+                    梁思奇 2026/10/18 增加多细节层次链的后台生成、缓存与保存，
+                    各模型的层次链按几何版本号判断是否过期，
+                    过期后在下次生成或获取时重建
+                    梁思奇 2026/10/18 增加水平平面切片轮廓生成
+                    梁思奇 2026/10/18 增加表面与实体体素化及吞吐量统计
+                    梁思奇 2026/10/18 增加模型间碰撞与重叠面查询，
+                    可只判断是否相交或列出全部相交面对
+                    梁思奇 2026/10/18 增加模型间表面距离比较，
+                    单向或双向Hausdorff、平均与均方根距离
+                    梁思奇 2026/10/18 增加模型结构差异与补丁应用，
+                    补丁与当前模型不符时返回PATCH_MISMATCH
+                    梁思奇 2026/10/18 增加模型整体平移、旋转、缩放与
+                    仿射变换，矩阵无效时返回INVALID_TRANSFORM
+                    梁思奇 2026/10/18 增加共享顶点移动，原坐标不是顶点时
+                    返回VERTEX_NOT_FOUND
 *************************************************************************/
 class Controller{
 private:
@@ -103,10 +166,271 @@ public:
         double AreaSum;
         //最小包围长方体体积
         double Volume;
+        //封闭网格有向体积
+        double SignedVolume{0.0};
+        //表面（面积加权）质心
+        Info_Point3D SurfaceCentroid{};
+        //体积加权质心
+        Info_Point3D VolumeCentroid{};
+        //关于体积质心的惯性张量（密度为1）
+        double Inertia[3][3]{};
     };
     //模型信息表列表
     using List_Model3DInfo = std::vector<Info_Model3D>;
 
+    //射线命中信息类
+    class Info_RayHit{
+    public:
+        //是否命中
+        bool IsHit;
+        //命中面标签
+        size_t FaceTag;
+        //交点到射线起点的距离
+        double Distance;
+        //交点信息
+        Info_Point3D Point;
+    };
+
+    //射线查询性能测试信息类
+    class Info_RayBenchmark{
+    public:
+        //射线数
+        size_t RayNumber;
+        //命中射线数
+        size_t HitNumber;
+        //批量查询使用的线程数
+        size_t ThreadNumber;
+        //逐条查询吞吐量（单线程，条/秒）
+        double SingleRaysPerSecond;
+        //批量查询吞吐量（射线包、全部线程，条/秒）
+        double BatchRaysPerSecond;
+        //两种查询结果不一致的射线数（应为0）
+        size_t MismatchNumber;
+    };
+    //面积、长度内核性能测试信息类（耗时均为每元素纳秒）
+    class Info_MeasureBenchmark{
+    public:
+        //SIMD内核使用的指令集
+        std::string ISAName;
+        //面数
+        size_t FaceNumber;
+        //线数
+        size_t LineNumber;
+        //重复轮数
+        size_t RoundNumber;
+        //批量查询使用的线程数
+        size_t ThreadNumber;
+        //原有海伦公式求面积（单线程，三次求边长，含临时向量）
+        double FaceHeronNs;
+        //逐对象虚函数求面积（单线程，叉积公式）
+        double FaceObjectNs;
+        //标量内核求面积（单线程，坐标已按分量排列）
+        double FaceScalarNs;
+        //SIMD内核求面积（单线程，坐标已按分量排列）
+        double FaceSimdNs;
+        //批量查询求面积（收集坐标+SIMD内核，全部线程）
+        double FaceBulkNs;
+        //逐对象虚函数求长度（单线程）
+        double LineObjectNs;
+        //标量内核求长度（单线程，坐标已按分量排列）
+        double LineScalarNs;
+        //SIMD内核求长度（单线程，坐标已按分量排列）
+        double LineSimdNs;
+        //批量查询求长度（收集坐标+SIMD内核，全部线程）
+        double LineBulkNs;
+        //SIMD结果与逐对象结果的最大相对误差
+        double MaxRelativeError;
+        //海伦公式结果相对逐对象结果（叉积公式）的最大相对误差
+        double HeronRelativeError;
+    };
+    //面积、长度总和漂移校验信息类
+    class Info_MeasureDrift{
+    public:
+        //增量维护的总面积
+        double MaintainedArea;
+        //全量重算的总面积
+        double RecomputedArea;
+        //面积相对漂移
+        double AreaRelativeDrift;
+        //增量维护的总长度
+        double MaintainedLength;
+        //全量重算的总长度
+        double RecomputedLength;
+        //长度相对漂移
+        double LengthRelativeDrift;
+    };
+
+    //顶点焊接信息类
+    class Info_Weld{
+    public:
+        //被焊接的点数（不重复计算）
+        size_t WeldedPointNumber;
+        //塌缩或重复而删除的面数
+        size_t RemovedFaceNumber;
+        //塌缩或重复而删除的线段数
+        size_t RemovedLineNumber;
+    };
+
+    //模型拓扑信息类
+    class Info_Topology{
+    public:
+        //顶点数（不重复计算）
+        size_t VertexNumber;
+        //无向边数
+        size_t EdgeNumber;
+        //边界边数（只属于一个面）
+        size_t BoundaryEdgeNumber;
+        //非流形边数（属于三个及以上面）
+        size_t NonManifoldEdgeNumber;
+    };
+
+    //小碎块删除信息类
+    class Info_RemoveComponents{
+    public:
+        //删除的连通分量数
+        size_t RemovedComponentNumber;
+        //删除的面数
+        size_t RemovedFaceNumber;
+        //删除的线段数
+        size_t RemovedLineNumber;
+    };
+
+    //网格校验信息类
+    class Info_Validation{
+    public:
+        //是否全部检查通过
+        bool IsValid;
+        //退化面（三点共线）标签
+        std::vector<size_t> DegenerateFaceTags;
+        //重复面标签（保留标签最小者，其余列出）
+        std::vector<size_t> DuplicateFaceTags;
+        //无向边数
+        size_t EdgeNumber;
+        //边界边数（只属于一个面）
+        size_t BoundaryEdgeNumber;
+        //非流形边数（属于三个及以上面）
+        size_t NonManifoldEdgeNumber;
+        //绕向不一致边数
+        size_t InconsistentEdgeNumber;
+    };
+
+    //包围体信息类
+    class Info_Bounds{
+    public:
+        //有向包围盒中心
+        Info_Point3D BoxCenter;
+        //有向包围盒三条单位轴
+        Info_Point3D BoxAxes[3];
+        //有向包围盒各轴半长
+        double BoxHalfExtents[3];
+        //有向包围盒体积
+        double BoxVolume;
+        //包围球球心
+        Info_Point3D SphereCenter;
+        //包围球半径
+        double SphereRadius;
+    };
+
+    //多细节层次链信息类
+    class Info_LOD{
+    public:
+        //层次链是否由模型当前几何生成（否则已过期或未生成）
+        bool IsFresh;
+        //各层是否已可立即获取（后台生成已完成）
+        bool IsReady;
+        //各层面数相对源模型的比例
+        double LevelRatios[ModelLOD3D::LEVEL_NUM];
+        //各层面数（未就绪的层为0）
+        size_t LevelFaceNumbers[ModelLOD3D::LEVEL_NUM];
+    };
+
+    //平面切片信息类
+    class Info_Slice{
+    public:
+        //层数
+        size_t LayerNumber;
+        //闭合轮廓数
+        size_t ClosedContourNumber;
+        //不闭合轮廓数（网格有边界或非流形边）
+        size_t OpenContourNumber;
+        //轮廓线段数（即切片模型的线段数）
+        size_t SegmentNumber;
+        //切片耗时（秒，不含生成切片模型）
+        double Seconds;
+    };
+
+    //体素化信息类
+    class Info_Voxelize{
+    public:
+        //各轴体素数
+        size_t Resolution[3];
+        //被占据的体素数
+        size_t VoxelNumber;
+        //存储的块数（8×8×8体素一块）
+        size_t BlockNumber;
+        //块存储占用的字节数
+        size_t MemoryBytes;
+        //体素化耗时（秒）
+        double Seconds;
+        //每秒处理的网格体素数（全部网格体素数除以耗时）
+        double VoxelsPerSecond;
+    };
+
+    //模型相交信息类
+    class Info_Collision{
+    public:
+        //两模型是否有相交的面
+        bool IsIntersecting;
+        //找出的相交面对数（只判断是否相交时至多为1）
+        size_t PairNumber;
+        //查询耗时（秒，不含构建BVH）
+        double Seconds;
+    };
+
+    //模型表面距离信息类
+    class Info_SurfaceDistance{
+    public:
+        //当前模型到指定模型的单向Hausdorff距离
+        double ForwardHausdorff;
+        //指定模型到当前模型的单向Hausdorff距离（只求单向时为0）
+        double BackwardHausdorff;
+        //Hausdorff距离（双向时取两个单向距离的较大者）
+        double Hausdorff;
+        //平均距离（双向时合并两个方向的采样点）
+        double MeanDistance;
+        //均方根距离（双向时合并两个方向的采样点）
+        double RMSDistance;
+        //已求距离的采样点数
+        size_t SampleNumber;
+        //是否因距离超过误差界而提前停止（此时距离为下界）
+        bool IsStopped;
+        //查询耗时（秒，不含构建BVH）
+        double Seconds;
+    };
+
+    //模型结构差异信息类
+    class Info_Diff{
+    public:
+        //未改动的面数
+        size_t UnchangedFaceNumber;
+        //移动（只差一个顶点）的面数
+        size_t MovedFaceNumber;
+        //删除的面数
+        size_t RemovedFaceNumber;
+        //新增的面数
+        size_t AddedFaceNumber;
+        //未改动的线数
+        size_t UnchangedLineNumber;
+        //移动（只差一个端点）的线数
+        size_t MovedLineNumber;
+        //删除的线数
+        size_t RemovedLineNumber;
+        //新增的线数
+        size_t AddedLineNumber;
+        //比较耗时（秒）
+        double Seconds;
+    };
+
     //Controller类返回值枚举（成功或错误类型）
     enum class RES : size_t{
         SUCCESS             = 0,
@@ -115,17 +439,25 @@ public:
         REPEAT_POINT        = 3,
         TAG_OUT_OF_RANGE    = 4,
         FAIL_TO_IMPORT      = 5,
-        FAIL_TO_EXPORT      = 6
+        FAIL_TO_EXPORT      = 6,
+        DEGENERATE_MODEL    = 7,
+        MODEL_TOO_LARGE     = 8,
+        PATCH_MISMATCH      = 9,
+        INVALID_TRANSFORM   = 10,
+        VERTEX_NOT_FOUND    = 11
     };
     //静态常量字符串数组数据成员：RES枚举类名称
     static const std::string RESNAME[];
     
     //Setter
 
-    //导入文件到模型
-    RES ImportModel(const std::string& FileName, size_t ModelTag);
-    //导出模型到文件
-    RES ExportModel(const std::string& FileName, size_t ModelTag);
+    //导入文件到模型（焊接容差大于0时导入后焊接顶点；
+    //WithLOD为true时一并读入同目录下保存的多细节层次）
+    RES ImportModel(const std::string& FileName, size_t ModelTag,
+        double WeldTolerance = 0.0, bool WithLOD = false);
+    //导出模型到文件（WithLOD为true时在同目录下一并保存多细节层次）
+    RES ExportModel(const std::string& FileName, size_t ModelTag,
+        bool WithLOD = false);
     //创建设置空模型
     RES SetEmptyModel();
     //选择模型作为操作对象
@@ -156,14 +488,45 @@ public:
     RES ModelDeleteLine(size_t LineTag);
     //删除当前模型中的指定面
     RES ModelDeleteFace(size_t FaceTag);
+    //批量删除当前模型中的指定线
+    RES ModelDeleteLines(const std::vector<size_t>& LineTags);
+    //批量删除当前模型中的指定面
+    RES ModelDeleteFaces(const std::vector<size_t>& FaceTags);
+
+    //模型整理
+    //按容差焊接当前模型的顶点
+    RES ModelWeldVertices(double Tolerance, Info_Weld& Info);
+    //把当前模型按连通分量拆分为新模型并依次加入模型列表末尾
+    //（原模型保留，当前模型不变）
+    RES SplitModelComponents(size_t& ComponentNum);
+    //删除当前模型中面数少于MinFaceNum或面积小于MinArea的连通分量
+    RES ModelRemoveSmallComponents(size_t MinFaceNum, double MinArea,
+        Info_RemoveComponents& Info);
+    //计算当前模型的凸包并作为新模型加入模型列表末尾（当前模型不变）
+    RES ModelConvexHull(size_t& HullModelTag);
+    //简化当前模型到面数不超过TargetFaceNum（或单次塌缩误差超过
+    //MaxError为止），作为新模型加入模型列表末尾（当前模型不变）
+    RES ModelDecimate(size_t TargetFaceNum, double MaxError,
+        size_t& NewModelTag);
+    //在后台生成当前模型的多细节层次链（已由当前几何生成时不重复生成）
+    RES BuildModelLOD();
+    //用高度为FirstHeight + k * LayerSpacing（0 ≤ k < LayerNum）的
+    //水平平面切割当前模型，各层轮廓作为Line3D组成新模型加入模型列表
+    //末尾（当前模型不变）
+    RES ModelSlice(double FirstHeight, double LayerSpacing,
+        size_t LayerNum, size_t& SliceModelTag, Info_Slice& Info);
+    //以边长VoxelSize体素化当前模型的面，IsSolid为true时填充内部；
+    //结果为只读的体素网格，不加入模型列表
+    RES ModelVoxelize(double VoxelSize, bool IsSolid,
+        std::shared_ptr<const VoxelGrid3D>& Grid, Info_Voxelize& Info);
 
     //Getter
 
     //静态函数：获取控制器实例指针
     static std::shared_ptr<Controller> GetControllerPtr();
-    //列出所有模型信息
+    //列出所有模型信息（质量属性保持默认值）
     RES ShowAllModels(List_Model3DInfo& InfoList);
-    //列出指定模型信息
+    //列出指定模型信息（含质量属性）
     RES ShowModle(size_t ModelTag, Info_Model3D& Info);
     //列出当前模型信息
     RES ShowThisModel(Info_Model3D& Info);
@@ -179,6 +542,98 @@ public:
     RES ShowModelLineAllPoints(
         size_t LineTag,
         List_Point3DInfo& InfoList);
+    //当前模型射线最近交点查询
+    RES ModelRayCast(
+        const Point3D& Origin,
+        const Point3D& Direction,
+        Info_RayHit& Info);
+    //当前模型射线遮挡查询
+    RES ModelRayOccluded(
+        const Point3D& Origin,
+        const Point3D& Direction,
+        double MaxDistance,
+        bool& IsOccluded);
+    //当前模型射线查询性能测试（逐条与批量对比）
+    RES BenchmarkRayCast(size_t RayNum, Info_RayBenchmark& Info);
+    //当前模型面积、长度计算性能测试（逐对象、标量、SIMD与批量对比）
+    RES BenchmarkMeasureKernels(size_t RoundNum, Info_MeasureBenchmark& Info);
+    //校验当前模型增量维护的面积、长度总和（与并行全量重算比较）
+    RES VerifyModelMeasures(Info_MeasureDrift& Info);
+    //列出当前模型中距指定点最近的K个顶点（按距离升序）
+    RES ShowModelNearestVertices(
+        const Point3D& Point1,
+        size_t K,
+        List_Point3DInfo& InfoList);
+    //列出当前模型中距指定点不超过半径的顶点
+    RES ShowModelVerticesInRadius(
+        const Point3D& Point1,
+        double Radius,
+        List_Point3DInfo& InfoList);
+    //统计当前模型中位于指定包围盒内的顶点数
+    RES CountModelVerticesInBox(
+        const Point3D& MinPoint,
+        const Point3D& MaxPoint,
+        size_t& Count);
+    //列出当前模型的拓扑统计信息
+    RES ShowModelTopology(Info_Topology& Info);
+    //列出当前模型的有向包围盒与包围球
+    RES ShowModelBounds(Info_Bounds& Info);
+    //列出当前模型多细节层次链的状态
+    RES ShowModelLOD(Info_LOD& Info);
+    //获取当前模型第Level层细节（第0层为模型本身；层次链过期或
+    //未生成时先生成，后台仍在生成时等待）
+    RES GetModelLOD(size_t Level, std::shared_ptr<const Model3D>& LODModel);
+    //校验当前模型网格
+    RES ValidateModel(Info_Validation& Info);
+    //列出当前模型中与指定面共边的面
+    RES ShowModelFaceNeighbors(size_t FaceTag, std::vector<size_t>& FaceTags);
+    //选择当前模型中与包围盒相交的面、线（标签可直接用于批量删除）
+    RES SelectModelElementsInBox(
+        const Point3D& MinPoint,
+        const Point3D& MaxPoint,
+        std::vector<size_t>& FaceTags,
+        std::vector<size_t>& LineTags);
+    //选择当前模型中与球相交的面、线
+    RES SelectModelElementsInSphere(
+        const Point3D& Center,
+        double Radius,
+        std::vector<size_t>& FaceTags,
+        std::vector<size_t>& LineTags);
+    //当前模型与指定模型的面相交查询：IsAnyHit为true时只判断是否相交，
+    //否则列出全部相交面对（当前模型面标签，指定模型面标签）
+    RES ModelCollide(
+        size_t OtherModelTag,
+        bool IsAnyHit,
+        std::vector<std::pair<size_t, size_t>>& FacePairs,
+        Info_Collision& Info);
+    //当前模型与指定模型的表面距离：每单位面积SampleDensity个采样点，
+    //IsSymmetric为true时求双向距离，任一距离超过ErrorBound时提前停止
+    RES ModelSurfaceDistance(
+        size_t OtherModelTag,
+        double SampleDensity,
+        bool IsSymmetric,
+        Info_SurfaceDistance& Info,
+        double ErrorBound = std::numeric_limits<double>::infinity());
+    //当前模型与修订版模型（指定模型）的结构差异，Patch应用于当前模型
+    //即得修订版；Tolerance为坐标取整容差，不为正时精确比较
+    RES ModelDiff(
+        size_t RevisedModelTag,
+        double Tolerance,
+        ModelPatch3D& Patch,
+        Info_Diff& Info);
+    //把补丁应用于当前模型（补丁须由面数、线数与当前模型相同的基准得到）
+    RES ModelApplyPatch(const ModelPatch3D& Patch);
+    //对当前模型的全部点做仿射变换，Matrix为按行存放的4×4矩阵
+    RES ModelTransform(const std::array<double, 16>& Matrix);
+    //平移当前模型
+    RES ModelTranslate(double DX, double DY, double DZ);
+    //当前模型绕过原点、方向为(AxisX, AxisY, AxisZ)的轴旋转Degree度
+    //（沿轴方向看去逆时针为正）
+    RES ModelRotate(double AxisX, double AxisY, double AxisZ, double Degree);
+    //以原点为中心均匀缩放当前模型
+    RES ModelScale(double Factor);
+    //移动当前模型的一个顶点：含该点的全部面、线同时修改
+    RES ModelMoveVertex(const Point3D& OldPoint, const Point3D& NewPoint);
     //非静态常引用数据成员：当前模型标签
     const size_t& ChosenModelTag{m_ChosenModelTag};
     
@@ -189,6 +644,14 @@ private:
     size_t m_ChosenModelTag{NO_TAG_NUMBER};
     //静态私有数据成员：控制器实例指针
     static std::shared_ptr<Controller> m_pControllerIntance;
+    //各模型的多细节层次链
+    std::map<const Model3D*, std::shared_ptr<ModelLOD3D>> m_LODs{};
+    //静态私有函数：向模型信息填入质量属性
+    static void FillMassInfo(const Model3D& Model, Info_Model3D& Info);
+    //私有函数：获取指定模型的多细节层次链，过期或未生成时启动后台生成
+    ModelLOD3D& StartLOD(size_t ModelTag);
+    //静态私有函数：第Level层细节的保存文件名（扩展名前加“_lodK”）
+    static std::string LODFileName(const std::string& FileName, size_t Level);
 };
 
 #endif //CONTROLLER_HPP
@@ -0,0 +1,423 @@
+/*************************************************************************
+【文件名】                 ConvexHull3D.cpp
+【功能模块和目的】          三维点集凸包（Quickhull）类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "ConvexHull3D.hpp"
+//Predicates3D类所属头文件
+#include "Predicates3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//SIZE_MAX所属头文件
+#include <cstdint>
+//std::abs所属头文件
+#include <cmath>
+//std::sort、std::lower_bound所属头文件
+#include <algorithm>
+//std::pair所属头文件
+#include <utility>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        Quickhull构建凸包：初始四面体与全部点的并行划分，
+                   之后逐个处理仍有外侧点的面，直到所有面外侧点集为空
+【参数】            const std::vector<Coord3D>& Points：点集
+【返回值】          bool，成功返回true；点集全部共面时返回false，凸包为空
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ConvexHull3D::Build(const std::vector<Coord3D>& Points){
+    m_HullVertices.clear();
+    m_HullFaces.clear();
+    m_HullVertexSources.clear();
+    m_Faces.clear();
+    m_ullVisitRound = 0;
+    m_pPoints = &Points;
+    std::array<size_t, 4> Simplex;
+    if (!InitialSimplex(Simplex)) {
+        m_pPoints = nullptr;
+        return false;
+    }
+    //初始四面体：第i个面不含Simplex[i]，且该顶点在面内侧
+    for (size_t i = 0; i < 4; i++) {
+        HullFace Face;
+        Face.Vertices = {{Simplex[(i + 1) % 4], Simplex[(i + 2) % 4],
+            Simplex[(i + 3) % 4]}};
+        if (IsAbove(Face, Simplex[i])) {
+            std::swap(Face.Vertices[1], Face.Vertices[2]);
+        }
+        Face.Neighbors = {{SIZE_MAX, SIZE_MAX, SIZE_MAX}};
+        Face.Farthest = SIZE_MAX;
+        Face.IsAlive = true;
+        Face.VisitMark = 0;
+        Face.IsVisible = false;
+        m_Faces.push_back(Face);
+    }
+    //按反向边匹配相邻面
+    for (size_t f = 0; f < 4; f++) {
+        for (size_t k = 0; k < 3; k++) {
+            size_t From = m_Faces[f].Vertices[k];
+            size_t To = m_Faces[f].Vertices[(k + 1) % 3];
+            for (size_t g = 0; g < 4; g++) {
+                for (size_t j = 0; j < 3 && g != f; j++) {
+                    if (m_Faces[g].Vertices[j] == To
+                        && m_Faces[g].Vertices[(j + 1) % 3] == From) {
+                        m_Faces[f].Neighbors[k] = g;
+                    }
+                }
+            }
+        }
+    }
+    //除初始顶点外的全部点并行划分到初始四个面
+    std::vector<size_t> Candidates;
+    Candidates.reserve(Points.size());
+    for (size_t i = 0; i < Points.size(); i++) {
+        if (i != Simplex[0] && i != Simplex[1]
+            && i != Simplex[2] && i != Simplex[3]) {
+            Candidates.push_back(i);
+        }
+    }
+    Partition(Candidates, std::vector<size_t>{0, 1, 2, 3});
+    Candidates = std::vector<size_t>();
+    //逐个处理有外侧点的面
+    std::vector<size_t> Pending{0, 1, 2, 3};
+    while (!Pending.empty()) {
+        size_t FaceIndex = Pending.back();
+        Pending.pop_back();
+        if (!m_Faces[FaceIndex].IsAlive
+            || m_Faces[FaceIndex].Outside.empty()) {
+            continue;
+        }
+        size_t OldFaceCount = m_Faces.size();
+        AddPoint(FaceIndex);
+        for (size_t f = OldFaceCount; f < m_Faces.size(); f++) {
+            if (!m_Faces[f].Outside.empty()) {
+                Pending.push_back(f);
+            }
+        }
+    }
+    //收集存活的面，顶点重新编号（按输入下标升序）
+    std::vector<size_t> NewIndex(Points.size(), SIZE_MAX);
+    for (const auto& Face : m_Faces) {
+        if (Face.IsAlive) {
+            for (auto Vertex : Face.Vertices) {
+                NewIndex[Vertex] = 0;
+            }
+        }
+    }
+    for (size_t i = 0; i < Points.size(); i++) {
+        if (NewIndex[i] != SIZE_MAX) {
+            NewIndex[i] = m_HullVertices.size();
+            m_HullVertices.push_back(Points[i]);
+            m_HullVertexSources.push_back(i);
+        }
+    }
+    for (const auto& Face : m_Faces) {
+        if (Face.IsAlive) {
+            m_HullFaces.push_back(std::array<size_t, 3>{{
+                NewIndex[Face.Vertices[0]], NewIndex[Face.Vertices[1]],
+                NewIndex[Face.Vertices[2]]}});
+        }
+    }
+    //释放构建期数据
+    m_Faces = std::vector<HullFace>();
+    m_pPoints = nullptr;
+    return true;
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        HullVertices
+【函数功能】        获取凸包顶点坐标
+【参数】            无
+【返回值】          const std::vector<Coord3D>&，凸包顶点坐标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::vector<Coord3D>& ConvexHull3D::HullVertices() const{
+    return m_HullVertices;
+}
+
+/*************************************************************************
+【函数名称】        HullFaces
+【函数功能】        获取凸包三角形面（从外侧看逆时针）
+【参数】            无
+【返回值】          const std::vector<std::array<size_t, 3>>&，
+                   各面顶点在HullVertices中的下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::vector<std::array<size_t, 3>>& ConvexHull3D::HullFaces() const{
+    return m_HullFaces;
+}
+
+/*************************************************************************
+【函数名称】        HullVertexSources
+【函数功能】        获取凸包顶点在输入点集中的下标
+【参数】            无
+【返回值】          const std::vector<size_t>&，输入点下标（升序）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::vector<size_t>& ConvexHull3D::HullVertexSources() const{
+    return m_HullVertexSources;
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        IsAbove
+【函数功能】        点是否严格位于面的外侧（Orient3D符号精确，共面为否）
+【参数】            const HullFace& Face：面
+                   size_t Point：输入点下标
+【返回值】          bool，严格在外侧返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ConvexHull3D::IsAbove(const HullFace& Face, size_t Point) const{
+    const std::vector<Coord3D>& Points = *m_pPoints;
+    return Predicates3D::Orient3D(Points[Face.Vertices[0]],
+        Points[Face.Vertices[1]], Points[Face.Vertices[2]],
+        Points[Point]) > 0.0;
+}
+
+/*************************************************************************
+【函数名称】        Partition
+【函数功能】        把候选点划分到指定面中第一个其严格在外侧的面，
+                   并求各面最远外侧点；候选点切分为连续块并行处理，
+                   各块结果按块顺序合并，结果与线程数无关
+【参数】            const std::vector<size_t>& Candidates：候选点下标
+                   const std::vector<size_t>& FaceIndices：面下标
+                   （外侧点集须为空）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void ConvexHull3D::Partition(const std::vector<size_t>& Candidates,
+    const std::vector<size_t>& FaceIndices){
+    const std::vector<Coord3D>& Points = *m_pPoints;
+    size_t FaceCount = FaceIndices.size();
+    //各面未单位化的法向（只用于同一面内比较远近）
+    std::vector<Coord3D> Normals(FaceCount);
+    for (size_t j = 0; j < FaceCount; j++) {
+        const HullFace& Face = m_Faces[FaceIndices[j]];
+        const Coord3D& A = Points[Face.Vertices[0]];
+        Normals[j] = Geometry3D::Cross(
+            Geometry3D::Sub(Points[Face.Vertices[1]], A),
+            Geometry3D::Sub(Points[Face.Vertices[2]], A));
+    }
+    //块数与Parallel::For的切分一致：每块不少于默认最小块大小
+    size_t Count = Candidates.size();
+    size_t MinChunk = Parallel::DEFAULT_MIN_CHUNK;
+    size_t ChunkNum = std::max<size_t>(1, std::min(Parallel::ThreadCount(),
+        (Count + MinChunk - 1) / MinChunk));
+    size_t ChunkSize = (Count + ChunkNum - 1) / ChunkNum;
+    using Best = std::pair<double, size_t>;
+    std::vector<std::vector<std::vector<size_t>>> Buckets(ChunkNum,
+        std::vector<std::vector<size_t>>(FaceCount));
+    std::vector<std::vector<Best>> Farthest(ChunkNum,
+        std::vector<Best>(FaceCount, Best{-1.0, SIZE_MAX}));
+    Parallel::For(0, ChunkNum, [&](size_t FirstChunk, size_t LastChunk){
+        for (size_t c = FirstChunk; c < LastChunk; c++) {
+            size_t End = std::min(Count, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                size_t Point = Candidates[i];
+                for (size_t j = 0; j < FaceCount; j++) {
+                    const HullFace& Face = m_Faces[FaceIndices[j]];
+                    if (!IsAbove(Face, Point)) {
+                        continue;
+                    }
+                    Buckets[c][j].push_back(Point);
+                    double Distance = Geometry3D::Dot(Normals[j],
+                        Geometry3D::Sub(Points[Point],
+                        Points[Face.Vertices[0]]));
+                    if (Distance > Farthest[c][j].first) {
+                        Farthest[c][j] = Best{Distance, Point};
+                    }
+                    break;
+                }
+            }
+        }
+    }, 1);
+    //按块顺序合并
+    for (size_t j = 0; j < FaceCount; j++) {
+        HullFace& Face = m_Faces[FaceIndices[j]];
+        Best FaceBest{-1.0, SIZE_MAX};
+        for (size_t c = 0; c < ChunkNum; c++) {
+            Face.Outside.insert(Face.Outside.end(),
+                Buckets[c][j].begin(), Buckets[c][j].end());
+            if (Farthest[c][j].first > FaceBest.first) {
+                FaceBest = Farthest[c][j];
+            }
+        }
+        Face.Farthest = FaceBest.second;
+    }
+}
+
+/*************************************************************************
+【函数名称】        InitialSimplex
+【函数功能】        构造初始四面体：六个坐标极值点中相距最远的两点，
+                   距其连线最远的点，距三点平面最远（Orient3D绝对值
+                   最大）的点，各次求最远点均并行
+【参数】            std::array<size_t, 4>& Simplex：四个顶点下标
+【返回值】          bool，点集全部共面（含更低维）时返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ConvexHull3D::InitialSimplex(std::array<size_t, 4>& Simplex) const{
+    const std::vector<Coord3D>& Points = *m_pPoints;
+    if (Points.size() < 4) {
+        return false;
+    }
+    //并行求使Measure(i)最大的点（相同取下标最小者）
+    using Best = std::pair<double, size_t>;
+    auto ArgMax = [&Points](auto Measure){
+        return Parallel::Reduce(0, Points.size(), Best{-1.0, 0},
+            [&](size_t First, size_t Last){
+                Best Partial{-1.0, First};
+                for (size_t i = First; i < Last; i++) {
+                    double Value = Measure(i);
+                    if (Value > Partial.first) {
+                        Partial = Best{Value, i};
+                    }
+                }
+                return Partial;
+            },
+            [](const Best& Lhs, const Best& Rhs){
+                return Rhs.first > Lhs.first ? Rhs : Lhs;});
+    };
+    //六个坐标极值点
+    std::array<size_t, 6> Extremes;
+    for (size_t k = 0; k < 3; k++) {
+        Extremes[2 * k] = ArgMax([&](size_t i){return -Points[i][k];}).second;
+        Extremes[2 * k + 1]
+            = ArgMax([&](size_t i){return Points[i][k];}).second;
+    }
+    double MaxDistance = 0.0;
+    for (size_t i = 0; i < 6; i++) {
+        for (size_t j = i + 1; j < 6; j++) {
+            Coord3D D = Geometry3D::Sub(Points[Extremes[i]],
+                Points[Extremes[j]]);
+            if (Geometry3D::Dot(D, D) > MaxDistance) {
+                MaxDistance = Geometry3D::Dot(D, D);
+                Simplex[0] = Extremes[i];
+                Simplex[1] = Extremes[j];
+            }
+        }
+    }
+    if (MaxDistance == 0.0) {
+        return false;
+    }
+    const Coord3D& A = Points[Simplex[0]];
+    Coord3D AB = Geometry3D::Sub(Points[Simplex[1]], A);
+    Best Third = ArgMax([&](size_t i){
+        Coord3D Cross = Geometry3D::Cross(Geometry3D::Sub(Points[i], A), AB);
+        return Geometry3D::Dot(Cross, Cross);
+    });
+    if (!(Third.first > 0.0)) {
+        return false;
+    }
+    Simplex[2] = Third.second;
+    const Coord3D& B = Points[Simplex[1]];
+    const Coord3D& C = Points[Simplex[2]];
+    Best Fourth = ArgMax([&](size_t i){
+        return std::abs(Predicates3D::Orient3D(A, B, C, Points[i]));
+    });
+    if (!(Fourth.first > 0.0)) {
+        return false;
+    }
+    Simplex[3] = Fourth.second;
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        AddPoint
+【函数功能】        以指定面的最远外侧点（视点）扩张凸包：
+                   自该面深度优先搜索可见面，可见面与不可见面之间的边
+                   构成地平线；每条地平线边与视点组成新面，
+                   新面之间按地平线顶点相接；
+                   可见面删除，其外侧点（除视点）重新划分到新面
+【参数】            size_t FaceIndex：面下标（外侧点集非空）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void ConvexHull3D::AddPoint(size_t FaceIndex){
+    size_t Eye = m_Faces[FaceIndex].Farthest;
+    m_ullVisitRound++;
+    //可见面搜索
+    std::vector<size_t> Visible{FaceIndex};
+    m_Faces[FaceIndex].VisitMark = m_ullVisitRound;
+    m_Faces[FaceIndex].IsVisible = true;
+    //地平线边：起点、终点、对面的不可见面
+    std::vector<std::array<size_t, 3>> Horizon;
+    for (size_t v = 0; v < Visible.size(); v++) {
+        for (size_t k = 0; k < 3; k++) {
+            size_t Neighbor = m_Faces[Visible[v]].Neighbors[k];
+            HullFace& Other = m_Faces[Neighbor];
+            if (Other.VisitMark != m_ullVisitRound) {
+                Other.VisitMark = m_ullVisitRound;
+                Other.IsVisible = IsAbove(Other, Eye);
+                if (Other.IsVisible) {
+                    Visible.push_back(Neighbor);
+                }
+            }
+            if (!Other.IsVisible) {
+                Horizon.push_back(std::array<size_t, 3>{{
+                    m_Faces[Visible[v]].Vertices[k],
+                    m_Faces[Visible[v]].Vertices[(k + 1) % 3], Neighbor}});
+            }
+        }
+    }
+    //收集可见面的外侧点并删除可见面
+    std::vector<size_t> Candidates;
+    for (auto Index : Visible) {
+        HullFace& Face = m_Faces[Index];
+        for (auto Point : Face.Outside) {
+            if (Point != Eye) {
+                Candidates.push_back(Point);
+            }
+        }
+        Face.Outside = std::vector<size_t>();
+        Face.IsAlive = false;
+    }
+    //新面：地平线边(A, B)与视点组成(A, B, Eye)
+    size_t FirstNew = m_Faces.size();
+    std::vector<std::pair<size_t, size_t>> Starts;
+    std::vector<size_t> NewFaces;
+    for (size_t h = 0; h < Horizon.size(); h++) {
+        HullFace Face;
+        Face.Vertices = {{Horizon[h][0], Horizon[h][1], Eye}};
+        Face.Neighbors = {{Horizon[h][2], SIZE_MAX, SIZE_MAX}};
+        Face.Farthest = SIZE_MAX;
+        Face.IsAlive = true;
+        Face.VisitMark = 0;
+        Face.IsVisible = false;
+        //不可见面的对应边改接新面
+        HullFace& Other = m_Faces[Horizon[h][2]];
+        for (size_t k = 0; k < 3; k++) {
+            if (Other.Vertices[k] == Horizon[h][1]
+                && Other.Vertices[(k + 1) % 3] == Horizon[h][0]) {
+                Other.Neighbors[k] = FirstNew + h;
+            }
+        }
+        m_Faces.push_back(Face);
+        Starts.push_back(std::make_pair(Horizon[h][0], FirstNew + h));
+        NewFaces.push_back(FirstNew + h);
+    }
+    //新面(A, B, Eye)的边(B, Eye)与以B为起点的新面的边(Eye, B)相接
+    std::sort(Starts.begin(), Starts.end());
+    for (size_t h = 0; h < Horizon.size(); h++) {
+        size_t Next = std::lower_bound(Starts.begin(), Starts.end(),
+            std::make_pair(Horizon[h][1], size_t{0}))->second;
+        m_Faces[FirstNew + h].Neighbors[1] = Next;
+        m_Faces[Next].Neighbors[2] = FirstNew + h;
+    }
+    Partition(Candidates, NewFaces);
+}
@@ -0,0 +1,103 @@
+/*************************************************************************
+【文件名】                 ConvexHull3D.hpp
+【功能模块和目的】          三维点集凸包（Quickhull）类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef CONVEXHULL3D_HPP
+#define CONVEXHULL3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+
+/*************************************************************************
+【类名】             ConvexHull3D
+【功能】             三维点集的凸包，结果为外法向朝外（从外侧看逆时针）的
+                    三角形面
+【接口说明】         Quickhull：取坐标极值点构造初始四面体，
+                    全部点并行划分到其“外侧点集”所属的面；
+                    之后反复取某面最远的外侧点，找出其可见面与地平线，
+                    以地平线各边连接该点生成新面，可见面的外侧点
+                    重新划分到新面（点多时并行），不在任何新面外侧的点
+                    即在凸包内而被丢弃；
+                    可见性均由符号精确的Orient3D判定，共面点不视为外侧，
+                    因此组合结构始终一致；
+                    点集全部共面（含更低维）时凸包为空
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class ConvexHull3D{
+public:
+    //默认构造函数，空凸包
+    ConvexHull3D() = default;
+    //拷贝构造函数
+    ConvexHull3D(const ConvexHull3D& Source) = default;
+    //虚析构函数
+    virtual ~ConvexHull3D() = default;
+    //赋值运算符
+    ConvexHull3D& operator=(const ConvexHull3D& Source) = default;
+
+    //Setter
+    //由点集构建，点集全部共面时返回false（凸包为空）
+    bool Build(const std::vector<Coord3D>& Points);
+
+    //Getter
+    //凸包顶点坐标
+    const std::vector<Coord3D>& HullVertices() const;
+    //凸包三角形面的顶点下标（HullVertices中的下标）
+    const std::vector<std::array<size_t, 3>>& HullFaces() const;
+    //凸包顶点在输入点集中的下标
+    const std::vector<size_t>& HullVertexSources() const;
+
+private:
+    //构建过程中的面
+    class HullFace{
+    public:
+        //三个顶点（输入点下标），从外侧看逆时针
+        std::array<size_t, 3> Vertices;
+        //第k条边（Vertices[k]到Vertices[(k + 1) % 3]）对面的面
+        std::array<size_t, 3> Neighbors;
+        //外侧点集（输入点下标）
+        std::vector<size_t> Outside;
+        //外侧点集中距平面最远的点
+        size_t Farthest;
+        //是否仍在凸包上
+        bool IsAlive;
+        //可见性搜索标记（等于当前轮次时IsVisible有效）
+        size_t VisitMark;
+        //当前轮次是否可见
+        bool IsVisible;
+    };
+
+    //点是否严格位于面的外侧（精确判定）
+    bool IsAbove(const HullFace& Face, size_t Point) const;
+    //把候选点划分到指定面中第一个其严格在外侧的面，点多时并行
+    void Partition(const std::vector<size_t>& Candidates,
+        const std::vector<size_t>& FaceIndices);
+    //构造初始四面体，点集全部共面时返回false
+    bool InitialSimplex(std::array<size_t, 4>& Simplex) const;
+    //以指定面的最远外侧点扩张凸包
+    void AddPoint(size_t FaceIndex);
+
+    //输入点集（仅构建期间有效）
+    const std::vector<Coord3D>* m_pPoints{nullptr};
+    //全部面（含已删除的面）
+    std::vector<HullFace> m_Faces{};
+    //可见性搜索轮次
+    size_t m_ullVisitRound{0};
+    //凸包顶点坐标
+    std::vector<Coord3D> m_HullVertices{};
+    //凸包面
+    std::vector<std::array<size_t, 3>> m_HullFaces{};
+    //凸包顶点在输入点集中的下标
+    std::vector<size_t> m_HullVertexSources{};
+};
+
+#endif //CONVEXHULL3D_HPP
@@ -3,6 +3,8 @@
 【功能模块和目的】          三维三角形面类实现
 【开发者及日期】            梁思奇 2024/8/2
 【更改记录】               梁思奇 2024/8/2 完善类架构
+                          梁思奇 2026/10/18 增加求单位法向
+                          梁思奇 2026/10/18 面积改用叉积公式
 *************************************************************************/
 
 //自身类头文件
@@ -127,16 +129,36 @@ double Face3D::GetLength() const{
 【参数】            无
 【返回值】          double，面积值
 【开发者及日期】    梁思奇 2024/8/2
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 海伦公式改为叉积模长的一半：
+                   只需一次开方，狭长三角形不再因相减抵消失去精度，
+                   且与MeasureKernel3D批量计算的结果一致
 *************************************************************************/
 double Face3D::GetArea() const{
-    //三边长
-    double a = (Points[0] - Points[1]).Length();
-    double b = (Points[1] - Points[2]).Length();
-    double c = (Points[0] - Points[2]).Length();
-    //海伦公式求三角形面积
-    double p = (a + b + c) * 0.5;
-    return sqrt(p * (p - a) * (p - b) * (p - c));
+    Coord3D A = Points[0].GetXYZ();
+    //叉积模长的一半即三角形面积
+    return 0.5 * Geometry3D::Length(Geometry3D::Cross(
+        Geometry3D::Sub(Points[1].GetXYZ(), A),
+        Geometry3D::Sub(Points[2].GetXYZ(), A)));
+}
+
+/*************************************************************************
+【函数名称】        GetNormal const
+【函数功能】        求单位法向，方向为(P2 - P1)×(P3 - P1)（右手定则）
+【参数】            无
+【返回值】          Coord3D，单位法向，三点共线时为零向量
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Coord3D Face3D::GetNormal() const{
+    Coord3D A = Points[0].GetXYZ();
+    Coord3D Normal = Geometry3D::Cross(
+        Geometry3D::Sub(Points[1].GetXYZ(), A),
+        Geometry3D::Sub(Points[2].GetXYZ(), A));
+    double Length = Geometry3D::Length(Normal);
+    if (Length == 0.0) {
+        return Normal;
+    }
+    return Geometry3D::Scale(Normal, 1.0 / Length);
 }
 
 /*************************************************************************
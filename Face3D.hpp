@@ -3,6 +3,8 @@
 【功能模块和目的】          三维三角形面类声明
 【开发者及日期】            梁思奇 2024/8/2
 【更改记录】               梁思奇 2024/8/7 完善类架构
+                          梁思奇 2026/10/18 增加求单位法向
+                          梁思奇 2026/10/18 面积改用叉积公式
 *************************************************************************/
 
 #ifndef FACE3D_HPP
@@ -14,6 +16,8 @@
 #include <tuple>
 //std::string所属头文件
 #include <string>
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
 
 /*************************************************************************
 【类名】             Face3D
@@ -23,6 +27,9 @@
                     派生类接口：用于获取和设置现实属性
 【开发者及日期】      梁思奇 2024/8/2
 【更改记录】         梁思奇 2024/8/7 增加功能和改进类架构
+                    梁思奇 2026/10/18 增加求单位法向（右手定则，
+                    退化面为零向量）
+                    梁思奇 2026/10/18 面积改用叉积模长的一半
 *************************************************************************/
 class Face3D : public FixedElements3D{
 public:
@@ -51,6 +58,8 @@ public:
     double GetLength() const override;
     //求面积override
     double GetArea() const override;
+    //求单位法向（(P2 - P1)×(P3 - P1)方向，退化面为零向量）
+    Coord3D GetNormal() const;
     //获取三角形的三个顶点
     std::tuple<Point3D, Point3D, Point3D> GetPoints() const;
     //判断三角形是否与其他三角形相等
@@ -3,6 +3,7 @@
 【功能模块和目的】         特定数量三维点元素集合类声明
 【开发者及日期】           梁思奇 2024/7/31
 【更改记录】               梁思奇 2024/8/6 完善类架构
+                          梁思奇 2026/10/18 修正PointNum初始化顺序
 *************************************************************************/
 
 #ifndef FIXEDELEMENTS3D_HPP
@@ -83,8 +84,9 @@ public:
     //Getter数据成员
     //获取三维点元素
     const Point3DGroup& Points{m_Points};
-    //固定三维点数量
-    const size_t PointNum{m_Points.GetCountSize()};
+    //固定三维点数量（引用m_MaxPointsNum：m_Points声明在后，
+    //在此处调用其成员函数取值时尚未构造）
+    const size_t& PointNum{m_MaxPointsNum};
 
 protected:
     //可能派生的Setter（本类不需要）
@@ -0,0 +1,359 @@
+/*************************************************************************
+【文件名】                 Geometry3D.hpp
+【功能模块和目的】          轻量坐标类型与几何计算内核声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加三角形与线段坐标类型
+                          梁思奇 2026/10/18 增加包围盒相交与最近点计算
+*************************************************************************/
+
+#ifndef GEOMETRY3D_HPP
+#define GEOMETRY3D_HPP
+
+//std::array所属头文件
+#include <array>
+//std::sqrt、std::abs所属头文件
+#include <cmath>
+//std::min、std::max所属头文件
+#include <algorithm>
+//std::swap所属头文件
+#include <utility>
+
+//轻量三维坐标，用于批量几何计算（Point3D含虚表与引用成员，不适合大数组）
+using Coord3D = std::array<double, 3>;
+//三角形三顶点坐标
+using Triangle3D = std::array<Coord3D, 3>;
+//线段两端点坐标
+using Segment3D = std::array<Coord3D, 2>;
+
+/*************************************************************************
+【类名】             Geometry3D
+【功能】             几何计算内核，供加速结构与批量算法使用
+【接口说明】         只含静态函数：坐标的加、减、数乘、点乘、叉乘、模长，
+                    射线与三角形求交等；热点小函数在头文件内联实现
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加三角形、线段与包围盒相交判断，
+                    点到三角形、线段的最近点
+*************************************************************************/
+class Geometry3D{
+public:
+    //工具类，无需实例
+    Geometry3D() = delete;
+
+    //坐标加法
+    static Coord3D Add(const Coord3D& A, const Coord3D& B);
+    //坐标减法
+    static Coord3D Sub(const Coord3D& A, const Coord3D& B);
+    //坐标数乘
+    static Coord3D Scale(const Coord3D& A, double Scalar);
+    //点乘
+    static double Dot(const Coord3D& A, const Coord3D& B);
+    //叉乘
+    static Coord3D Cross(const Coord3D& A, const Coord3D& B);
+    //模长
+    static double Length(const Coord3D& A);
+    //射线与三角形求交（Moller-Trumbore），三角形以V0与两边E1、E2给出
+    static bool RayTriangle(const Coord3D& Origin, const Coord3D& Direction,
+        const Coord3D& V0, const Coord3D& E1, const Coord3D& E2,
+        double TMax, double& T, double& U, double& V);
+    //三角形与包围盒（含边界）是否相交（分离轴定理）
+    static bool TriangleBoxOverlap(const Triangle3D& Triangle,
+        const Coord3D& Min, const Coord3D& Max);
+    //线段与包围盒（含边界）是否相交
+    static bool SegmentBoxOverlap(const Segment3D& Segment,
+        const Coord3D& Min, const Coord3D& Max);
+    //三角形上距指定点最近的点
+    static Coord3D ClosestPointOnTriangle(const Coord3D& Point,
+        const Triangle3D& Triangle);
+    //线段上距指定点最近的点
+    static Coord3D ClosestPointOnSegment(const Coord3D& Point,
+        const Segment3D& Segment);
+};
+
+/*************************************************************************
+【函数名称】        Add
+【函数功能】        坐标加法
+【参数】            const Coord3D& A, const Coord3D& B
+【返回值】          Coord3D，A + B
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::Add(const Coord3D& A, const Coord3D& B){
+    return Coord3D{A[0] + B[0], A[1] + B[1], A[2] + B[2]};
+}
+
+/*************************************************************************
+【函数名称】        Sub
+【函数功能】        坐标减法
+【参数】            const Coord3D& A, const Coord3D& B
+【返回值】          Coord3D，A - B
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::Sub(const Coord3D& A, const Coord3D& B){
+    return Coord3D{A[0] - B[0], A[1] - B[1], A[2] - B[2]};
+}
+
+/*************************************************************************
+【函数名称】        Scale
+【函数功能】        坐标数乘
+【参数】            const Coord3D& A, double Scalar
+【返回值】          Coord3D，A * Scalar
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::Scale(const Coord3D& A, double Scalar){
+    return Coord3D{A[0] * Scalar, A[1] * Scalar, A[2] * Scalar};
+}
+
+/*************************************************************************
+【函数名称】        Dot
+【函数功能】        点乘
+【参数】            const Coord3D& A, const Coord3D& B
+【返回值】          double，点乘结果
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline double Geometry3D::Dot(const Coord3D& A, const Coord3D& B){
+    return A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+}
+
+/*************************************************************************
+【函数名称】        Cross
+【函数功能】        叉乘
+【参数】            const Coord3D& A, const Coord3D& B
+【返回值】          Coord3D，A × B
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::Cross(const Coord3D& A, const Coord3D& B){
+    return Coord3D{
+        A[1] * B[2] - A[2] * B[1],
+        A[2] * B[0] - A[0] * B[2],
+        A[0] * B[1] - A[1] * B[0]};
+}
+
+/*************************************************************************
+【函数名称】        Length
+【函数功能】        模长
+【参数】            const Coord3D& A
+【返回值】          double，模长
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline double Geometry3D::Length(const Coord3D& A){
+    return std::sqrt(Dot(A, A));
+}
+
+/*************************************************************************
+【函数名称】        RayTriangle
+【函数功能】        射线与三角形求交（Moller-Trumbore算法），双面可见
+【参数】            const Coord3D& Origin：射线起点
+                   const Coord3D& Direction：射线方向（无需单位化）
+                   const Coord3D& V0：三角形顶点0
+                   const Coord3D& E1, const Coord3D& E2：V1-V0与V2-V0
+                   double TMax：有效参数上限
+                   double& T, double& U, double& V：交点参数与重心坐标
+【返回值】          bool，在(0, TMax)内相交返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline bool Geometry3D::RayTriangle(const Coord3D& Origin,
+    const Coord3D& Direction, const Coord3D& V0, const Coord3D& E1,
+    const Coord3D& E2, double TMax, double& T, double& U, double& V){
+    Coord3D P = Cross(Direction, E2);
+    double Det = Dot(E1, P);
+    //射线与三角形平行或三角形退化
+    if (Det == 0.0) {
+        return false;
+    }
+    double InvDet = 1.0 / Det;
+    Coord3D S = Sub(Origin, V0);
+    double TempU = Dot(S, P) * InvDet;
+    if (TempU < 0.0 || TempU > 1.0) {
+        return false;
+    }
+    Coord3D Q = Cross(S, E1);
+    double TempV = Dot(Direction, Q) * InvDet;
+    if (TempV < 0.0 || TempU + TempV > 1.0) {
+        return false;
+    }
+    double TempT = Dot(E2, Q) * InvDet;
+    if (!(TempT > 0.0 && TempT < TMax)) {
+        return false;
+    }
+    T = TempT;
+    U = TempU;
+    V = TempV;
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        TriangleBoxOverlap
+【函数功能】        三角形与包围盒是否相交（分离轴定理）：依次检验
+                   3条盒轴×3条三角形边的9个叉积轴、3条盒轴与三角形法向，
+                   任一轴上投影不重叠即分离
+【参数】            const Triangle3D& Triangle：三角形
+                   const Coord3D& Min, const Coord3D& Max：包围盒角点
+【返回值】          bool，相交（含接触）返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline bool Geometry3D::TriangleBoxOverlap(const Triangle3D& Triangle,
+    const Coord3D& Min, const Coord3D& Max){
+    Coord3D Center{(Min[0] + Max[0]) * 0.5, (Min[1] + Max[1]) * 0.5,
+        (Min[2] + Max[2]) * 0.5};
+    Coord3D Half{(Max[0] - Min[0]) * 0.5, (Max[1] - Min[1]) * 0.5,
+        (Max[2] - Min[2]) * 0.5};
+    //以盒中心为原点
+    Triangle3D V{Sub(Triangle[0], Center), Sub(Triangle[1], Center),
+        Sub(Triangle[2], Center)};
+    std::array<Coord3D, 3> Edges{Sub(V[1], V[0]), Sub(V[2], V[1]),
+        Sub(V[0], V[2])};
+    //9个盒轴×边的叉积轴
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t a = 0; a < 3; a++) {
+            Coord3D Axis{0.0, 0.0, 0.0};
+            Axis[a] = 1.0;
+            Axis = Cross(Axis, Edges[i]);
+            double P0 = Dot(V[0], Axis);
+            double P1 = Dot(V[1], Axis);
+            double P2 = Dot(V[2], Axis);
+            double Radius = Half[0] * std::abs(Axis[0]) 
+                + Half[1] * std::abs(Axis[1]) + Half[2] * std::abs(Axis[2]);
+            if (std::min({P0, P1, P2}) > Radius 
+                || std::max({P0, P1, P2}) < -Radius) {
+                return false;
+            }
+        }
+    }
+    //3条盒轴
+    for (size_t a = 0; a < 3; a++) {
+        if (std::min({V[0][a], V[1][a], V[2][a]}) > Half[a]
+            || std::max({V[0][a], V[1][a], V[2][a]}) < -Half[a]) {
+            return false;
+        }
+    }
+    //三角形法向
+    Coord3D Normal = Cross(Edges[0], Edges[1]);
+    double Distance = Dot(Normal, V[0]);
+    double Radius = Half[0] * std::abs(Normal[0]) 
+        + Half[1] * std::abs(Normal[1]) + Half[2] * std::abs(Normal[2]);
+    return std::abs(Distance) <= Radius;
+}
+
+/*************************************************************************
+【函数名称】        SegmentBoxOverlap
+【函数功能】        线段与包围盒是否相交：沿线段参数[0, 1]逐轴裁剪
+【参数】            const Segment3D& Segment：线段
+                   const Coord3D& Min, const Coord3D& Max：包围盒角点
+【返回值】          bool，相交（含接触）返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline bool Geometry3D::SegmentBoxOverlap(const Segment3D& Segment,
+    const Coord3D& Min, const Coord3D& Max){
+    double TNear = 0.0;
+    double TFar = 1.0;
+    for (size_t a = 0; a < 3; a++) {
+        double Delta = Segment[1][a] - Segment[0][a];
+        if (Delta == 0.0) {
+            //与该轴平行，起点须在板内
+            if (Segment[0][a] < Min[a] || Segment[0][a] > Max[a]) {
+                return false;
+            }
+            continue;
+        }
+        double T1 = (Min[a] - Segment[0][a]) / Delta;
+        double T2 = (Max[a] - Segment[0][a]) / Delta;
+        if (T1 > T2) {
+            std::swap(T1, T2);
+        }
+        TNear = std::max(TNear, T1);
+        TFar = std::min(TFar, T2);
+        if (TNear > TFar) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        ClosestPointOnTriangle
+【函数功能】        三角形上距指定点最近的点：按重心坐标区域
+                   （顶点、边、内部）分类求解
+【参数】            const Coord3D& Point：指定点
+                   const Triangle3D& Triangle：三角形
+【返回值】          Coord3D，最近点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::ClosestPointOnTriangle(const Coord3D& Point,
+    const Triangle3D& Triangle){
+    const Coord3D& A = Triangle[0];
+    const Coord3D& B = Triangle[1];
+    const Coord3D& C = Triangle[2];
+    Coord3D AB = Sub(B, A);
+    Coord3D AC = Sub(C, A);
+    Coord3D AP = Sub(Point, A);
+    double D1 = Dot(AB, AP);
+    double D2 = Dot(AC, AP);
+    //顶点A区域
+    if (D1 <= 0.0 && D2 <= 0.0) {
+        return A;
+    }
+    Coord3D BP = Sub(Point, B);
+    double D3 = Dot(AB, BP);
+    double D4 = Dot(AC, BP);
+    //顶点B区域
+    if (D3 >= 0.0 && D4 <= D3) {
+        return B;
+    }
+    //边AB区域
+    double VC = D1 * D4 - D3 * D2;
+    if (VC <= 0.0 && D1 >= 0.0 && D3 <= 0.0) {
+        return Add(A, Scale(AB, D1 / (D1 - D3)));
+    }
+    Coord3D CP = Sub(Point, C);
+    double D5 = Dot(AB, CP);
+    double D6 = Dot(AC, CP);
+    //顶点C区域
+    if (D6 >= 0.0 && D5 <= D6) {
+        return C;
+    }
+    //边AC区域
+    double VB = D5 * D2 - D1 * D6;
+    if (VB <= 0.0 && D2 >= 0.0 && D6 <= 0.0) {
+        return Add(A, Scale(AC, D2 / (D2 - D6)));
+    }
+    //边BC区域
+    double VA = D3 * D6 - D5 * D4;
+    if (VA <= 0.0 && (D4 - D3) >= 0.0 && (D5 - D6) >= 0.0) {
+        return Add(B, Scale(Sub(C, B), (D4 - D3) / ((D4 - D3) + (D5 - D6))));
+    }
+    //内部区域（退化三角形已在上述分支返回）
+    double Denom = 1.0 / (VA + VB + VC);
+    return Add(A, Add(Scale(AB, VB * Denom), Scale(AC, VC * Denom)));
+}
+
+/*************************************************************************
+【函数名称】        ClosestPointOnSegment
+【函数功能】        线段上距指定点最近的点
+【参数】            const Coord3D& Point：指定点
+                   const Segment3D& Segment：线段
+【返回值】          Coord3D，最近点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline Coord3D Geometry3D::ClosestPointOnSegment(const Coord3D& Point,
+    const Segment3D& Segment){
+    Coord3D Delta = Sub(Segment[1], Segment[0]);
+    double LengthSquare = Dot(Delta, Delta);
+    if (LengthSquare == 0.0) {
+        return Segment[0];
+    }
+    double T = Dot(Sub(Point, Segment[0]), Delta) / LengthSquare;
+    T = std::min(1.0, std::max(0.0, T));
+    return Add(Segment[0], Scale(Delta, T));
+}
+
+#endif //GEOMETRY3D_HPP
@@ -3,6 +3,7 @@
 【功能模块和目的】         通用集合类模版
 【开发者及日期】           梁思奇 2024/7/30
 【更改记录】              梁思奇 2024/8/5 参考范老师Demo的Set进行大改
+                         梁思奇 2026/10/18 常量下标运算符改为返回常引用
 *************************************************************************/
 
 #ifndef GROUP_HPP
@@ -28,6 +29,7 @@
                     包含了集合的增、删、改、清空等操作
 【开发者及日期】      梁思奇 2024/7/30
 【更改记录】         梁思奇 2024/8/5 参考范老师Demo的Set进行大改
+                    梁思奇 2026/10/18 常量下标运算符改为返回常引用
 *************************************************************************/
 template<class T>
 class Group{
@@ -134,8 +136,8 @@ public:
     bool operator==(const Group& Group1) const;
     //判断是否不等
     bool operator!=(const Group& Group1) const;
-    //取元素值
-    T operator[](size_t Index) const;    
+    //取元素值（常引用，避免逐次拷贝元素）
+    const T& operator[](size_t Index) const;    
     //判断元素是否存在
     bool IsExist(const T& Element) const;
     //判断集合是否为空
@@ -576,12 +578,13 @@ Group<T> Group<T>::operator^(const Group& Group1) const{
 【函数名称】        operator[]
 【函数功能】        取元素值Getter，根据指定的索引返回集合中的元素值
 【参数】            size_t Index：元素的索引
-【返回值】          指定索引处的元素值T
+【返回值】          指定索引处元素的常引用const T&
 【开发者及日期】    梁思奇 2024/7/30
-【更改记录】
+【更改记录】        梁思奇 2026/10/18 返回值改为常引用：批量读取坐标时
+                   不再逐次拷贝构造、析构元素
 *************************************************************************/
 template<class T>
-T Group<T>::operator[](size_t Index) const{
+const T& Group<T>::operator[](size_t Index) const{
     //检查索引是否越界
     if (Index >= m_Elements.size()) {
         throw INDEX_OUT_OF_RANGE();
@@ -0,0 +1,402 @@
+/*************************************************************************
+【文件名】                 HalfEdgeMesh3D.cpp
+【功能模块和目的】          三角网格半边拓扑结构类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加绕向不一致边统计
+*************************************************************************/
+
+//自身类头文件
+#include "HalfEdgeMesh3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::sort、std::unique所属头文件
+#include <algorithm>
+//std::min、std::max、std::pair所属头文件
+#include <utility>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        构建半边结构：并行生成各半边的无向边键（两顶点升序）
+                   并排序，相邻同键半边归为一条边，恰两条时互为对边；
+                   再按起点计数排序得到顶点出半边表
+【参数】            const MeshIndex3D& Mesh：网格索引
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 统计绕向不一致边
+*************************************************************************/
+void HalfEdgeMesh3D::Build(const MeshIndex3D& Mesh){
+    m_FaceVertices = Mesh.FaceVertices;
+    size_t HalfEdgeCount = m_FaceVertices.size() * 3;
+    size_t VertexCount = Mesh.Vertices.size();
+    //无向边键与半边编号
+    using EdgeKey = std::pair<std::array<size_t, 2>, size_t>;
+    std::vector<EdgeKey> Keys(HalfEdgeCount);
+    Parallel::For(0, HalfEdgeCount, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t From = Origin(i);
+            size_t To = Target(i);
+            Keys[i] = EdgeKey{{{std::min(From, To), std::max(From, To)}}, i};
+        }
+    });
+    Parallel::Sort(Keys.begin(), Keys.end(),
+        [](const EdgeKey& Lhs, const EdgeKey& Rhs){return Lhs < Rhs;});
+    //相邻同键分组
+    m_Edges.clear();
+    m_EdgeStarts.clear();
+    m_EdgeHalfEdgeList.resize(HalfEdgeCount);
+    for (size_t i = 0; i < HalfEdgeCount; i++) {
+        if (i == 0 || Keys[i].first != Keys[i - 1].first) {
+            m_Edges.push_back(Keys[i].first);
+            m_EdgeStarts.push_back(i);
+        }
+        m_EdgeHalfEdgeList[i] = Keys[i].second;
+    }
+    m_EdgeStarts.push_back(HalfEdgeCount);
+    //并行确定各半边的边与对边
+    m_Twins.assign(HalfEdgeCount, NONE);
+    m_HalfEdgeEdges.resize(HalfEdgeCount);
+    Parallel::For(0, m_Edges.size(), [&](size_t First, size_t Last){
+        for (size_t e = First; e < Last; e++) {
+            size_t Begin = m_EdgeStarts[e];
+            size_t End = m_EdgeStarts[e + 1];
+            for (size_t k = Begin; k < End; k++) {
+                m_HalfEdgeEdges[m_EdgeHalfEdgeList[k]] = e;
+            }
+            if (End - Begin == 2) {
+                m_Twins[m_EdgeHalfEdgeList[Begin]]
+                    = m_EdgeHalfEdgeList[Begin + 1];
+                m_Twins[m_EdgeHalfEdgeList[Begin + 1]]
+                    = m_EdgeHalfEdgeList[Begin];
+            }
+        }
+    });
+    m_ullBoundaryEdgeNum = 0;
+    m_ullNonManifoldEdgeNum = 0;
+    m_ullInconsistentEdgeNum = 0;
+    for (size_t e = 0; e < m_Edges.size(); e++) {
+        size_t Count = m_EdgeStarts[e + 1] - m_EdgeStarts[e];
+        if (Count == 1) {
+            m_ullBoundaryEdgeNum++;
+        }
+        else if (Count > 2) {
+            m_ullNonManifoldEdgeNum++;
+        }
+        //两面绕向一致时，共享边的两条半边方向相反
+        else if (Origin(m_EdgeHalfEdgeList[m_EdgeStarts[e]])
+            == Origin(m_EdgeHalfEdgeList[m_EdgeStarts[e] + 1])) {
+            m_ullInconsistentEdgeNum++;
+        }
+    }
+    //按起点计数排序（组内半边编号升序）
+    m_VertexStarts.assign(VertexCount + 1, 0);
+    for (size_t i = 0; i < HalfEdgeCount; i++) {
+        m_VertexStarts[Origin(i) + 1]++;
+    }
+    for (size_t v = 0; v < VertexCount; v++) {
+        m_VertexStarts[v + 1] += m_VertexStarts[v];
+    }
+    m_VertexHalfEdgeList.resize(HalfEdgeCount);
+    std::vector<size_t> Cursor(m_VertexStarts.begin(),
+        m_VertexStarts.end() - 1);
+    for (size_t i = 0; i < HalfEdgeCount; i++) {
+        m_VertexHalfEdgeList[Cursor[Origin(i)]++] = i;
+    }
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        Next
+【函数功能】        同一面内的下一条半边
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，下一条半边编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Next(size_t HalfEdge) const{
+    return HalfEdge % 3 == 2 ? HalfEdge - 2 : HalfEdge + 1;
+}
+
+/*************************************************************************
+【函数名称】        Prev
+【函数功能】        同一面内的上一条半边
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，上一条半边编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Prev(size_t HalfEdge) const{
+    return HalfEdge % 3 == 0 ? HalfEdge + 2 : HalfEdge - 1;
+}
+
+/*************************************************************************
+【函数名称】        Twin
+【函数功能】        对边
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，对边编号，边界边或非流形边为NONE
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Twin(size_t HalfEdge) const{
+    return m_Twins[HalfEdge];
+}
+
+/*************************************************************************
+【函数名称】        Face
+【函数功能】        半边所属面
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，面标签
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Face(size_t HalfEdge) const{
+    return HalfEdge / 3;
+}
+
+/*************************************************************************
+【函数名称】        Origin
+【函数功能】        半边起点
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，顶点下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Origin(size_t HalfEdge) const{
+    return m_FaceVertices[HalfEdge / 3][HalfEdge % 3];
+}
+
+/*************************************************************************
+【函数名称】        Target
+【函数功能】        半边终点
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，顶点下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Target(size_t HalfEdge) const{
+    return Origin(Next(HalfEdge));
+}
+
+/*************************************************************************
+【函数名称】        Edge
+【函数功能】        半边所属无向边
+【参数】            size_t HalfEdge：半边编号
+【返回值】          size_t，无向边下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::Edge(size_t HalfEdge) const{
+    return m_HalfEdgeEdges[HalfEdge];
+}
+
+/*************************************************************************
+【函数名称】        EdgeVertices
+【函数功能】        无向边的两个顶点
+【参数】            size_t EdgeIndex：无向边下标
+【返回值】          const std::array<size_t, 2>&，顶点下标（升序）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::array<size_t, 2>& HalfEdgeMesh3D::EdgeVertices(
+    size_t EdgeIndex) const{
+    return m_Edges[EdgeIndex];
+}
+
+/*************************************************************************
+【函数名称】        EdgeFaceNum
+【函数功能】        共享无向边的面数
+【参数】            size_t EdgeIndex：无向边下标
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::EdgeFaceNum(size_t EdgeIndex) const{
+    return m_EdgeStarts[EdgeIndex + 1] - m_EdgeStarts[EdgeIndex];
+}
+
+/*************************************************************************
+【函数名称】        EdgeHalfEdges
+【函数功能】        共享无向边的全部半边
+【参数】            size_t EdgeIndex：无向边下标
+                   std::vector<size_t>& HalfEdges：半边编号（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh3D::EdgeHalfEdges(size_t EdgeIndex,
+    std::vector<size_t>& HalfEdges) const{
+    HalfEdges.assign(
+        m_EdgeHalfEdgeList.begin() + m_EdgeStarts[EdgeIndex],
+        m_EdgeHalfEdgeList.begin() + m_EdgeStarts[EdgeIndex + 1]);
+}
+
+/*************************************************************************
+【函数名称】        FaceNeighbors
+【函数功能】        与面共边的相邻面：遍历三条边的全部半边
+【参数】            size_t FaceTag：面标签
+                   std::vector<size_t>& FaceTags：相邻面标签（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh3D::FaceNeighbors(size_t FaceTag,
+    std::vector<size_t>& FaceTags) const{
+    FaceTags.clear();
+    for (size_t k = 0; k < 3; k++) {
+        size_t EdgeIndex = m_HalfEdgeEdges[FaceTag * 3 + k];
+        for (size_t i = m_EdgeStarts[EdgeIndex];
+            i < m_EdgeStarts[EdgeIndex + 1]; i++) {
+            size_t Neighbor = Face(m_EdgeHalfEdgeList[i]);
+            if (Neighbor != FaceTag) {
+                FaceTags.push_back(Neighbor);
+            }
+        }
+    }
+    std::sort(FaceTags.begin(), FaceTags.end());
+    FaceTags.erase(std::unique(FaceTags.begin(), FaceTags.end()),
+        FaceTags.end());
+}
+
+/*************************************************************************
+【函数名称】        VertexRing
+【函数功能】        顶点的一环邻接顶点：每条出半边所在面的另两个顶点
+【参数】            size_t Vertex：顶点下标
+                   std::vector<size_t>& Vertices：邻接顶点（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh3D::VertexRing(size_t Vertex,
+    std::vector<size_t>& Vertices) const{
+    Vertices.clear();
+    for (size_t i = m_VertexStarts[Vertex];
+        i < m_VertexStarts[Vertex + 1]; i++) {
+        size_t HalfEdge = m_VertexHalfEdgeList[i];
+        Vertices.push_back(Target(HalfEdge));
+        Vertices.push_back(Origin(Prev(HalfEdge)));
+    }
+    std::sort(Vertices.begin(), Vertices.end());
+    Vertices.erase(std::unique(Vertices.begin(), Vertices.end()),
+        Vertices.end());
+}
+
+/*************************************************************************
+【函数名称】        VertexFaces
+【函数功能】        包含顶点的面
+【参数】            size_t Vertex：顶点下标
+                   std::vector<size_t>& FaceTags：面标签（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh3D::VertexFaces(size_t Vertex,
+    std::vector<size_t>& FaceTags) const{
+    FaceTags.clear();
+    //出半边组内编号升序，面标签随之升序
+    for (size_t i = m_VertexStarts[Vertex];
+        i < m_VertexStarts[Vertex + 1]; i++) {
+        FaceTags.push_back(Face(m_VertexHalfEdgeList[i]));
+    }
+}
+
+/*************************************************************************
+【函数名称】        VertexHalfEdges
+【函数功能】        顶点的全部出半边
+【参数】            size_t Vertex：顶点下标
+                   std::vector<size_t>& HalfEdges：半边编号（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh3D::VertexHalfEdges(size_t Vertex,
+    std::vector<size_t>& HalfEdges) const{
+    HalfEdges.assign(
+        m_VertexHalfEdgeList.begin() + m_VertexStarts[Vertex],
+        m_VertexHalfEdgeList.begin() + m_VertexStarts[Vertex + 1]);
+}
+
+/*************************************************************************
+【函数名称】        VertexNum
+【函数功能】        获取顶点数
+【参数】            无
+【返回值】          size_t，顶点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::VertexNum() const{
+    return m_VertexStarts.empty() ? 0 : m_VertexStarts.size() - 1;
+}
+
+/*************************************************************************
+【函数名称】        FaceNum
+【函数功能】        获取面数
+【参数】            无
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::FaceNum() const{
+    return m_FaceVertices.size();
+}
+
+/*************************************************************************
+【函数名称】        HalfEdgeNum
+【函数功能】        获取半边数
+【参数】            无
+【返回值】          size_t，半边数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::HalfEdgeNum() const{
+    return m_Twins.size();
+}
+
+/*************************************************************************
+【函数名称】        EdgeNum
+【函数功能】        获取无向边数
+【参数】            无
+【返回值】          size_t，无向边数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::EdgeNum() const{
+    return m_Edges.size();
+}
+
+/*************************************************************************
+【函数名称】        BoundaryEdgeNum
+【函数功能】        获取边界边（只属于一个面）数
+【参数】            无
+【返回值】          size_t，边界边数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::BoundaryEdgeNum() const{
+    return m_ullBoundaryEdgeNum;
+}
+
+/*************************************************************************
+【函数名称】        NonManifoldEdgeNum
+【函数功能】        获取非流形边（属于三个及以上面）数
+【参数】            无
+【返回值】          size_t，非流形边数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::NonManifoldEdgeNum() const{
+    return m_ullNonManifoldEdgeNum;
+}
+
+/*************************************************************************
+【函数名称】        InconsistentEdgeNum
+【函数功能】        获取绕向不一致边（恰属于两个面且两条半边同向）数
+【参数】            无
+【返回值】          size_t，绕向不一致边数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh3D::InconsistentEdgeNum() const{
+    return m_ullInconsistentEdgeNum;
+}
@@ -0,0 +1,130 @@
+/*************************************************************************
+【文件名】                 HalfEdgeMesh3D.hpp
+【功能模块和目的】          三角网格半边拓扑结构类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加绕向不一致边统计
+*************************************************************************/
+
+#ifndef HALFEDGEMESH3D_HPP
+#define HALFEDGEMESH3D_HPP
+
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//SIZE_MAX所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+
+/*************************************************************************
+【类名】             HalfEdgeMesh3D
+【功能】             三角网格半边拓扑结构，O(1)邻域遍历
+【接口说明】         由网格索引构建：面f的第k条半边编号为3f+k，
+                    自顶点k指向顶点(k+1)%3，故下一条、上一条半边与
+                    所属面无需存储；半边按无向边键并行排序后相邻分组，
+                    得到边表与对边（恰两条半边的边互为对边，
+                    边界边与非流形边无对边）；
+                    顶点的出半边以计数排序存为压缩行表，
+                    非流形顶点的邻域同样完整
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加绕向不一致边统计：恰两条半边
+                    方向相同（两面绕向相反）的边
+*************************************************************************/
+class HalfEdgeMesh3D{
+public:
+    //默认构造函数，空结构
+    HalfEdgeMesh3D() = default;
+    //拷贝构造函数
+    HalfEdgeMesh3D(const HalfEdgeMesh3D& Source) = default;
+    //虚析构函数
+    virtual ~HalfEdgeMesh3D() = default;
+    //赋值运算符
+    HalfEdgeMesh3D& operator=(const HalfEdgeMesh3D& Source) = default;
+
+    //Setter
+    //由网格索引的面顶点下标并行构建（线不参与）
+    void Build(const MeshIndex3D& Mesh);
+
+    //Getter
+    //半边遍历（参数均不检查越界）
+    //下一条半边（同一面内）
+    size_t Next(size_t HalfEdge) const;
+    //上一条半边（同一面内）
+    size_t Prev(size_t HalfEdge) const;
+    //对边，无对边（边界或非流形）为NONE
+    size_t Twin(size_t HalfEdge) const;
+    //所属面标签
+    size_t Face(size_t HalfEdge) const;
+    //起点顶点下标
+    size_t Origin(size_t HalfEdge) const;
+    //终点顶点下标
+    size_t Target(size_t HalfEdge) const;
+    //所属无向边下标
+    size_t Edge(size_t HalfEdge) const;
+
+    //边查询
+    //无向边的两个顶点下标（升序）
+    const std::array<size_t, 2>& EdgeVertices(size_t EdgeIndex) const;
+    //共享该边的面数（1为边界边，大于2为非流形边）
+    size_t EdgeFaceNum(size_t EdgeIndex) const;
+    //共享该边的全部半边
+    void EdgeHalfEdges(size_t EdgeIndex, std::vector<size_t>& HalfEdges) const;
+
+    //邻域查询
+    //与面共边的相邻面（每条边的全部其他面，升序去重）
+    void FaceNeighbors(size_t FaceTag, std::vector<size_t>& FaceTags) const;
+    //顶点的一环邻接顶点（升序去重）
+    void VertexRing(size_t Vertex, std::vector<size_t>& Vertices) const;
+    //包含顶点的面（升序）
+    void VertexFaces(size_t Vertex, std::vector<size_t>& FaceTags) const;
+    //顶点的全部出半边
+    void VertexHalfEdges(size_t Vertex, std::vector<size_t>& HalfEdges) const;
+
+    //统计
+    //顶点数
+    size_t VertexNum() const;
+    //面数
+    size_t FaceNum() const;
+    //半边数
+    size_t HalfEdgeNum() const;
+    //无向边数
+    size_t EdgeNum() const;
+    //边界边数
+    size_t BoundaryEdgeNum() const;
+    //非流形边数
+    size_t NonManifoldEdgeNum() const;
+    //绕向不一致边数
+    size_t InconsistentEdgeNum() const;
+
+    //静态常量：无对应元素
+    static constexpr size_t NONE{SIZE_MAX};
+
+private:
+    //各面的三个顶点下标
+    std::vector<std::array<size_t, 3>> m_FaceVertices{};
+    //各半边的对边
+    std::vector<size_t> m_Twins{};
+    //各半边所属无向边
+    std::vector<size_t> m_HalfEdgeEdges{};
+    //各无向边的顶点下标
+    std::vector<std::array<size_t, 2>> m_Edges{};
+    //按无向边分组的半边，第e条边的半边为
+    //[m_EdgeStarts[e], m_EdgeStarts[e + 1])
+    std::vector<size_t> m_EdgeHalfEdgeList{};
+    std::vector<size_t> m_EdgeStarts{};
+    //按起点分组的半边，顶点v的出半边为
+    //[m_VertexStarts[v], m_VertexStarts[v + 1])
+    std::vector<size_t> m_VertexHalfEdgeList{};
+    std::vector<size_t> m_VertexStarts{};
+    //边界边数
+    size_t m_ullBoundaryEdgeNum{0};
+    //非流形边数
+    size_t m_ullNonManifoldEdgeNum{0};
+    //绕向不一致边数
+    size_t m_ullInconsistentEdgeNum{0};
+};
+
+#endif //HALFEDGEMESH3D_HPP
@@ -0,0 +1,384 @@
+/*************************************************************************
+【文件名】                 KDTree3D.cpp
+【功能模块和目的】          三维点k-d树类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "KDTree3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::thread所属头文件
+#include <thread>
+//std::nth_element、std::push_heap、std::sort_heap所属头文件
+#include <algorithm>
+//std::numeric_limits所属头文件
+#include <limits>
+//std::sqrt所属头文件
+#include <cmath>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        由点列表构建k-d树：递归排列点下标，
+                   上层子树交给不同线程，最后按树序整理点坐标
+【参数】            const std::vector<Coord3D>& Points：点列表
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::Build(const std::vector<Coord3D>& Points){
+    size_t Count = Points.size();
+    m_Indices.resize(Count);
+    m_Axes.assign(Count, 0);
+    for (size_t i = 0; i < Count; i++) {
+        m_Indices[i] = i;
+    }
+    //全部点的包围盒
+    m_Min = Coord3D{0.0, 0.0, 0.0};
+    m_Max = Coord3D{0.0, 0.0, 0.0};
+    if (Count > 0) {
+        m_Min = Points[0];
+        m_Max = Points[0];
+    }
+    for (const auto& TempPoint : Points) {
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            m_Min[Axis] = std::min(m_Min[Axis], TempPoint[Axis]);
+            m_Max[Axis] = std::max(m_Max[Axis], TempPoint[Axis]);
+        }
+    }
+    //上层子树并行的深度：约log2(线程数) + 1
+    size_t ParallelDepth = 1;
+    while ((static_cast<size_t>(1) << ParallelDepth)
+        < Parallel::ThreadCount() * 2) {
+        ParallelDepth++;
+    }
+    BuildRange(Points, 0, Count, ParallelDepth);
+    //按树序整理点坐标
+    m_Points.resize(Count);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            m_Points[i] = Points[m_Indices[i]];
+        }
+    });
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        KNearest
+【函数功能】        K近邻查询：先进入查询点所在一侧，另一侧仅当划分面距离
+                   小于当前第K近距离时才访问
+【参数】            const Coord3D& Point：查询点
+                   size_t K：近邻数
+                   std::vector<size_t>& Indices：近邻点下标（重写）
+                   std::vector<double>& Distances：对应距离（重写）
+【返回值】          无，点数不足K时返回全部点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::KNearest(const Coord3D& Point, size_t K,
+    std::vector<size_t>& Indices, std::vector<double>& Distances) const{
+    Indices.clear();
+    Distances.clear();
+    if (K == 0 || m_Points.empty()) {
+        return;
+    }
+    std::vector<Candidate> Heap;
+    Heap.reserve(K + 1);
+    KNearestRange(0, m_Points.size(), Point, K, Heap);
+    //最大堆排序后即为升序
+    std::sort_heap(Heap.begin(), Heap.end());
+    for (const auto& TempCandidate : Heap) {
+        Indices.push_back(m_Indices[TempCandidate.second]);
+        Distances.push_back(std::sqrt(TempCandidate.first));
+    }
+}
+
+/*************************************************************************
+【函数名称】        RadiusSearch
+【函数功能】        半径查询：划分面距离超过半径的一侧不访问
+【参数】            const Coord3D& Point：查询点
+                   double Radius：半径
+                   std::vector<size_t>& Indices：距离不超过半径的点下标（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::RadiusSearch(const Coord3D& Point, double Radius,
+    std::vector<size_t>& Indices) const{
+    Indices.clear();
+    if (!(Radius >= 0.0)) {
+        return;
+    }
+    RadiusRange(0, m_Points.size(), Point, Radius * Radius, Indices);
+    std::sort(Indices.begin(), Indices.end());
+}
+
+/*************************************************************************
+【函数名称】        BoxCount
+【函数功能】        统计包围盒内的点数：子树所占空间完全在盒内时直接计入
+                   子树点数，与盒不相交时跳过
+【参数】            const Coord3D& Min, const Coord3D& Max：包围盒角点
+【返回值】          size_t，盒内（含边界）点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t KDTree3D::BoxCount(const Coord3D& Min, const Coord3D& Max) const{
+    return BoxCountRange(0, m_Points.size(), m_Min, m_Max, Min, Max);
+}
+
+/*************************************************************************
+【函数名称】        KNearestBatch
+【函数功能】        批量K近邻查询，各查询点分配给全部线程并行
+【参数】            const std::vector<Coord3D>& Points：查询点
+                   size_t K：近邻数
+                   std::vector<std::vector<size_t>>& Indices：
+                   各查询点的近邻下标，按距离升序（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::KNearestBatch(const std::vector<Coord3D>& Points, size_t K,
+    std::vector<std::vector<size_t>>& Indices) const{
+    Indices.assign(Points.size(), std::vector<size_t>{});
+    Parallel::For(0, Points.size(), [&](size_t First, size_t Last){
+        std::vector<double> Distances;
+        for (size_t i = First; i < Last; i++) {
+            KNearest(Points[i], K, Indices[i], Distances);
+        }
+    }, 256);
+}
+
+/*************************************************************************
+【函数名称】        RadiusSearchBatch
+【函数功能】        批量半径查询，各查询点分配给全部线程并行
+【参数】            const std::vector<Coord3D>& Points：查询点
+                   double Radius：半径
+                   std::vector<std::vector<size_t>>& Indices：
+                   各查询点半径内的点下标（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::RadiusSearchBatch(const std::vector<Coord3D>& Points,
+    double Radius, std::vector<std::vector<size_t>>& Indices) const{
+    Indices.assign(Points.size(), std::vector<size_t>{});
+    Parallel::For(0, Points.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            RadiusSearch(Points[i], Radius, Indices[i]);
+        }
+    }, 256);
+}
+
+/*************************************************************************
+【函数名称】        BoxCountBatch
+【函数功能】        批量包围盒计数，各查询盒分配给全部线程并行
+【参数】            const std::vector<Coord3D>& Mins：各盒最小角点
+                   const std::vector<Coord3D>& Maxs：各盒最大角点
+                   std::vector<size_t>& Counts：各盒内点数（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::BoxCountBatch(const std::vector<Coord3D>& Mins,
+    const std::vector<Coord3D>& Maxs, std::vector<size_t>& Counts) const{
+    size_t Count = std::min(Mins.size(), Maxs.size());
+    Counts.assign(Count, 0);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            Counts[i] = BoxCount(Mins[i], Maxs[i]);
+        }
+    }, 256);
+}
+
+/*************************************************************************
+【函数名称】        PointNum
+【函数功能】        获取点数
+【参数】            无
+【返回值】          size_t，点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t KDTree3D::PointNum() const{
+    return m_Points.size();
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        BuildRange
+【函数功能】        递归构建：取区间包围盒最长轴，以中点为中位数划分，
+                   剩余并行层数大于0且区间较大时左半交给新线程
+【参数】            const std::vector<Coord3D>& Points：点列表
+                   size_t Begin, size_t End：区间
+                   size_t ParallelDepth：剩余并行层数
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::BuildRange(const std::vector<Coord3D>& Points, size_t Begin,
+    size_t End, size_t ParallelDepth){
+    if (End - Begin <= 1) {
+        return;
+    }
+    //区间包围盒最长轴
+    Coord3D Min = Points[m_Indices[Begin]];
+    Coord3D Max = Min;
+    for (size_t i = Begin + 1; i < End; i++) {
+        const Coord3D& TempPoint = Points[m_Indices[i]];
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Min[Axis] = std::min(Min[Axis], TempPoint[Axis]);
+            Max[Axis] = std::max(Max[Axis], TempPoint[Axis]);
+        }
+    }
+    size_t SplitAxis = 0;
+    for (size_t Axis = 1; Axis < 3; Axis++) {
+        if (Max[Axis] - Min[Axis] > Max[SplitAxis] - Min[SplitAxis]) {
+            SplitAxis = Axis;
+        }
+    }
+    size_t Mid = Begin + (End - Begin) / 2;
+    std::nth_element(m_Indices.begin() + Begin, m_Indices.begin() + Mid,
+        m_Indices.begin() + End, [&](size_t Lhs, size_t Rhs){
+            return Points[Lhs][SplitAxis] < Points[Rhs][SplitAxis];});
+    m_Axes[Mid] = static_cast<uint8_t>(SplitAxis);
+    //左右两半互不重叠，可并行构建
+    if (ParallelDepth > 0 && End - Begin >= Parallel::DEFAULT_MIN_CHUNK * 4) {
+        std::thread Worker([&](){
+            BuildRange(Points, Begin, Mid, ParallelDepth - 1);
+        });
+        BuildRange(Points, Mid + 1, End, ParallelDepth - 1);
+        Worker.join();
+    }
+    else {
+        BuildRange(Points, Begin, Mid, 0);
+        BuildRange(Points, Mid + 1, End, 0);
+    }
+}
+
+/*************************************************************************
+【函数名称】        KNearestRange
+【函数功能】        递归K近邻查询
+【参数】            size_t Begin, size_t End：子树区间
+                   const Coord3D& Point：查询点
+                   size_t K：近邻数
+                   std::vector<Candidate>& Heap：候选最大堆（不超过K个）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::KNearestRange(size_t Begin, size_t End, const Coord3D& Point,
+    size_t K, std::vector<Candidate>& Heap) const{
+    if (Begin >= End) {
+        return;
+    }
+    size_t Mid = Begin + (End - Begin) / 2;
+    const Coord3D& TempPoint = m_Points[Mid];
+    Coord3D Diff = Geometry3D::Sub(TempPoint, Point);
+    double DistanceSquare = Geometry3D::Dot(Diff, Diff);
+    if (Heap.size() < K) {
+        Heap.push_back(Candidate{DistanceSquare, Mid});
+        std::push_heap(Heap.begin(), Heap.end());
+    }
+    else if (DistanceSquare < Heap.front().first) {
+        std::pop_heap(Heap.begin(), Heap.end());
+        Heap.back() = Candidate{DistanceSquare, Mid};
+        std::push_heap(Heap.begin(), Heap.end());
+    }
+    //先访问查询点所在一侧
+    double Delta = Point[m_Axes[Mid]] - TempPoint[m_Axes[Mid]];
+    if (Delta < 0.0) {
+        KNearestRange(Begin, Mid, Point, K, Heap);
+        if (Heap.size() < K || Delta * Delta < Heap.front().first) {
+            KNearestRange(Mid + 1, End, Point, K, Heap);
+        }
+    }
+    else {
+        KNearestRange(Mid + 1, End, Point, K, Heap);
+        if (Heap.size() < K || Delta * Delta < Heap.front().first) {
+            KNearestRange(Begin, Mid, Point, K, Heap);
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        RadiusRange
+【函数功能】        递归半径查询
+【参数】            size_t Begin, size_t End：子树区间
+                   const Coord3D& Point：查询点
+                   double RadiusSquare：半径平方
+                   std::vector<size_t>& Indices：结果点下标（追加）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void KDTree3D::RadiusRange(size_t Begin, size_t End, const Coord3D& Point,
+    double RadiusSquare, std::vector<size_t>& Indices) const{
+    if (Begin >= End) {
+        return;
+    }
+    size_t Mid = Begin + (End - Begin) / 2;
+    const Coord3D& TempPoint = m_Points[Mid];
+    Coord3D Diff = Geometry3D::Sub(TempPoint, Point);
+    if (Geometry3D::Dot(Diff, Diff) <= RadiusSquare) {
+        Indices.push_back(m_Indices[Mid]);
+    }
+    double Delta = Point[m_Axes[Mid]] - TempPoint[m_Axes[Mid]];
+    //左侧各点该轴坐标不大于划分值，右侧不小于划分值
+    if (Delta <= 0.0 || Delta * Delta <= RadiusSquare) {
+        RadiusRange(Begin, Mid, Point, RadiusSquare, Indices);
+    }
+    if (Delta >= 0.0 || Delta * Delta <= RadiusSquare) {
+        RadiusRange(Mid + 1, End, Point, RadiusSquare, Indices);
+    }
+}
+
+/*************************************************************************
+【函数名称】        BoxCountRange
+【函数功能】        递归包围盒计数
+【参数】            size_t Begin, size_t End：子树区间
+                   Coord3D CellMin, Coord3D CellMax：子树所占空间
+                   const Coord3D& Min, const Coord3D& Max：查询盒
+【返回值】          size_t，子树中盒内点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t KDTree3D::BoxCountRange(size_t Begin, size_t End, Coord3D CellMin,
+    Coord3D CellMax, const Coord3D& Min, const Coord3D& Max) const{
+    if (Begin >= End) {
+        return 0;
+    }
+    bool IsInside = true;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        //与查询盒不相交
+        if (CellMin[Axis] > Max[Axis] || CellMax[Axis] < Min[Axis]) {
+            return 0;
+        }
+        if (CellMin[Axis] < Min[Axis] || CellMax[Axis] > Max[Axis]) {
+            IsInside = false;
+        }
+    }
+    //完全在查询盒内
+    if (IsInside) {
+        return End - Begin;
+    }
+    size_t Mid = Begin + (End - Begin) / 2;
+    const Coord3D& TempPoint = m_Points[Mid];
+    size_t Count = 1;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        if (TempPoint[Axis] < Min[Axis] || TempPoint[Axis] > Max[Axis]) {
+            Count = 0;
+        }
+    }
+    size_t SplitAxis = m_Axes[Mid];
+    Coord3D LeftMax = CellMax;
+    LeftMax[SplitAxis] = TempPoint[SplitAxis];
+    Coord3D RightMin = CellMin;
+    RightMin[SplitAxis] = TempPoint[SplitAxis];
+    Count += BoxCountRange(Begin, Mid, CellMin, LeftMax, Min, Max);
+    Count += BoxCountRange(Mid + 1, End, RightMin, CellMax, Min, Max);
+    return Count;
+}
@@ -0,0 +1,96 @@
+/*************************************************************************
+【文件名】                 KDTree3D.hpp
+【功能模块和目的】          三维点k-d树类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef KDTREE3D_HPP
+#define KDTREE3D_HPP
+
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//size_t、SIZE_MAX所属头文件
+#include <cstddef>
+//uint8_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::pair所属头文件
+#include <utility>
+
+/*************************************************************************
+【类名】             KDTree3D
+【功能】             三维点k-d树，加速最近邻、半径与包围盒计数查询
+【接口说明】         隐式平衡树，扁平存放：区间[Begin, End)的中点即该子树
+                    根节点，左右子树分别为前后两半，无需存储指针；
+                    划分轴取区间包围盒最长轴，上层子树并行构建；
+                    查询返回构建时的点下标，并提供批量并行查询
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class KDTree3D{
+public:
+    //默认构造函数，空树
+    KDTree3D() = default;
+    //拷贝构造函数
+    KDTree3D(const KDTree3D& Source) = default;
+    //虚析构函数
+    virtual ~KDTree3D() = default;
+    //赋值运算符
+    KDTree3D& operator=(const KDTree3D& Source) = default;
+
+    //Setter
+    //由点列表并行构建
+    void Build(const std::vector<Coord3D>& Points);
+
+    //Getter
+    //K近邻查询，结果按距离升序
+    void KNearest(const Coord3D& Point, size_t K,
+        std::vector<size_t>& Indices, std::vector<double>& Distances) const;
+    //半径查询（含边界），结果按下标升序
+    void RadiusSearch(const Coord3D& Point, double Radius,
+        std::vector<size_t>& Indices) const;
+    //统计包围盒（含边界）内的点数
+    size_t BoxCount(const Coord3D& Min, const Coord3D& Max) const;
+    //批量K近邻查询，全部线程并行
+    void KNearestBatch(const std::vector<Coord3D>& Points, size_t K,
+        std::vector<std::vector<size_t>>& Indices) const;
+    //批量半径查询，全部线程并行
+    void RadiusSearchBatch(const std::vector<Coord3D>& Points, double Radius,
+        std::vector<std::vector<size_t>>& Indices) const;
+    //批量包围盒计数，全部线程并行
+    void BoxCountBatch(const std::vector<Coord3D>& Mins,
+        const std::vector<Coord3D>& Maxs, std::vector<size_t>& Counts) const;
+    //点数
+    size_t PointNum() const;
+
+private:
+    //候选近邻：距离平方与点位置
+    using Candidate = std::pair<double, size_t>;
+
+    //递归构建[Begin, End)区间（排列m_Indices，记录划分轴）
+    void BuildRange(const std::vector<Coord3D>& Points, size_t Begin,
+        size_t End, size_t ParallelDepth);
+    //递归K近邻查询，Heap为距离平方最大堆
+    void KNearestRange(size_t Begin, size_t End, const Coord3D& Point,
+        size_t K, std::vector<Candidate>& Heap) const;
+    //递归半径查询
+    void RadiusRange(size_t Begin, size_t End, const Coord3D& Point,
+        double RadiusSquare, std::vector<size_t>& Indices) const;
+    //递归包围盒计数，Cell为子树所占空间
+    size_t BoxCountRange(size_t Begin, size_t End, Coord3D CellMin,
+        Coord3D CellMax, const Coord3D& Min, const Coord3D& Max) const;
+
+    //按树序排列的点坐标
+    std::vector<Coord3D> m_Points;
+    //按树序排列的点的原下标
+    std::vector<size_t> m_Indices;
+    //各节点划分轴
+    std::vector<uint8_t> m_Axes;
+    //全部点的包围盒
+    Coord3D m_Min{{0.0, 0.0, 0.0}};
+    Coord3D m_Max{{0.0, 0.0, 0.0}};
+};
+
+#endif //KDTREE3D_HPP
@@ -0,0 +1,475 @@
+/*************************************************************************
+【文件名】                 MeasureKernel3D.cpp
+【功能模块和目的】          三角形面积与线段长度批量计算内核类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加批量仿射变换内核
+*************************************************************************/
+
+//自身类头文件
+#include "MeasureKernel3D.hpp"
+//std::sqrt、std::fma所属头文件
+#include <cmath>
+//std::string所属头文件
+#include <string>
+
+//GCC/Clang的x86平台：以target属性编译SIMD实现，运行时选择
+#if (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define MEASUREKERNEL3D_X86
+//AVX2、AVX-512内建函数所属头文件
+#include <immintrin.h>
+#endif
+
+/*************************************************************************
+【函数名称】        TriangleAreasScalar
+【函数功能】        标量实现：面积 = |(B - A)×(C - A)| / 2
+【参数】            size_t Count：三角形数
+                   const double* AX...CZ：三顶点坐标分量数组
+                   double* Areas：输出面积
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void TriangleAreasScalar(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, const double* CX, const double* CY, const double* CZ,
+    double* Areas){
+    for (size_t i = 0; i < Count; i++) {
+        double UX = BX[i] - AX[i];
+        double UY = BY[i] - AY[i];
+        double UZ = BZ[i] - AZ[i];
+        double VX = CX[i] - AX[i];
+        double VY = CY[i] - AY[i];
+        double VZ = CZ[i] - AZ[i];
+        double X = UY * VZ - UZ * VY;
+        double Y = UZ * VX - UX * VZ;
+        double Z = UX * VY - UY * VX;
+        Areas[i] = 0.5 * std::sqrt(X * X + Y * Y + Z * Z);
+    }
+}
+
+/*************************************************************************
+【函数名称】        SegmentLengthsScalar
+【函数功能】        标量实现：长度 = |B - A|
+【参数】            size_t Count：线段数
+                   const double* AX...BZ：两端点坐标分量数组
+                   double* Lengths：输出长度
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void SegmentLengthsScalar(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, double* Lengths){
+    for (size_t i = 0; i < Count; i++) {
+        double X = BX[i] - AX[i];
+        double Y = BY[i] - AY[i];
+        double Z = BZ[i] - AZ[i];
+        Lengths[i] = std::sqrt(X * X + Y * Y + Z * Z);
+    }
+}
+
+/*************************************************************************
+【函数名称】        TransformPointsScalar
+【函数功能】        标量实现：每个分量为M[r][0]·x + M[r][1]·y + M[r][2]·z
+                   + M[r][3]，按z、y、x的顺序逐次融合乘加，与SIMD实现
+                   逐位相同
+【参数】            size_t Count：点数
+                   const double* Matrix：按行存放的3×4矩阵
+                   double* X, Y, Z：坐标分量数组（原位变换）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void TransformPointsScalar(size_t Count, const double* Matrix,
+    double* X, double* Y, double* Z){
+    const double* M = Matrix;
+    for (size_t i = 0; i < Count; i++) {
+        double PX = X[i];
+        double PY = Y[i];
+        double PZ = Z[i];
+        X[i] = std::fma(M[0], PX, std::fma(M[1], PY, std::fma(M[2], PZ,
+            M[3])));
+        Y[i] = std::fma(M[4], PX, std::fma(M[5], PY, std::fma(M[6], PZ,
+            M[7])));
+        Z[i] = std::fma(M[8], PX, std::fma(M[9], PY, std::fma(M[10], PZ,
+            M[11])));
+    }
+}
+
+#ifdef MEASUREKERNEL3D_X86
+
+/*************************************************************************
+【函数名称】        TriangleAreasAVX2
+【函数功能】        AVX2实现：每次4个三角形，尾部交给标量实现
+【参数】            同TriangleAreasScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx2,fma")))
+static void TriangleAreasAVX2(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, const double* CX, const double* CY, const double* CZ,
+    double* Areas){
+    const __m256d Half = _mm256_set1_pd(0.5);
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        __m256d X0 = _mm256_loadu_pd(AX + i);
+        __m256d Y0 = _mm256_loadu_pd(AY + i);
+        __m256d Z0 = _mm256_loadu_pd(AZ + i);
+        __m256d UX = _mm256_sub_pd(_mm256_loadu_pd(BX + i), X0);
+        __m256d UY = _mm256_sub_pd(_mm256_loadu_pd(BY + i), Y0);
+        __m256d UZ = _mm256_sub_pd(_mm256_loadu_pd(BZ + i), Z0);
+        __m256d VX = _mm256_sub_pd(_mm256_loadu_pd(CX + i), X0);
+        __m256d VY = _mm256_sub_pd(_mm256_loadu_pd(CY + i), Y0);
+        __m256d VZ = _mm256_sub_pd(_mm256_loadu_pd(CZ + i), Z0);
+        __m256d X = _mm256_fmsub_pd(UY, VZ, _mm256_mul_pd(UZ, VY));
+        __m256d Y = _mm256_fmsub_pd(UZ, VX, _mm256_mul_pd(UX, VZ));
+        __m256d Z = _mm256_fmsub_pd(UX, VY, _mm256_mul_pd(UY, VX));
+        __m256d Square = _mm256_fmadd_pd(X, X,
+            _mm256_fmadd_pd(Y, Y, _mm256_mul_pd(Z, Z)));
+        _mm256_storeu_pd(Areas + i,
+            _mm256_mul_pd(Half, _mm256_sqrt_pd(Square)));
+    }
+    TriangleAreasScalar(Count - i, AX + i, AY + i, AZ + i, BX + i, BY + i,
+        BZ + i, CX + i, CY + i, CZ + i, Areas + i);
+}
+
+/*************************************************************************
+【函数名称】        SegmentLengthsAVX2
+【函数功能】        AVX2实现：每次4条线段，尾部交给标量实现
+【参数】            同SegmentLengthsScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx2,fma")))
+static void SegmentLengthsAVX2(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, double* Lengths){
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        __m256d X = _mm256_sub_pd(_mm256_loadu_pd(BX + i),
+            _mm256_loadu_pd(AX + i));
+        __m256d Y = _mm256_sub_pd(_mm256_loadu_pd(BY + i),
+            _mm256_loadu_pd(AY + i));
+        __m256d Z = _mm256_sub_pd(_mm256_loadu_pd(BZ + i),
+            _mm256_loadu_pd(AZ + i));
+        __m256d Square = _mm256_fmadd_pd(X, X,
+            _mm256_fmadd_pd(Y, Y, _mm256_mul_pd(Z, Z)));
+        _mm256_storeu_pd(Lengths + i, _mm256_sqrt_pd(Square));
+    }
+    SegmentLengthsScalar(Count - i, AX + i, AY + i, AZ + i, BX + i, BY + i,
+        BZ + i, Lengths + i);
+}
+
+/*************************************************************************
+【函数名称】        TransformPointsAVX2
+【函数功能】        AVX2实现：每次4个点，尾部交给标量实现
+【参数】            同TransformPointsScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx2,fma")))
+static void TransformPointsAVX2(size_t Count, const double* Matrix,
+    double* X, double* Y, double* Z){
+    __m256d M[12];
+    for (size_t k = 0; k < 12; k++) {
+        M[k] = _mm256_set1_pd(Matrix[k]);
+    }
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        __m256d PX = _mm256_loadu_pd(X + i);
+        __m256d PY = _mm256_loadu_pd(Y + i);
+        __m256d PZ = _mm256_loadu_pd(Z + i);
+        _mm256_storeu_pd(X + i, _mm256_fmadd_pd(M[0], PX, _mm256_fmadd_pd(
+            M[1], PY, _mm256_fmadd_pd(M[2], PZ, M[3]))));
+        _mm256_storeu_pd(Y + i, _mm256_fmadd_pd(M[4], PX, _mm256_fmadd_pd(
+            M[5], PY, _mm256_fmadd_pd(M[6], PZ, M[7]))));
+        _mm256_storeu_pd(Z + i, _mm256_fmadd_pd(M[8], PX, _mm256_fmadd_pd(
+            M[9], PY, _mm256_fmadd_pd(M[10], PZ, M[11]))));
+    }
+    TransformPointsScalar(Count - i, Matrix, X + i, Y + i, Z + i);
+}
+
+/*************************************************************************
+【函数名称】        TriangleAreasAVX512
+【函数功能】        AVX-512实现：每次8个三角形，尾部以掩码读写
+【参数】            同TriangleAreasScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx512f")))
+static void TriangleAreasAVX512(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, const double* CX, const double* CY, const double* CZ,
+    double* Areas){
+    const __m512d Half = _mm512_set1_pd(0.5);
+    for (size_t i = 0; i < Count; i += 8) {
+        //剩余不足8个时只读写前Count - i个通道
+        __mmask8 Mask = Count - i >= 8 ? static_cast<__mmask8>(0xFF)
+            : static_cast<__mmask8>((1u << (Count - i)) - 1);
+        __m512d X0 = _mm512_maskz_loadu_pd(Mask, AX + i);
+        __m512d Y0 = _mm512_maskz_loadu_pd(Mask, AY + i);
+        __m512d Z0 = _mm512_maskz_loadu_pd(Mask, AZ + i);
+        __m512d UX = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BX + i), X0);
+        __m512d UY = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BY + i), Y0);
+        __m512d UZ = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BZ + i), Z0);
+        __m512d VX = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, CX + i), X0);
+        __m512d VY = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, CY + i), Y0);
+        __m512d VZ = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, CZ + i), Z0);
+        __m512d X = _mm512_fmsub_pd(UY, VZ, _mm512_mul_pd(UZ, VY));
+        __m512d Y = _mm512_fmsub_pd(UZ, VX, _mm512_mul_pd(UX, VZ));
+        __m512d Z = _mm512_fmsub_pd(UX, VY, _mm512_mul_pd(UY, VX));
+        __m512d Square = _mm512_fmadd_pd(X, X,
+            _mm512_fmadd_pd(Y, Y, _mm512_mul_pd(Z, Z)));
+        _mm512_mask_storeu_pd(Areas + i, Mask,
+            _mm512_mul_pd(Half, _mm512_maskz_sqrt_pd(Mask, Square)));
+    }
+}
+
+/*************************************************************************
+【函数名称】        SegmentLengthsAVX512
+【函数功能】        AVX-512实现：每次8条线段，尾部以掩码读写
+【参数】            同SegmentLengthsScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx512f")))
+static void SegmentLengthsAVX512(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, double* Lengths){
+    for (size_t i = 0; i < Count; i += 8) {
+        //剩余不足8个时只读写前Count - i个通道
+        __mmask8 Mask = Count - i >= 8 ? static_cast<__mmask8>(0xFF)
+            : static_cast<__mmask8>((1u << (Count - i)) - 1);
+        __m512d X = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BX + i),
+            _mm512_maskz_loadu_pd(Mask, AX + i));
+        __m512d Y = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BY + i),
+            _mm512_maskz_loadu_pd(Mask, AY + i));
+        __m512d Z = _mm512_sub_pd(_mm512_maskz_loadu_pd(Mask, BZ + i),
+            _mm512_maskz_loadu_pd(Mask, AZ + i));
+        __m512d Square = _mm512_fmadd_pd(X, X,
+            _mm512_fmadd_pd(Y, Y, _mm512_mul_pd(Z, Z)));
+        _mm512_mask_storeu_pd(Lengths + i, Mask,
+            _mm512_maskz_sqrt_pd(Mask, Square));
+    }
+}
+
+/*************************************************************************
+【函数名称】        TransformPointsAVX512
+【函数功能】        AVX-512实现：每次8个点，尾部以掩码读写
+【参数】            同TransformPointsScalar
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+__attribute__((target("avx512f")))
+static void TransformPointsAVX512(size_t Count, const double* Matrix,
+    double* X, double* Y, double* Z){
+    __m512d M[12];
+    for (size_t k = 0; k < 12; k++) {
+        M[k] = _mm512_set1_pd(Matrix[k]);
+    }
+    for (size_t i = 0; i < Count; i += 8) {
+        //剩余不足8个时只读写前Count - i个通道
+        __mmask8 Mask = Count - i >= 8 ? static_cast<__mmask8>(0xFF)
+            : static_cast<__mmask8>((1u << (Count - i)) - 1);
+        __m512d PX = _mm512_maskz_loadu_pd(Mask, X + i);
+        __m512d PY = _mm512_maskz_loadu_pd(Mask, Y + i);
+        __m512d PZ = _mm512_maskz_loadu_pd(Mask, Z + i);
+        _mm512_mask_storeu_pd(X + i, Mask, _mm512_fmadd_pd(M[0], PX,
+            _mm512_fmadd_pd(M[1], PY, _mm512_fmadd_pd(M[2], PZ, M[3]))));
+        _mm512_mask_storeu_pd(Y + i, Mask, _mm512_fmadd_pd(M[4], PX,
+            _mm512_fmadd_pd(M[5], PY, _mm512_fmadd_pd(M[6], PZ, M[7]))));
+        _mm512_mask_storeu_pd(Z + i, Mask, _mm512_fmadd_pd(M[8], PX,
+            _mm512_fmadd_pd(M[9], PY, _mm512_fmadd_pd(M[10], PZ, M[11]))));
+    }
+}
+
+#endif //MEASUREKERNEL3D_X86
+
+/*************************************************************************
+【函数名称】        BestISA
+【函数功能】        检测当前CPU支持的最高指令集（检测结果缓存在静态局部
+                   变量中，初始化线程安全）
+【参数】            无
+【返回值】          ISA，最高可用指令集
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeasureKernel3D::ISA MeasureKernel3D::BestISA(){
+    static const ISA Best = [](){
+#ifdef MEASUREKERNEL3D_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return ISA::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return ISA::AVX2;
+        }
+#endif
+        return ISA::SCALAR;
+    }();
+    return Best;
+}
+
+/*************************************************************************
+【函数名称】        ISAName
+【函数功能】        获取指令集名称
+【参数】            ISA Isa：指令集
+【返回值】          std::string，名称
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::string MeasureKernel3D::ISAName(ISA Isa){
+    switch (Isa) {
+    case ISA::AVX512:
+        return std::string("AVX-512");
+    case ISA::AVX2:
+        return std::string("AVX2");
+    default:
+        return std::string("SCALAR");
+    }
+}
+
+/*************************************************************************
+【函数名称】        TriangleAreas
+【函数功能】        以最高可用指令集批量求三角形面积
+【参数】            size_t Count：三角形数
+                   const double* AX...CZ：三顶点坐标分量数组
+                   double* Areas：输出面积
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::TriangleAreas(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, const double* CX, const double* CY, const double* CZ,
+    double* Areas){
+    TriangleAreas(BestISA(), Count, AX, AY, AZ, BX, BY, BZ, CX, CY, CZ,
+        Areas);
+}
+
+/*************************************************************************
+【函数名称】        TriangleAreas
+【函数功能】        以指定指令集批量求三角形面积，不受支持时降为最高可用
+                   指令集
+【参数】            ISA Isa：指令集
+                   其余同上
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::TriangleAreas(ISA Isa, size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, const double* CX, const double* CY, const double* CZ,
+    double* Areas){
+    if (static_cast<int>(Isa) > static_cast<int>(BestISA())) {
+        Isa = BestISA();
+    }
+#ifdef MEASUREKERNEL3D_X86
+    if (Isa == ISA::AVX512) {
+        TriangleAreasAVX512(Count, AX, AY, AZ, BX, BY, BZ, CX, CY, CZ,
+            Areas);
+        return;
+    }
+    if (Isa == ISA::AVX2) {
+        TriangleAreasAVX2(Count, AX, AY, AZ, BX, BY, BZ, CX, CY, CZ, Areas);
+        return;
+    }
+#endif
+    TriangleAreasScalar(Count, AX, AY, AZ, BX, BY, BZ, CX, CY, CZ, Areas);
+}
+
+/*************************************************************************
+【函数名称】        SegmentLengths
+【函数功能】        以最高可用指令集批量求线段长度
+【参数】            size_t Count：线段数
+                   const double* AX...BZ：两端点坐标分量数组
+                   double* Lengths：输出长度
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::SegmentLengths(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, double* Lengths){
+    SegmentLengths(BestISA(), Count, AX, AY, AZ, BX, BY, BZ, Lengths);
+}
+
+/*************************************************************************
+【函数名称】        SegmentLengths
+【函数功能】        以指定指令集批量求线段长度，不受支持时降为最高可用
+                   指令集
+【参数】            ISA Isa：指令集
+                   其余同上
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::SegmentLengths(ISA Isa, size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX, const double* BY,
+    const double* BZ, double* Lengths){
+    if (static_cast<int>(Isa) > static_cast<int>(BestISA())) {
+        Isa = BestISA();
+    }
+#ifdef MEASUREKERNEL3D_X86
+    if (Isa == ISA::AVX512) {
+        SegmentLengthsAVX512(Count, AX, AY, AZ, BX, BY, BZ, Lengths);
+        return;
+    }
+    if (Isa == ISA::AVX2) {
+        SegmentLengthsAVX2(Count, AX, AY, AZ, BX, BY, BZ, Lengths);
+        return;
+    }
+#endif
+    SegmentLengthsScalar(Count, AX, AY, AZ, BX, BY, BZ, Lengths);
+}
+
+/*************************************************************************
+【函数名称】        TransformPoints
+【函数功能】        以最高可用指令集批量仿射变换点
+【参数】            size_t Count：点数
+                   const double* Matrix：按行存放的3×4矩阵
+                   double* X, Y, Z：坐标分量数组（原位变换）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::TransformPoints(size_t Count, const double* Matrix,
+    double* X, double* Y, double* Z){
+    TransformPoints(BestISA(), Count, Matrix, X, Y, Z);
+}
+
+/*************************************************************************
+【函数名称】        TransformPoints
+【函数功能】        以指定指令集批量仿射变换点，不受支持时降为最高可用
+                   指令集；各指令集结果逐位相同
+【参数】            ISA Isa：指令集
+                   其余同上
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeasureKernel3D::TransformPoints(ISA Isa, size_t Count,
+    const double* Matrix, double* X, double* Y, double* Z){
+    if (static_cast<int>(Isa) > static_cast<int>(BestISA())) {
+        Isa = BestISA();
+    }
+#ifdef MEASUREKERNEL3D_X86
+    if (Isa == ISA::AVX512) {
+        TransformPointsAVX512(Count, Matrix, X, Y, Z);
+        return;
+    }
+    if (Isa == ISA::AVX2) {
+        TransformPointsAVX2(Count, Matrix, X, Y, Z);
+        return;
+    }
+#endif
+    TransformPointsScalar(Count, Matrix, X, Y, Z);
+}
@@ -0,0 +1,75 @@
+/*************************************************************************
+【文件名】                 MeasureKernel3D.hpp
+【功能模块和目的】          三角形面积与线段长度批量计算内核类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加批量仿射变换内核
+*************************************************************************/
+
+#ifndef MEASUREKERNEL3D_HPP
+#define MEASUREKERNEL3D_HPP
+
+//size_t所属头文件
+#include <cstddef>
+//std::string所属头文件
+#include <string>
+
+/*************************************************************************
+【类名】             MeasureKernel3D
+【功能】             对按分量连续存放（SoA）的坐标数组批量求三角形面积
+                    （叉积模长的一半）与线段长度
+【接口说明】         只含静态函数；x86平台上按运行时检测到的指令集
+                    选用AVX-512、AVX2或标量实现（GCC/Clang以函数级
+                    target属性编译，无需全局开启指令集选项），
+                    其余平台只用标量实现；可显式指定指令集
+                    （不受支持时降为可用的最高指令集），便于对比测试；
+                    各实现逐元素结果与标量实现至多相差舍入误差
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加批量仿射变换内核：各实现均为
+                    同一顺序的融合乘加链，逐点结果完全相同，坐标相同的
+                    点无论落在向量通道还是尾部，变换后仍然相同
+*************************************************************************/
+class MeasureKernel3D{
+public:
+    //工具类，无需实例
+    MeasureKernel3D() = delete;
+
+    //指令集
+    enum class ISA{
+        SCALAR  = 0,
+        AVX2    = 1,
+        AVX512  = 2
+    };
+
+    //当前CPU支持的最高指令集（首次调用时检测）
+    static ISA BestISA();
+    //指令集名称
+    static std::string ISAName(ISA Isa);
+
+    //三角形面积：顶点A、B、C的各坐标分量数组，结果写入Areas
+    static void TriangleAreas(size_t Count, const double* AX,
+        const double* AY, const double* AZ, const double* BX,
+        const double* BY, const double* BZ, const double* CX,
+        const double* CY, const double* CZ, double* Areas);
+    static void TriangleAreas(ISA Isa, size_t Count, const double* AX,
+        const double* AY, const double* AZ, const double* BX,
+        const double* BY, const double* BZ, const double* CX,
+        const double* CY, const double* CZ, double* Areas);
+    //线段长度：端点A、B的各坐标分量数组，结果写入Lengths
+    static void SegmentLengths(size_t Count, const double* AX,
+        const double* AY, const double* AZ, const double* BX,
+        const double* BY, const double* BZ, double* Lengths);
+    static void SegmentLengths(ISA Isa, size_t Count, const double* AX,
+        const double* AY, const double* AZ, const double* BX,
+        const double* BY, const double* BZ, double* Lengths);
+    //仿射变换：各点坐标分量数组原位变换，Matrix为按行存放的3×4矩阵
+    //（前三列为线性部分，末列为平移）
+    static void TransformPoints(size_t Count, const double* Matrix,
+        double* X, double* Y, double* Z);
+    static void TransformPoints(ISA Isa, size_t Count, const double* Matrix,
+        double* X, double* Y, double* Z);
+
+    //静态常量：调用方分块收集坐标时建议的每块元素数（栈上SoA数组）
+    static constexpr size_t BLOCK_SIZE{256};
+};
+
+#endif //MEASUREKERNEL3D_HPP
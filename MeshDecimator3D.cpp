@@ -0,0 +1,662 @@
+/*************************************************************************
+【文件名】                 MeshDecimator3D.cpp
+【功能模块和目的】          二次误差度量（QEM）边塌缩网格简化类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "MeshDecimator3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::abs、std::sqrt所属头文件
+#include <cmath>
+//std::sort、std::unique、std::make_heap等所属头文件
+#include <algorithm>
+//std::back_inserter所属头文件
+#include <iterator>
+//UINT32_MAX所属头文件
+#include <cstdint>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Load
+【函数功能】        载入网格：建立相邻面表，并行计算各顶点二次型
+                   （相邻面平面与边界约束平面），标记边界顶点
+【参数】            const std::vector<Coord3D>& Vertices：顶点坐标
+                   const std::vector<std::array<size_t, 3>>& Faces：
+                   面的顶点下标
+【返回值】          bool，成功返回true；规模超出32位编号范围返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool MeshDecimator3D::Load(const std::vector<Coord3D>& Vertices,
+    const std::vector<std::array<size_t, 3>>& Faces){
+    //相邻面数组压缩前最多增长到初始的两倍，需留在32位范围内
+    if (Vertices.size() >= UINT32_MAX || Faces.size() >= UINT32_MAX / 6) {
+        return false;
+    }
+    const size_t VertexCount = Vertices.size();
+    m_Positions = Vertices;
+    m_Faces.clear();
+    m_Faces.reserve(Faces.size());
+    for (const std::array<size_t, 3>& Face : Faces) {
+        if (Face[0] == Face[1] || Face[1] == Face[2] || Face[0] == Face[2]) {
+            continue;
+        }
+        m_Faces.push_back({{static_cast<uint32_t>(Face[0]),
+            static_cast<uint32_t>(Face[1]), static_cast<uint32_t>(Face[2])}});
+    }
+    m_FaceAlive.assign(m_Faces.size(), 1);
+    m_ullFaceNum = m_Faces.size();
+    m_rMaxError = 0.0;
+    m_ullCollapseNum = 0;
+    m_VertexStamps.assign(VertexCount, 0);
+    m_VertexAlive.assign(VertexCount, 1);
+    m_VertexBoundary.assign(VertexCount, 0);
+    //相邻面表：计数、前缀和、填充
+    m_RefCount.assign(VertexCount, 0);
+    m_RefStart.assign(VertexCount, 0);
+    for (const std::array<uint32_t, 3>& Face : m_Faces) {
+        for (uint32_t Vertex : Face) {
+            m_RefCount[Vertex]++;
+        }
+    }
+    uint32_t Offset = 0;
+    for (size_t i = 0; i < VertexCount; i++) {
+        m_RefStart[i] = Offset;
+        Offset += m_RefCount[i];
+    }
+    m_Refs.assign(Offset, 0);
+    std::vector<uint32_t> Fill(m_RefStart);
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        for (uint32_t Vertex : m_Faces[i]) {
+            m_Refs[Fill[Vertex]++] = static_cast<uint32_t>(i);
+        }
+    }
+    //各顶点二次型：逐顶点累加相邻面平面；顶点所在的某条边若只属于
+    //一个面，即为边界边，再加过该边且垂直于面的约束平面（边的两端
+    //各自发现该边，无需跨顶点写入）
+    m_Quadrics.assign(VertexCount, Quadric{});
+    Parallel::For(0, VertexCount, [&](size_t First, size_t Last){
+        for (size_t v = First; v < Last; v++) {
+            const uint32_t* Refs = m_Refs.data() + m_RefStart[v];
+            Quadric Q{};
+            for (uint32_t k = 0; k < m_RefCount[v]; k++) {
+                const std::array<uint32_t, 3>& Face = m_Faces[Refs[k]];
+                Coord3D Normal = FaceCross(Refs[k]);
+                double Length = Geometry3D::Length(Normal);
+                if (Length == 0.0) {
+                    continue;
+                }
+                Normal = Geometry3D::Scale(Normal, 1.0 / Length);
+                const Coord3D& Base = m_Positions[Face[0]];
+                Q = AddQuadric(Q, PlaneQuadric(Normal,
+                    -Geometry3D::Dot(Normal, Base), 1.0));
+                for (size_t j = 0; j < 3; j++) {
+                    if (Face[j] != v) {
+                        continue;
+                    }
+                    //以v为端点的两条边
+                    for (uint32_t Other : {Face[(j + 1) % 3],
+                        Face[(j + 2) % 3]}) {
+                        size_t Shared = 0;
+                        for (uint32_t m = 0; m < m_RefCount[v]; m++) {
+                            const std::array<uint32_t, 3>& Around
+                                = m_Faces[Refs[m]];
+                            if (Around[0] == Other || Around[1] == Other
+                                || Around[2] == Other) {
+                                Shared++;
+                            }
+                        }
+                        if (Shared != 1) {
+                            continue;
+                        }
+                        m_VertexBoundary[v] = 1;
+                        Coord3D Edge = Geometry3D::Sub(m_Positions[Other],
+                            m_Positions[v]);
+                        Coord3D Side = Geometry3D::Cross(Edge, Normal);
+                        double SideLength = Geometry3D::Length(Side);
+                        if (SideLength == 0.0) {
+                            continue;
+                        }
+                        Side = Geometry3D::Scale(Side, 1.0 / SideLength);
+                        Q = AddQuadric(Q, PlaneQuadric(Side,
+                            -Geometry3D::Dot(Side, m_Positions[v]),
+                            BOUNDARY_WEIGHT));
+                    }
+                }
+            }
+            m_Quadrics[v] = Q;
+        }
+    });
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        Simplify
+【函数功能】        QEM边塌缩简化：并行计算全部边的初始代价并建堆，
+                   之后反复取代价最小的有效边塌缩（惰性更新堆），
+                   直到面数达到目标、最小代价超过误差上限或无边可塌缩
+【参数】            size_t TargetFaceNum：目标面数
+                   double MaxError：单次塌缩允许的最大误差
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshDecimator3D::Simplify(size_t TargetFaceNum, double MaxError){
+    if (m_ullFaceNum <= TargetFaceNum) {
+        return;
+    }
+    const size_t VertexCount = m_Positions.size();
+    //初始边：每条边由编号较小的端点生成；先逐顶点计数，再按前缀和填充
+    std::vector<size_t> EdgeOffsets(VertexCount + 1, 0);
+    Parallel::For(0, VertexCount, [&](size_t First, size_t Last){
+        std::vector<uint32_t> Neighbors;
+        for (size_t v = First; v < Last; v++) {
+            CollectNeighbors(static_cast<uint32_t>(v), Neighbors);
+            EdgeOffsets[v + 1] = static_cast<size_t>(Neighbors.end()
+                - std::upper_bound(Neighbors.begin(), Neighbors.end(),
+                static_cast<uint32_t>(v)));
+        }
+    });
+    for (size_t v = 0; v < VertexCount; v++) {
+        EdgeOffsets[v + 1] += EdgeOffsets[v];
+    }
+    std::vector<Candidate> Heap(EdgeOffsets[VertexCount]);
+    Parallel::For(0, VertexCount, [&](size_t First, size_t Last){
+        std::vector<uint32_t> Neighbors;
+        for (size_t v = First; v < Last; v++) {
+            CollectNeighbors(static_cast<uint32_t>(v), Neighbors);
+            size_t Slot = EdgeOffsets[v];
+            for (uint32_t Other : Neighbors) {
+                if (Other > v) {
+                    Heap[Slot++] = MakeCandidate(static_cast<uint32_t>(v),
+                        Other);
+                }
+            }
+        }
+    });
+    std::make_heap(Heap.begin(), Heap.end());
+    std::vector<uint32_t> Neighbors0;
+    std::vector<uint32_t> Neighbors1;
+    std::vector<uint32_t> Merged;
+    while (m_ullFaceNum > TargetFaceNum && !Heap.empty()) {
+        std::pop_heap(Heap.begin(), Heap.end());
+        const uint32_t Vertex0 = Heap.back().Vertex0;
+        const uint32_t Vertex1 = Heap.back().Vertex1;
+        const uint32_t Stamp = Heap.back().Stamp;
+        Heap.pop_back();
+        //惰性更新：端点已删除或入堆后被修改的项作废
+        if (!m_VertexAlive[Vertex0] || !m_VertexAlive[Vertex1]
+            || m_VertexStamps[Vertex0] > Stamp
+            || m_VertexStamps[Vertex1] > Stamp) {
+            continue;
+        }
+        Coord3D Position;
+        double Cost = CollapseCost(Vertex0, Vertex1, Position);
+        if (Cost > MaxError) {
+            break;
+        }
+        CollectNeighbors(Vertex0, Neighbors0);
+        CollectNeighbors(Vertex1, Neighbors1);
+        if (!CanCollapse(Vertex0, Vertex1, Position, Neighbors0,
+            Neighbors1)) {
+            continue;
+        }
+        Collapse(Vertex0, Vertex1, Position);
+        m_rMaxError = std::max(m_rMaxError, Cost);
+        //保留顶点的新邻点为两端邻点之并（去掉两端点），新边重新入堆
+        Merged.clear();
+        std::set_union(Neighbors0.begin(), Neighbors0.end(),
+            Neighbors1.begin(), Neighbors1.end(), std::back_inserter(Merged));
+        for (uint32_t Other : Merged) {
+            if (Other != Vertex0 && Other != Vertex1) {
+                Heap.push_back(MakeCandidate(Vertex0, Other));
+                std::push_heap(Heap.begin(), Heap.end());
+            }
+        }
+    }
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        FaceNum
+【函数功能】        获取当前面数
+【参数】            无
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t MeshDecimator3D::FaceNum() const{
+    return m_ullFaceNum;
+}
+
+/*************************************************************************
+【函数名称】        MaxCollapseError
+【函数功能】        获取已执行塌缩中的最大误差
+【参数】            无
+【返回值】          double，最大误差（距离平方量纲）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double MeshDecimator3D::MaxCollapseError() const{
+    return m_rMaxError;
+}
+
+/*************************************************************************
+【函数名称】        Extract
+【函数功能】        导出仍存在的面，只保留其引用的顶点并按原顺序重新编号
+【参数】            std::vector<Coord3D>& Vertices：顶点坐标（会被重写）
+                   std::vector<std::array<size_t, 3>>& Faces：
+                   面的顶点下标（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshDecimator3D::Extract(std::vector<Coord3D>& Vertices,
+    std::vector<std::array<size_t, 3>>& Faces) const{
+    std::vector<size_t> NewIndex(m_Positions.size(), SIZE_MAX);
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (m_FaceAlive[i]) {
+            for (uint32_t Vertex : m_Faces[i]) {
+                NewIndex[Vertex] = 0;
+            }
+        }
+    }
+    Vertices.clear();
+    for (size_t v = 0; v < m_Positions.size(); v++) {
+        if (NewIndex[v] == 0) {
+            NewIndex[v] = Vertices.size();
+            Vertices.push_back(m_Positions[v]);
+        }
+    }
+    Faces.clear();
+    Faces.reserve(m_ullFaceNum);
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (m_FaceAlive[i]) {
+            Faces.push_back({{NewIndex[m_Faces[i][0]],
+                NewIndex[m_Faces[i][1]], NewIndex[m_Faces[i][2]]}});
+        }
+    }
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        operator<
+【函数功能】        堆比较：代价大者优先级低
+【参数】            const Candidate& Other：另一个候选边
+【返回值】          bool，本项优先级低于Other时返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool MeshDecimator3D::Candidate::operator<(const Candidate& Other) const{
+    return Cost > Other.Cost;
+}
+
+/*************************************************************************
+【函数名称】        PlaneQuadric
+【函数功能】        平面的二次型：(n, d)(n, d)^T乘以权重
+【参数】            const Coord3D& Normal：单位法向
+                   double Offset：平面常数项d
+                   double Weight：权重
+【返回值】          Quadric，二次型
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeshDecimator3D::Quadric MeshDecimator3D::PlaneQuadric(
+    const Coord3D& Normal, double Offset, double Weight){
+    const double A = Normal[0];
+    const double B = Normal[1];
+    const double C = Normal[2];
+    const double D = Offset;
+    return {{Weight * A * A, Weight * A * B, Weight * A * C, Weight * A * D,
+        Weight * B * B, Weight * B * C, Weight * B * D,
+        Weight * C * C, Weight * C * D, Weight * D * D}};
+}
+
+/*************************************************************************
+【函数名称】        AddQuadric
+【函数功能】        二次型相加
+【参数】            const Quadric& Lhs, const Quadric& Rhs：两个二次型
+【返回值】          Quadric，和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeshDecimator3D::Quadric MeshDecimator3D::AddQuadric(const Quadric& Lhs,
+    const Quadric& Rhs){
+    Quadric Result;
+    for (size_t i = 0; i < 10; i++) {
+        Result[i] = Lhs[i] + Rhs[i];
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Evaluate
+【函数功能】        二次型在点处的值v^T Q v（v为齐次坐标）
+【参数】            const Quadric& Q：二次型
+                   const Coord3D& Point：点
+【返回值】          double，到各平面（加权）距离平方和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double MeshDecimator3D::Evaluate(const Quadric& Q, const Coord3D& Point){
+    const double X = Point[0];
+    const double Y = Point[1];
+    const double Z = Point[2];
+    return Q[0] * X * X + 2.0 * Q[1] * X * Y + 2.0 * Q[2] * X * Z
+        + 2.0 * Q[3] * X + Q[4] * Y * Y + 2.0 * Q[5] * Y * Z
+        + 2.0 * Q[6] * Y + Q[7] * Z * Z + 2.0 * Q[8] * Z + Q[9];
+}
+
+/*************************************************************************
+【函数名称】        Optimize
+【函数功能】        求二次型的最小点：解3×3线性方程组A x = -b（克拉默
+                   法则）；行列式相对矩阵尺度过小（平坦或沿直线退化）时，
+                   在两端点与中点中取误差最小者
+【参数】            const Quadric& Q：二次型
+                   const Coord3D& Point0, const Coord3D& Point1：边两端点
+【返回值】          Coord3D，塌缩后的位置
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D MeshDecimator3D::Optimize(const Quadric& Q, const Coord3D& Point0,
+    const Coord3D& Point1){
+    //余子式
+    const double C00 = Q[4] * Q[7] - Q[5] * Q[5];
+    const double C01 = Q[2] * Q[5] - Q[1] * Q[7];
+    const double C02 = Q[1] * Q[5] - Q[2] * Q[4];
+    const double Det = Q[0] * C00 + Q[1] * C01 + Q[2] * C02;
+    const double Trace = Q[0] + Q[4] + Q[7];
+    if (std::abs(Det) > 1e-9 * Trace * Trace * Trace) {
+        const double C11 = Q[0] * Q[7] - Q[2] * Q[2];
+        const double C12 = Q[1] * Q[2] - Q[0] * Q[5];
+        const double C22 = Q[0] * Q[4] - Q[1] * Q[1];
+        const double InvDet = -1.0 / Det;
+        return {{(C00 * Q[3] + C01 * Q[6] + C02 * Q[8]) * InvDet,
+            (C01 * Q[3] + C11 * Q[6] + C12 * Q[8]) * InvDet,
+            (C02 * Q[3] + C12 * Q[6] + C22 * Q[8]) * InvDet}};
+    }
+    Coord3D Middle = Geometry3D::Scale(Geometry3D::Add(Point0, Point1), 0.5);
+    double Error0 = Evaluate(Q, Point0);
+    double Error1 = Evaluate(Q, Point1);
+    double ErrorMiddle = Evaluate(Q, Middle);
+    if (ErrorMiddle <= Error0 && ErrorMiddle <= Error1) {
+        return Middle;
+    }
+    return Error0 <= Error1 ? Point0 : Point1;
+}
+
+/*************************************************************************
+【函数名称】        FaceCross
+【函数功能】        面的非单位法向（边向量叉积，模长为两倍面积）
+【参数】            uint32_t Face：面编号
+【返回值】          Coord3D，非单位法向
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D MeshDecimator3D::FaceCross(uint32_t Face) const{
+    const Coord3D& A = m_Positions[m_Faces[Face][0]];
+    return Geometry3D::Cross(
+        Geometry3D::Sub(m_Positions[m_Faces[Face][1]], A),
+        Geometry3D::Sub(m_Positions[m_Faces[Face][2]], A));
+}
+
+/*************************************************************************
+【函数名称】        CollapseCost
+【函数功能】        两顶点间边的塌缩位置与代价（合并二次型在最优位置的值）
+【参数】            uint32_t Vertex0, uint32_t Vertex1：边两端顶点
+                   Coord3D& Position：塌缩后的位置
+【返回值】          double，塌缩代价
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double MeshDecimator3D::CollapseCost(uint32_t Vertex0, uint32_t Vertex1,
+    Coord3D& Position) const{
+    Quadric Q = AddQuadric(m_Quadrics[Vertex0], m_Quadrics[Vertex1]);
+    Position = Optimize(Q, m_Positions[Vertex0], m_Positions[Vertex1]);
+    //舍入可能使误差略小于0
+    return std::max(0.0, Evaluate(Q, Position));
+}
+
+/*************************************************************************
+【函数名称】        MakeCandidate
+【函数功能】        计算两顶点间边的塌缩代价，记录当前塌缩序号
+【参数】            uint32_t Vertex0, uint32_t Vertex1：边两端顶点
+【返回值】          Candidate，堆元素
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeshDecimator3D::Candidate MeshDecimator3D::MakeCandidate(uint32_t Vertex0,
+    uint32_t Vertex1) const{
+    Coord3D Position;
+    Candidate Result;
+    Result.Cost = static_cast<float>(CollapseCost(Vertex0, Vertex1,
+        Position));
+    Result.Vertex0 = Vertex0;
+    Result.Vertex1 = Vertex1;
+    Result.Stamp = static_cast<uint32_t>(m_ullCollapseNum);
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        CollectNeighbors
+【函数功能】        收集与顶点共面（仍存在的面）的其他顶点
+【参数】            uint32_t Vertex：顶点
+                   std::vector<uint32_t>& Neighbors：相邻顶点（会被重写，
+                   升序去重）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshDecimator3D::CollectNeighbors(uint32_t Vertex,
+    std::vector<uint32_t>& Neighbors) const{
+    Neighbors.clear();
+    const uint32_t* Refs = m_Refs.data() + m_RefStart[Vertex];
+    for (uint32_t k = 0; k < m_RefCount[Vertex]; k++) {
+        if (!m_FaceAlive[Refs[k]]) {
+            continue;
+        }
+        for (uint32_t Other : m_Faces[Refs[k]]) {
+            if (Other != Vertex) {
+                Neighbors.push_back(Other);
+            }
+        }
+    }
+    std::sort(Neighbors.begin(), Neighbors.end());
+    Neighbors.erase(std::unique(Neighbors.begin(), Neighbors.end()),
+        Neighbors.end());
+}
+
+/*************************************************************************
+【函数名称】        CanCollapse
+【函数功能】        判断塌缩是否合法：
+                   1. 连接条件：两端点的公共邻点恰为共享该边的面的对顶点
+                   （共享面为1或2个），且内部边的两端不能都在边界上；
+                   2. 不产生重复面（如四面体塌缩为两个重合面）；
+                   3. 只含一个端点的相邻面移动后不退化、不翻转
+                   （新旧法向夹角余弦不低于MIN_NORMAL_COSINE）
+【参数】            uint32_t Vertex0, uint32_t Vertex1：边两端顶点
+                   const Coord3D& Position：塌缩后的位置
+                   const std::vector<uint32_t>& Neighbors0,
+                   const std::vector<uint32_t>& Neighbors1：
+                   两端点的相邻顶点（升序去重）
+【返回值】          bool，合法返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool MeshDecimator3D::CanCollapse(uint32_t Vertex0, uint32_t Vertex1,
+    const Coord3D& Position, const std::vector<uint32_t>& Neighbors0,
+    const std::vector<uint32_t>& Neighbors1) const{
+    size_t Common = 0;
+    for (uint32_t Other : Neighbors0) {
+        if (Other != Vertex1 && std::binary_search(Neighbors1.begin(),
+            Neighbors1.end(), Other)) {
+            Common++;
+        }
+    }
+    //共享该边的面数
+    size_t Shared = 0;
+    const uint32_t* Refs0 = m_Refs.data() + m_RefStart[Vertex0];
+    for (uint32_t k = 0; k < m_RefCount[Vertex0]; k++) {
+        const std::array<uint32_t, 3>& Face = m_Faces[Refs0[k]];
+        if (m_FaceAlive[Refs0[k]] && (Face[0] == Vertex1
+            || Face[1] == Vertex1 || Face[2] == Vertex1)) {
+            Shared++;
+        }
+    }
+    if (Shared == 0 || Shared > 2 || Common != Shared) {
+        return false;
+    }
+    if (Shared == 2 && m_VertexBoundary[Vertex0]
+        && m_VertexBoundary[Vertex1]) {
+        return false;
+    }
+    //只含一个端点的面：检查翻转、退化与重复
+    for (uint32_t Moving : {Vertex0, Vertex1}) {
+        uint32_t Fixed = Moving == Vertex0 ? Vertex1 : Vertex0;
+        const uint32_t* Refs = m_Refs.data() + m_RefStart[Moving];
+        for (uint32_t k = 0; k < m_RefCount[Moving]; k++) {
+            uint32_t Face = Refs[k];
+            const std::array<uint32_t, 3>& Corners = m_Faces[Face];
+            if (!m_FaceAlive[Face] || Corners[0] == Fixed
+                || Corners[1] == Fixed || Corners[2] == Fixed) {
+                continue;
+            }
+            std::array<Coord3D, 3> Moved;
+            for (size_t j = 0; j < 3; j++) {
+                Moved[j] = Corners[j] == Moving ?
+                    Position : m_Positions[Corners[j]];
+            }
+            Coord3D OldCross = FaceCross(Face);
+            Coord3D NewCross = Geometry3D::Cross(
+                Geometry3D::Sub(Moved[1], Moved[0]),
+                Geometry3D::Sub(Moved[2], Moved[0]));
+            double NewLength = Geometry3D::Length(NewCross);
+            if (NewLength == 0.0 || Geometry3D::Dot(OldCross, NewCross)
+                < MIN_NORMAL_COSINE * NewLength
+                * Geometry3D::Length(OldCross)) {
+                return false;
+            }
+            //Vertex1一侧的面改接到Vertex0后，不能与Vertex0一侧的面重复
+            if (Moving != Vertex1) {
+                continue;
+            }
+            const uint32_t* Others = m_Refs.data() + m_RefStart[Vertex0];
+            for (uint32_t m = 0; m < m_RefCount[Vertex0]; m++) {
+                const std::array<uint32_t, 3>& Around = m_Faces[Others[m]];
+                if (!m_FaceAlive[Others[m]]) {
+                    continue;
+                }
+                size_t Match = 0;
+                for (uint32_t Corner : Corners) {
+                    if (Corner != Vertex1 && (Around[0] == Corner
+                        || Around[1] == Corner || Around[2] == Corner)) {
+                        Match++;
+                    }
+                }
+                if (Match == 2) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        Collapse
+【函数功能】        执行塌缩：删除共享该边的面，Vertex1的其余面改接到
+                   Vertex0，合并二次型与边界标记，Vertex0移到新位置并记录
+                   塌缩序号；Vertex0的新相邻面表追加到相邻面数组末尾
+【参数】            uint32_t Vertex0, uint32_t Vertex1：边两端顶点
+                   const Coord3D& Position：塌缩后的位置
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshDecimator3D::Collapse(uint32_t Vertex0, uint32_t Vertex1,
+    const Coord3D& Position){
+    //新相邻面表的起点（先记下，追加过程中数组可能重新分配）
+    const size_t NewStart = m_Refs.size();
+    const uint32_t Start1 = m_RefStart[Vertex1];
+    for (uint32_t k = 0; k < m_RefCount[Vertex1]; k++) {
+        uint32_t Face = m_Refs[Start1 + k];
+        if (!m_FaceAlive[Face]) {
+            continue;
+        }
+        std::array<uint32_t, 3>& Corners = m_Faces[Face];
+        if (Corners[0] == Vertex0 || Corners[1] == Vertex0
+            || Corners[2] == Vertex0) {
+            m_FaceAlive[Face] = 0;
+            m_ullFaceNum--;
+            continue;
+        }
+        for (uint32_t& Corner : Corners) {
+            if (Corner == Vertex1) {
+                Corner = Vertex0;
+            }
+        }
+    }
+    const uint32_t Start0 = m_RefStart[Vertex0];
+    for (uint32_t k = 0; k < m_RefCount[Vertex0]; k++) {
+        uint32_t Face = m_Refs[Start0 + k];
+        if (m_FaceAlive[Face]) {
+            m_Refs.push_back(Face);
+        }
+    }
+    for (uint32_t k = 0; k < m_RefCount[Vertex1]; k++) {
+        uint32_t Face = m_Refs[Start1 + k];
+        if (m_FaceAlive[Face]) {
+            m_Refs.push_back(Face);
+        }
+    }
+    m_RefStart[Vertex0] = static_cast<uint32_t>(NewStart);
+    m_RefCount[Vertex0] = static_cast<uint32_t>(m_Refs.size() - NewStart);
+    m_RefCount[Vertex1] = 0;
+    m_Positions[Vertex0] = Position;
+    m_Quadrics[Vertex0] = AddQuadric(m_Quadrics[Vertex0],
+        m_Quadrics[Vertex1]);
+    m_VertexBoundary[Vertex0] = m_VertexBoundary[Vertex0]
+        | m_VertexBoundary[Vertex1];
+    m_ullCollapseNum++;
+    m_VertexStamps[Vertex0] = static_cast<uint32_t>(m_ullCollapseNum);
+    m_VertexAlive[Vertex1] = 0;
+    //追加部分超过初始长度（三倍面数）时压缩
+    if (m_Refs.size() > 6 * m_Faces.size()) {
+        CompactRefs();
+    }
+}
+
+/*************************************************************************
+【函数名称】        CompactRefs
+【函数功能】        压缩相邻面数组：按顶点顺序重写仍存在顶点的仍存在面
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshDecimator3D::CompactRefs(){
+    std::vector<uint32_t> NewRefs;
+    NewRefs.reserve(3 * m_ullFaceNum);
+    for (size_t v = 0; v < m_Positions.size(); v++) {
+        const uint32_t Start = m_RefStart[v];
+        m_RefStart[v] = static_cast<uint32_t>(NewRefs.size());
+        if (!m_VertexAlive[v]) {
+            m_RefCount[v] = 0;
+            continue;
+        }
+        for (uint32_t k = 0; k < m_RefCount[v]; k++) {
+            if (m_FaceAlive[m_Refs[Start + k]]) {
+                NewRefs.push_back(m_Refs[Start + k]);
+            }
+        }
+        m_RefCount[v] = static_cast<uint32_t>(NewRefs.size()
+            - m_RefStart[v]);
+    }
+    m_Refs.swap(NewRefs);
+}
@@ -0,0 +1,156 @@
+/*************************************************************************
+【文件名】                 MeshDecimator3D.hpp
+【功能模块和目的】          二次误差度量（QEM）边塌缩网格简化类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef MESHDECIMATOR3D_HPP
+#define MESHDECIMATOR3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//uint32_t、uint8_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::numeric_limits所属头文件
+#include <limits>
+
+/*************************************************************************
+【类名】             MeshDecimator3D
+【功能】             三角网格简化：按二次误差度量（Garland-Heckbert）
+                    反复塌缩代价最小的边，直到面数不超过目标或最小代价
+                    超过误差上限
+【接口说明】         工作数据为紧凑数组：顶点坐标、每顶点二次型（对称4×4
+                    矩阵的10个分量）、面的三个顶点编号（32位）与顶点的
+                    相邻面表（共用一个只追加的数组，塌缩后的新表写在末尾，
+                    过长时整体压缩），不构造Face3D对象；
+                    二次型与初始边代价并行计算，边按代价入小顶堆；
+                    堆采用惰性更新：堆元素记录入堆时的塌缩序号，每个顶点
+                    记录最近被修改时的塌缩序号，塌缩只更新保留顶点并把其
+                    新边重新入堆，出堆时端点在入堆后被修改或已删除的项
+                    直接丢弃，总复杂度O(n log n)；堆元素压缩为16字节
+                    （单精度代价只用于排序，出堆后以双精度重算）；
+                    误差为到原始各面所在平面的距离平方和，边界边另加
+                    垂直约束平面以保持边界；
+                    破坏流形（连接条件不满足）或使相邻面翻转、退化的
+                    塌缩被跳过；结果只含仍存在的面与其引用的顶点
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class MeshDecimator3D{
+public:
+    //默认构造函数，空网格
+    MeshDecimator3D() = default;
+    //拷贝构造函数
+    MeshDecimator3D(const MeshDecimator3D& Source) = default;
+    //虚析构函数
+    virtual ~MeshDecimator3D() = default;
+    //赋值运算符
+    MeshDecimator3D& operator=(const MeshDecimator3D& Source) = default;
+
+    //Setter
+    //载入顶点与面（面为顶点下标，含重复顶点的面被忽略），
+    //顶点数或面数超出32位编号范围时返回false
+    bool Load(const std::vector<Coord3D>& Vertices,
+        const std::vector<std::array<size_t, 3>>& Faces);
+    //简化到面数不超过TargetFaceNum，或下一次塌缩的误差超过MaxError
+    void Simplify(size_t TargetFaceNum,
+        double MaxError = std::numeric_limits<double>::infinity());
+
+    //Getter
+    //当前面数
+    size_t FaceNum() const;
+    //已执行塌缩中的最大误差
+    double MaxCollapseError() const;
+    //导出结果：仍存在的面及其引用的顶点（顶点重新编号）
+    void Extract(std::vector<Coord3D>& Vertices,
+        std::vector<std::array<size_t, 3>>& Faces) const;
+
+    //静态常量：边界约束平面相对普通面平面的权重
+    static constexpr double BOUNDARY_WEIGHT{1000.0};
+    //静态常量：塌缩后相邻面法向与原法向夹角余弦的下限（防翻转）
+    static constexpr double MIN_NORMAL_COSINE{0.2};
+
+private:
+    //对称4×4二次型，按行存上三角：
+    //a00 a01 a02 a03 a11 a12 a13 a22 a23 a33
+    using Quadric = std::array<double, 10>;
+    //候选边（堆元素）
+    class Candidate{
+    public:
+        //塌缩代价（单精度，只用于排序）
+        float Cost;
+        //两端顶点
+        uint32_t Vertex0;
+        uint32_t Vertex1;
+        //入堆时的塌缩序号
+        uint32_t Stamp;
+        //小顶堆比较（代价大者优先级低）
+        bool operator<(const Candidate& Other) const;
+    };
+
+    //平面ax+by+cz+d=0的二次型乘以权重
+    static Quadric PlaneQuadric(const Coord3D& Normal, double Offset,
+        double Weight);
+    //二次型相加
+    static Quadric AddQuadric(const Quadric& Lhs, const Quadric& Rhs);
+    //二次型在点处的值（到各平面距离平方和）
+    static double Evaluate(const Quadric& Q, const Coord3D& Point);
+    //求二次型最小点；矩阵接近奇异时在两端点与中点中取最优
+    static Coord3D Optimize(const Quadric& Q, const Coord3D& Point0,
+        const Coord3D& Point1);
+    //面的非单位法向（两倍面积）
+    Coord3D FaceCross(uint32_t Face) const;
+    //两顶点间边的塌缩位置（Position）与代价
+    double CollapseCost(uint32_t Vertex0, uint32_t Vertex1,
+        Coord3D& Position) const;
+    //计算两顶点间边的塌缩代价，生成堆元素
+    Candidate MakeCandidate(uint32_t Vertex0, uint32_t Vertex1) const;
+    //收集顶点相邻且仍存在的面的其他顶点（升序去重）
+    void CollectNeighbors(uint32_t Vertex,
+        std::vector<uint32_t>& Neighbors) const;
+    //判断把两顶点塌缩到新位置是否合法（连接条件、翻转与退化），
+    //Neighbors0、Neighbors1为两端点的相邻顶点
+    bool CanCollapse(uint32_t Vertex0, uint32_t Vertex1,
+        const Coord3D& Position, const std::vector<uint32_t>& Neighbors0,
+        const std::vector<uint32_t>& Neighbors1) const;
+    //执行塌缩：Vertex1并入Vertex0，新相邻面表写在相邻面数组末尾
+    void Collapse(uint32_t Vertex0, uint32_t Vertex1,
+        const Coord3D& Position);
+    //压缩相邻面数组，只保留仍存在顶点的仍存在面
+    void CompactRefs();
+
+    //顶点坐标
+    std::vector<Coord3D> m_Positions{};
+    //顶点二次型
+    std::vector<Quadric> m_Quadrics{};
+    //顶点最近一次被修改时的塌缩序号（晚于堆元素的序号则该元素失效）
+    std::vector<uint32_t> m_VertexStamps{};
+    //顶点是否仍存在
+    std::vector<uint8_t> m_VertexAlive{};
+    //顶点是否在边界上
+    std::vector<uint8_t> m_VertexBoundary{};
+    //顶点相邻面表在m_Refs中的起点与长度（可能含已删除的面）
+    std::vector<uint32_t> m_RefStart{};
+    std::vector<uint32_t> m_RefCount{};
+    //相邻面数组（只追加，定期压缩）
+    std::vector<uint32_t> m_Refs{};
+    //每个面的三个顶点
+    std::vector<std::array<uint32_t, 3>> m_Faces{};
+    //面是否仍存在
+    std::vector<uint8_t> m_FaceAlive{};
+    //仍存在的面数
+    size_t m_ullFaceNum{0};
+    //已执行的塌缩次数
+    size_t m_ullCollapseNum{0};
+    //已执行塌缩中的最大误差
+    double m_rMaxError{0.0};
+};
+
+#endif //MESHDECIMATOR3D_HPP
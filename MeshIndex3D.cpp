@@ -0,0 +1,374 @@
+/*************************************************************************
+【文件名】                 MeshIndex3D.cpp
+【功能模块和目的】          模型网格索引（去重顶点与元素顶点下标）类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加容差顶点焊接
+                          梁思奇 2026/10/18 增加连通分量标记
+*************************************************************************/
+
+//自身类头文件
+#include "MeshIndex3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::vector所属头文件
+#include <vector>
+//std::pair所属头文件
+#include <utility>
+//int64_t、uint64_t所属头文件
+#include <cstdint>
+//std::floor所属头文件
+#include <cmath>
+//std::min、std::max所属头文件
+#include <algorithm>
+//std::atomic所属头文件
+#include <atomic>
+
+//空间哈希单元坐标
+using Cell3D = std::array<int64_t, 3>;
+
+/*************************************************************************
+【函数名称】        ToCell
+【函数功能】        计算坐标所在的空间哈希单元（超大坐标截断，避免溢出）
+【参数】            const Coord3D& Point：坐标
+                   double InvCellSize：单元边长倒数
+【返回值】          Cell3D，单元坐标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static Cell3D ToCell(const Coord3D& Point, double InvCellSize){
+    //单元坐标上限2^62
+    const double Limit = 4611686018427387904.0;
+    Cell3D Cell;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        double Value = std::floor(Point[Axis] * InvCellSize);
+        Value = std::max(-Limit, std::min(Limit, Value));
+        Cell[Axis] = static_cast<int64_t>(Value);
+    }
+    return Cell;
+}
+
+/*************************************************************************
+【函数名称】        HashCell
+【函数功能】        单元坐标哈希（各轴乘大奇数后异或，再混合高位）
+【参数】            const Cell3D& Cell：单元坐标
+【返回值】          uint64_t，哈希值
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static uint64_t HashCell(const Cell3D& Cell){
+    uint64_t Hash = static_cast<uint64_t>(Cell[0]) * 0x9E3779B97F4A7C15ull
+        ^ static_cast<uint64_t>(Cell[1]) * 0xC2B2AE3D27D4EB4Full
+        ^ static_cast<uint64_t>(Cell[2]) * 0x165667B19E3779F9ull;
+    return Hash ^ (Hash >> 29);
+}
+
+/*************************************************************************
+【函数名称】        FindRoot
+【函数功能】        并发并查集查找根，顺带路径减半（CAS失败说明已被
+                   其他线程改写，不影响正确性）
+【参数】            std::vector<std::atomic<size_t>>& Parents：父节点表
+                   size_t Node：节点
+【返回值】          size_t，根节点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static size_t FindRoot(std::vector<std::atomic<size_t>>& Parents,
+    size_t Node){
+    while (true) {
+        size_t Parent = Parents[Node].load(std::memory_order_relaxed);
+        if (Parent == Node) {
+            return Node;
+        }
+        size_t GrandParent = Parents[Parent].load(std::memory_order_relaxed);
+        if (GrandParent != Parent) {
+            Parents[Node].compare_exchange_weak(Parent, GrandParent,
+                std::memory_order_relaxed);
+        }
+        Node = GrandParent;
+    }
+}
+
+/*************************************************************************
+【函数名称】        UniteRoots
+【函数功能】        并发并查集合并：较大的根以CAS挂到较小的根下，
+                   CAS失败（该根已被其他线程挂走）则重新查找
+【参数】            std::vector<std::atomic<size_t>>& Parents：父节点表
+                   size_t A, size_t B：待合并的两个节点
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void UniteRoots(std::vector<std::atomic<size_t>>& Parents,
+    size_t A, size_t B){
+    while (true) {
+        A = FindRoot(Parents, A);
+        B = FindRoot(Parents, B);
+        if (A == B) {
+            return;
+        }
+        if (A < B) {
+            std::swap(A, B);
+        }
+        size_t Expected = A;
+        if (Parents[A].compare_exchange_strong(Expected, B,
+            std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        MeshIndex3D
+【函数功能】        拷贝构造函数
+【参数】            const MeshIndex3D& Source：另一个MeshIndex3D对象
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeshIndex3D::MeshIndex3D(const MeshIndex3D& Source)
+    : m_Vertices(Source.m_Vertices),
+    m_FaceVertices(Source.m_FaceVertices),
+    m_LineVertices(Source.m_LineVertices){
+}
+
+/*************************************************************************
+【函数名称】        operator=
+【函数功能】        赋值运算符
+【参数】            const MeshIndex3D& Source：另一个MeshIndex3D对象
+【返回值】          当前MeshIndex3D对象的引用
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+MeshIndex3D& MeshIndex3D::operator=(const MeshIndex3D& Source){
+    if (this != &Source) {
+        m_Vertices = Source.m_Vertices;
+        m_FaceVertices = Source.m_FaceVertices;
+        m_LineVertices = Source.m_LineVertices;
+    }
+    return *this;
+}
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        构建网格索引：所有元素顶点连同其位置编号一起按坐标
+                   字典序并行排序，相邻相同坐标合并为一个顶点，
+                   再按位置编号回填各面、线的顶点下标
+【参数】            const std::vector<Triangle3D>& Triangles：各面三角形
+                   const std::vector<Segment3D>& Segments：各线段
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshIndex3D::Build(const std::vector<Triangle3D>& Triangles,
+    const std::vector<Segment3D>& Segments){
+    size_t FaceSlotNum = Triangles.size() * 3;
+    size_t SlotNum = FaceSlotNum + Segments.size() * 2;
+    //顶点坐标与位置编号（面顶点在前，线顶点在后）
+    std::vector<std::pair<Coord3D, size_t>> Slots(SlotNum);
+    Parallel::For(0, Triangles.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 3; k++) {
+                Slots[i * 3 + k] = std::make_pair(Triangles[i][k], i * 3 + k);
+            }
+        }
+    });
+    Parallel::For(0, Segments.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 2; k++) {
+                Slots[FaceSlotNum + i * 2 + k] = std::make_pair(
+                    Segments[i][k], FaceSlotNum + i * 2 + k);
+            }
+        }
+    });
+    Parallel::Sort(Slots.begin(), Slots.end(),
+        [](const std::pair<Coord3D, size_t>& Lhs,
+            const std::pair<Coord3D, size_t>& Rhs){
+            return Lhs.first < Rhs.first;});
+    //相邻相同坐标合并
+    std::vector<size_t> SlotToVertex(SlotNum);
+    m_Vertices.clear();
+    for (size_t i = 0; i < SlotNum; i++) {
+        if (i == 0 || Slots[i].first != Slots[i - 1].first) {
+            m_Vertices.push_back(Slots[i].first);
+        }
+        SlotToVertex[Slots[i].second] = m_Vertices.size() - 1;
+    }
+    //回填元素顶点下标
+    m_FaceVertices.resize(Triangles.size());
+    m_LineVertices.resize(Segments.size());
+    Parallel::For(0, Triangles.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 3; k++) {
+                m_FaceVertices[i][k] = SlotToVertex[i * 3 + k];
+            }
+        }
+    });
+    Parallel::For(0, Segments.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 2; k++) {
+                m_LineVertices[i][k] = SlotToVertex[FaceSlotNum + i * 2 + k];
+            }
+        }
+    });
+}
+
+/*************************************************************************
+【函数名称】        Weld
+【函数功能】        容差顶点焊接：以容差为边长划分空间哈希单元，
+                   并行地为每个顶点在所在及相邻共27个单元中找到
+                   距离不超过容差的最小下标顶点作为父顶点，
+                   再沿父顶点链（父下标总小于自身）求出代表顶点；
+                   相近顶点链式相连时整条链焊接到同一顶点
+【参数】            double Tolerance：焊接容差，不大于0时不焊接
+                   std::vector<size_t>& Representatives：各顶点焊接到的
+                   顶点下标（重写），未焊接的顶点为自身
+【返回值】          size_t，被焊接（代表顶点不是自身）的顶点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t MeshIndex3D::Weld(double Tolerance,
+    std::vector<size_t>& Representatives) const{
+    size_t Count = m_Vertices.size();
+    Representatives.resize(Count);
+    for (size_t i = 0; i < Count; i++) {
+        Representatives[i] = i;
+    }
+    if (!(Tolerance > 0.0) || Count < 2) {
+        return 0;
+    }
+    double InvCellSize = 1.0 / Tolerance;
+    double ToleranceSquare = Tolerance * Tolerance;
+    //哈希表大小取不小于2n的2的幂
+    size_t TableSize = 1;
+    while (TableSize < Count * 2) {
+        TableSize <<= 1;
+    }
+    uint64_t Mask = static_cast<uint64_t>(TableSize - 1);
+    //并行计算各顶点所在单元与哈希桶
+    std::vector<Cell3D> Cells(Count);
+    std::vector<size_t> Buckets(Count);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            Cells[i] = ToCell(m_Vertices[i], InvCellSize);
+            Buckets[i] = static_cast<size_t>(HashCell(Cells[i]) & Mask);
+        }
+    });
+    //计数排序得到各桶的顶点列表（桶内下标升序）
+    std::vector<size_t> Starts(TableSize + 1, 0);
+    for (size_t i = 0; i < Count; i++) {
+        Starts[Buckets[i] + 1]++;
+    }
+    for (size_t b = 0; b < TableSize; b++) {
+        Starts[b + 1] += Starts[b];
+    }
+    std::vector<size_t> Order(Count);
+    std::vector<size_t> Cursor(Starts.begin(), Starts.end() - 1);
+    for (size_t i = 0; i < Count; i++) {
+        Order[Cursor[Buckets[i]]++] = i;
+    }
+    //并行查找父顶点：相邻单元中容差内的最小下标顶点
+    std::vector<size_t> Parents(Count);
+    Parallel::For(0, Count, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t Best = i;
+            for (int64_t dz = -1; dz <= 1; dz++) {
+                for (int64_t dy = -1; dy <= 1; dy++) {
+                    for (int64_t dx = -1; dx <= 1; dx++) {
+                        Cell3D Neighbor{Cells[i][0] + dx, Cells[i][1] + dy,
+                            Cells[i][2] + dz};
+                        size_t Bucket = static_cast<size_t>(
+                            HashCell(Neighbor) & Mask);
+                        for (size_t k = Starts[Bucket];
+                            k < Starts[Bucket + 1]; k++) {
+                            size_t j = Order[k];
+                            //桶内升序，不小于当前最优即可结束
+                            if (j >= Best) {
+                                break;
+                            }
+                            if (Cells[j] != Neighbor) {
+                                continue;
+                            }
+                            Coord3D Delta = Geometry3D::Sub(
+                                m_Vertices[j], m_Vertices[i]);
+                            if (Geometry3D::Dot(Delta, Delta) 
+                                <= ToleranceSquare) {
+                                Best = j;
+                            }
+                        }
+                    }
+                }
+            }
+            Parents[i] = Best;
+        }
+    }, 256);
+    //父下标总小于自身，按下标顺序一次求出代表顶点
+    size_t WeldCount = 0;
+    for (size_t i = 0; i < Count; i++) {
+        if (Parents[i] != i) {
+            Representatives[i] = Representatives[Parents[i]];
+            WeldCount++;
+        }
+    }
+    return WeldCount;
+}
+
+/*************************************************************************
+【函数名称】        LabelComponents
+【函数功能】        按共享顶点标记连通分量：各线程并发地把每个面、线的
+                   顶点合并到同一集合，再并行查找各元素的根，
+                   最后按面、线顺序依次为新出现的根编号
+【参数】            std::vector<size_t>& FaceLabels：各面分量编号（重写）
+                   std::vector<size_t>& LineLabels：各线分量编号（重写）
+【返回值】          size_t，连通分量数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t MeshIndex3D::LabelComponents(std::vector<size_t>& FaceLabels,
+    std::vector<size_t>& LineLabels) const{
+    size_t VertexCount = m_Vertices.size();
+    std::vector<std::atomic<size_t>> Parents(VertexCount);
+    Parallel::For(0, VertexCount, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            Parents[i].store(i, std::memory_order_relaxed);
+        }
+    });
+    Parallel::For(0, m_FaceVertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            UniteRoots(Parents, m_FaceVertices[i][0], m_FaceVertices[i][1]);
+            UniteRoots(Parents, m_FaceVertices[i][0], m_FaceVertices[i][2]);
+        }
+    });
+    Parallel::For(0, m_LineVertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            UniteRoots(Parents, m_LineVertices[i][0], m_LineVertices[i][1]);
+        }
+    });
+    //并行查找各元素的根（合并已全部完成，根即分量内最小顶点下标）
+    FaceLabels.resize(m_FaceVertices.size());
+    LineLabels.resize(m_LineVertices.size());
+    Parallel::For(0, m_FaceVertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            FaceLabels[i] = FindRoot(Parents, m_FaceVertices[i][0]);
+        }
+    });
+    Parallel::For(0, m_LineVertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            LineLabels[i] = FindRoot(Parents, m_LineVertices[i][0]);
+        }
+    });
+    //按元素首次出现顺序编号
+    std::vector<size_t> RootLabels(VertexCount, SIZE_MAX);
+    size_t ComponentCount = 0;
+    auto Relabel = [&](std::vector<size_t>& Labels){
+        for (auto& Label : Labels) {
+            if (RootLabels[Label] == SIZE_MAX) {
+                RootLabels[Label] = ComponentCount;
+                ComponentCount++;
+            }
+            Label = RootLabels[Label];
+        }
+    };
+    Relabel(FaceLabels);
+    Relabel(LineLabels);
+    return ComponentCount;
+}
@@ -0,0 +1,74 @@
+/*************************************************************************
+【文件名】                 MeshIndex3D.hpp
+【功能模块和目的】          模型网格索引（去重顶点与元素顶点下标）类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加容差顶点焊接
+                          梁思奇 2026/10/18 增加连通分量标记
+*************************************************************************/
+
+#ifndef MESHINDEX3D_HPP
+#define MESHINDEX3D_HPP
+
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+
+/*************************************************************************
+【类名】             MeshIndex3D
+【功能】             模型网格索引：将Face3D、Line3D中坐标完全相同的点合并
+                    为同一顶点，并记录每个面、线的顶点下标
+【接口说明】         由三角形与线段坐标并行构建（坐标排序去重，O(n log n)），
+                    顶点按坐标字典序排列；供顶点查询、拓扑与批量算法使用
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加容差顶点焊接：以容差为单元边长
+                    做空间哈希，每个顶点只检查所在及相邻共27个单元，
+                    期望O(n)
+                    梁思奇 2026/10/18 增加连通分量标记：并发并查集，
+                    各线程以CAS无锁合并，根总是分量内最小顶点下标
+*************************************************************************/
+class MeshIndex3D{
+public:
+    //默认构造函数，空索引
+    MeshIndex3D() = default;
+    //拷贝构造函数
+    MeshIndex3D(const MeshIndex3D& Source);
+    //虚析构函数
+    virtual ~MeshIndex3D() = default;
+    //赋值运算符
+    MeshIndex3D& operator=(const MeshIndex3D& Source);
+
+    //Setter
+    //由三角形与线段坐标构建（下标即面、线标签）
+    void Build(const std::vector<Triangle3D>& Triangles,
+        const std::vector<Segment3D>& Segments);
+
+    //Getter
+    //容差焊接：Representatives[i]为顶点i焊接到的顶点下标，返回被焊接的顶点数
+    size_t Weld(double Tolerance, std::vector<size_t>& Representatives) const;
+    //按共享顶点标记面、线的连通分量（编号按元素首次出现顺序），返回分量数
+    size_t LabelComponents(std::vector<size_t>& FaceLabels,
+        std::vector<size_t>& LineLabels) const;
+
+    //Getter数据成员
+    //去重后的顶点坐标
+    const std::vector<Coord3D>& Vertices{m_Vertices};
+    //每个面的三个顶点下标
+    const std::vector<std::array<size_t, 3>>& FaceVertices{m_FaceVertices};
+    //每条线的两个顶点下标
+    const std::vector<std::array<size_t, 2>>& LineVertices{m_LineVertices};
+
+private:
+    //去重后的顶点坐标
+    std::vector<Coord3D> m_Vertices{};
+    //每个面的三个顶点下标
+    std::vector<std::array<size_t, 3>> m_FaceVertices{};
+    //每条线的两个顶点下标
+    std::vector<std::array<size_t, 2>> m_LineVertices{};
+};
+
+#endif //MESHINDEX3D_HPP
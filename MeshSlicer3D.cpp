@@ -0,0 +1,377 @@
+/*************************************************************************
+【文件名】                 MeshSlicer3D.cpp
+【功能模块和目的】          三角网格水平平面切片（轮廓提取）类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "MeshSlicer3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//uint8_t、uint64_t、SIZE_MAX所属头文件
+#include <cstdint>
+//std::sort、std::upper_bound、std::lower_bound、std::minmax所属头文件
+#include <algorithm>
+//std::iota所属头文件
+#include <numeric>
+//std::move所属头文件
+#include <utility>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Slice
+【函数功能】        切片：建立按高度排序的工作副本，各层高度排序，各面按
+                   Z范围二分得到跨越的层区间，面-层对按层并行计数排序，
+                   之后按面-层对数均分给各线程并行求各层轮廓
+【参数】            const std::vector<Coord3D>& Vertices：顶点坐标
+                   const std::vector<std::array<size_t, 3>>& Faces：
+                   面的顶点下标
+                   const std::vector<double>& Heights：各平面高度
+                   std::vector<SliceLayer3D>& Layers：各层结果（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshSlicer3D::Slice(const std::vector<Coord3D>& Vertices,
+    const std::vector<std::array<size_t, 3>>& Faces,
+    const std::vector<double>& Heights,
+    std::vector<SliceLayer3D>& Layers){
+    SortByHeight(Vertices, Faces);
+    const size_t LayerNum = Heights.size();
+    const size_t FaceNum = m_Faces.size();
+    //各层按高度排序，Order[k]为第k低的层在Heights中的下标
+    std::vector<size_t> Order(LayerNum);
+    std::iota(Order.begin(), Order.end(), size_t{0});
+    std::sort(Order.begin(), Order.end(), [&](size_t Lhs, size_t Rhs){
+        return Heights[Lhs] < Heights[Rhs];
+    });
+    std::vector<double> Sorted(LayerNum);
+    for (size_t k = 0; k < LayerNum; k++) {
+        Sorted[k] = Heights[Order[k]];
+    }
+    //面跨越高度为H的平面当且仅当ZMin < H ≤ ZMax，
+    //即排序后的层区间[upper_bound(ZMin), upper_bound(ZMax))；
+    //顶点已按高度编号，最低、最高点即编号最小、最大的顶点
+    std::vector<std::array<size_t, 2>> Spans(FaceNum);
+    Parallel::For(0, FaceNum, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            auto Range = std::minmax({m_Faces[i][0], m_Faces[i][1],
+                m_Faces[i][2]});
+            Spans[i][0] = static_cast<size_t>(std::upper_bound(
+                Sorted.begin(), Sorted.end(), m_Vertices[Range.first][2])
+                - Sorted.begin());
+            Spans[i][1] = static_cast<size_t>(std::upper_bound(
+                Sorted.begin(), Sorted.end(), m_Vertices[Range.second][2])
+                - Sorted.begin());
+        }
+    });
+    //面-层对按层计数排序：各块面分别计数，
+    //按（层，块）顺序求前缀和作为各块在各层中的写入位置
+    const size_t ChunkNum = std::max(size_t{1}, std::min(
+        Parallel::ThreadCount(), (FaceNum + Parallel::DEFAULT_MIN_CHUNK - 1)
+        / Parallel::DEFAULT_MIN_CHUNK));
+    const size_t ChunkSize = (FaceNum + ChunkNum - 1) / ChunkNum;
+    std::vector<size_t> Offsets(ChunkNum * LayerNum, 0);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t* Counts = Offsets.data() + c * LayerNum;
+            size_t End = std::min(FaceNum, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                for (size_t k = Spans[i][0]; k < Spans[i][1]; k++) {
+                    Counts[k]++;
+                }
+            }
+        }
+    }, 1);
+    std::vector<size_t> LayerStart(LayerNum + 1, 0);
+    size_t Total = 0;
+    for (size_t k = 0; k < LayerNum; k++) {
+        LayerStart[k] = Total;
+        for (size_t c = 0; c < ChunkNum; c++) {
+            size_t Count = Offsets[c * LayerNum + k];
+            Offsets[c * LayerNum + k] = Total;
+            Total += Count;
+        }
+    }
+    LayerStart[LayerNum] = Total;
+    std::vector<size_t> Buckets(Total);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t* Cursors = Offsets.data() + c * LayerNum;
+            size_t End = std::min(FaceNum, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                for (size_t k = Spans[i][0]; k < Spans[i][1]; k++) {
+                    Buckets[Cursors[k]++] = i;
+                }
+            }
+        }
+    }, 1);
+    //各层并行求轮廓：按面-层对数把连续的层均分给各线程
+    Layers.assign(LayerNum, SliceLayer3D{});
+    const size_t TaskNum = Parallel::ThreadCount();
+    auto TaskBound = [&](size_t Task){
+        if (Task >= TaskNum) {
+            return LayerNum;
+        }
+        return static_cast<size_t>(std::lower_bound(LayerStart.begin(),
+            LayerStart.begin() + LayerNum, Task * Total / TaskNum)
+            - LayerStart.begin());
+    };
+    Parallel::For(0, TaskNum, [&](size_t First, size_t Last){
+        Workspace Work;
+        for (size_t t = First; t < Last; t++) {
+            size_t End = TaskBound(t + 1);
+            for (size_t k = TaskBound(t); k < End; k++) {
+                SliceLayer3D& Layer = Layers[Order[k]];
+                Layer.Height = Sorted[k];
+                SliceLayer(Buckets.data() + LayerStart[k],
+                    Buckets.data() + LayerStart[k + 1], Work, Layer);
+            }
+        }
+    }, 1);
+    m_ullSegmentNum = Total;
+    m_Vertices = {};
+    m_Faces = {};
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        SegmentNum
+【函数功能】        获取上次切片全部层的交线段数
+【参数】            无
+【返回值】          size_t，交线段数（含长度为0的段，即面-层对数）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t MeshSlicer3D::SegmentNum() const{
+    return m_ullSegmentNum;
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        SortByHeight
+【函数功能】        建立工作副本：顶点按高度并行排序后重新编号，面改用
+                   新编号（绕向不变）后按最低点（即最小编号）并行排序
+【参数】            const std::vector<Coord3D>& Vertices：顶点坐标
+                   const std::vector<std::array<size_t, 3>>& Faces：
+                   面的顶点下标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshSlicer3D::SortByHeight(const std::vector<Coord3D>& Vertices,
+    const std::vector<std::array<size_t, 3>>& Faces){
+    std::vector<size_t> Order(Vertices.size());
+    std::iota(Order.begin(), Order.end(), size_t{0});
+    Parallel::Sort(Order.begin(), Order.end(), [&](size_t Lhs, size_t Rhs){
+        return Vertices[Lhs][2] < Vertices[Rhs][2];
+    });
+    std::vector<size_t> NewIndex(Vertices.size());
+    m_Vertices.resize(Vertices.size());
+    Parallel::For(0, Vertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            m_Vertices[i] = Vertices[Order[i]];
+            NewIndex[Order[i]] = i;
+        }
+    });
+    m_Faces.resize(Faces.size());
+    Parallel::For(0, Faces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            m_Faces[i] = {{NewIndex[Faces[i][0]], NewIndex[Faces[i][1]],
+                NewIndex[Faces[i][2]]}};
+        }
+    });
+    Parallel::Sort(m_Faces.begin(), m_Faces.end(),
+        [](const std::array<size_t, 3>& Lhs,
+            const std::array<size_t, 3>& Rhs){
+        return std::min({Lhs[0], Lhs[1], Lhs[2]})
+            < std::min({Rhs[0], Rhs[1], Rhs[2]});
+    });
+}
+
+/*************************************************************************
+【函数名称】        EdgePoint
+【函数功能】        求边与平面的交点：由上方端点向下方端点插值，
+                   上方端点恰在平面上时结果即为该端点；
+                   只取决于边本身，两侧的面得到完全相同的点
+【参数】            size_t Above：高度不低于平面的端点
+                   size_t Below：高度低于平面的端点
+                   double Height：平面高度
+【返回值】          Coord3D，交点（Z坐标取平面高度）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D MeshSlicer3D::EdgePoint(size_t Above, size_t Below,
+    double Height) const{
+    const Coord3D& Upper = m_Vertices[Above];
+    const Coord3D& Lower = m_Vertices[Below];
+    double T = (Upper[2] - Height) / (Upper[2] - Lower[2]);
+    return {{Upper[0] + T * (Lower[0] - Upper[0]),
+        Upper[1] + T * (Lower[1] - Upper[1]), Height}};
+}
+
+/*************************************************************************
+【函数名称】        CutFace
+【函数功能】        求面与平面的交线段：按面的绕向，由上方到下方的边
+                   为起点边，由下方到上方的边为终点边
+【参数】            size_t Face：面下标（工作副本中的下标）
+                   double Height：平面高度
+                   Segment& Result：交线段
+【返回值】          bool，面跨越平面返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool MeshSlicer3D::CutFace(size_t Face, double Height,
+    Segment& Result) const{
+    const std::array<size_t, 3>& Corners = m_Faces[Face];
+    bool IsAbove[3];
+    for (size_t k = 0; k < 3; k++) {
+        IsAbove[k] = m_Vertices[Corners[k]][2] >= Height;
+    }
+    if (IsAbove[0] == IsAbove[1] && IsAbove[1] == IsAbove[2]) {
+        return false;
+    }
+    for (size_t k = 0; k < 3; k++) {
+        size_t From = Corners[k];
+        size_t To = Corners[(k + 1) % 3];
+        if (IsAbove[k] && !IsAbove[(k + 1) % 3]) {
+            Result.StartEdge = std::minmax(From, To);
+            Result.Start = EdgePoint(From, To, Height);
+        }
+        else if (!IsAbove[k] && IsAbove[(k + 1) % 3]) {
+            Result.EndEdge = std::minmax(From, To);
+            Result.End = EdgePoint(To, From, Height);
+        }
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        SliceLayer
+【函数功能】        求一层的轮廓：各面交线段以起点边为键放入散列表，
+                   每段的下一段为起点边等于其终点边且尚无前驱的段；
+                   先从无前驱的段出发得到不闭合的轮廓，余下的段都在
+                   环上，得到闭合轮廓；长度为0的段与重复点被合并，
+                   不足以成形的轮廓被丢弃
+【参数】            const size_t* FaceBegin, const size_t* FaceEnd：
+                   跨越该层的面下标
+                   Workspace& Work：工作数组（会被重写）
+                   SliceLayer3D& Layer：该层结果（轮廓会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshSlicer3D::SliceLayer(const size_t* FaceBegin,
+    const size_t* FaceEnd, Workspace& Work, SliceLayer3D& Layer) const{
+    Layer.Contours.clear();
+    std::vector<Segment>& Segments = Work.Segments;
+    Segments.clear();
+    Segment Cut;
+    for (const size_t* Face = FaceBegin; Face != FaceEnd; Face++) {
+        if (CutFace(*Face, Layer.Height, Cut)) {
+            Segments.push_back(Cut);
+        }
+    }
+    const size_t Num = Segments.size();
+    //散列表容量取不小于段数两倍的2的幂，线性探测
+    size_t Mask = 1;
+    while (Mask < 2 * Num) {
+        Mask <<= 1;
+    }
+    Mask--;
+    Work.Table.assign(Mask + 1, SIZE_MAX);
+    for (size_t i = 0; i < Num; i++) {
+        size_t Slot = HashEdge(Segments[i].StartEdge) & Mask;
+        while (Work.Table[Slot] != SIZE_MAX) {
+            Slot = (Slot + 1) & Mask;
+        }
+        Work.Table[Slot] = i;
+    }
+    //首尾相接：Next[i]为第i段的下一段，无下一段时为Num
+    Work.Next.assign(Num, Num);
+    Work.HasPrev.assign(Num, 0);
+    for (size_t i = 0; i < Num; i++) {
+        const EdgeKey& Key = Segments[i].EndEdge;
+        for (size_t Slot = HashEdge(Key) & Mask;
+            Work.Table[Slot] != SIZE_MAX; Slot = (Slot + 1) & Mask) {
+            size_t j = Work.Table[Slot];
+            if (Segments[j].StartEdge == Key && j != i && !Work.HasPrev[j]) {
+                Work.Next[i] = j;
+                Work.HasPrev[j] = 1;
+                break;
+            }
+        }
+    }
+    Work.IsVisited.assign(Num, 0);
+    //不闭合的轮廓：从无前驱的段出发直到无下一段
+    for (size_t i = 0; i < Num; i++) {
+        if (Work.HasPrev[i]) {
+            continue;
+        }
+        SliceContour3D Contour{{}, false};
+        size_t Last = i;
+        for (size_t j = i; j != Num; j = Work.Next[j]) {
+            Work.IsVisited[j] = 1;
+            AppendPoint(Contour, Segments[j].Start);
+            Last = j;
+        }
+        AppendPoint(Contour, Segments[Last].End);
+        if (Contour.Points.size() >= 2) {
+            Layer.Contours.push_back(std::move(Contour));
+        }
+    }
+    //闭合的轮廓：余下的段都在环上
+    for (size_t i = 0; i < Num; i++) {
+        if (Work.IsVisited[i]) {
+            continue;
+        }
+        SliceContour3D Contour{{}, true};
+        size_t j = i;
+        do {
+            Work.IsVisited[j] = 1;
+            AppendPoint(Contour, Segments[j].Start);
+            j = Work.Next[j];
+        } while (j != i);
+        if (Contour.Points.size() > 1
+            && Contour.Points.back() == Contour.Points.front()) {
+            Contour.Points.pop_back();
+        }
+        if (Contour.Points.size() >= 3) {
+            Layer.Contours.push_back(std::move(Contour));
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        HashEdge
+【函数功能】        边编号的散列值（两端点下标分别乘以奇常数后异或混合）
+【参数】            const EdgeKey& Key：边编号
+【返回值】          size_t，散列值
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t MeshSlicer3D::HashEdge(const EdgeKey& Key){
+    uint64_t Hash = static_cast<uint64_t>(Key.first) * 0x9E3779B97F4A7C15ULL
+        ^ static_cast<uint64_t>(Key.second) * 0xC2B2AE3D27D4EB4FULL;
+    return static_cast<size_t>(Hash ^ (Hash >> 32));
+}
+
+/*************************************************************************
+【函数名称】        AppendPoint
+【函数功能】        把点加入轮廓末尾，与上一点完全相同时忽略
+【参数】            SliceContour3D& Contour：轮廓
+                   const Coord3D& Point：点
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void MeshSlicer3D::AppendPoint(SliceContour3D& Contour,
+    const Coord3D& Point){
+    if (Contour.Points.empty() || Contour.Points.back() != Point) {
+        Contour.Points.push_back(Point);
+    }
+}
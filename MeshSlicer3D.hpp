@@ -0,0 +1,152 @@
+/*************************************************************************
+【文件名】                 MeshSlicer3D.hpp
+【功能模块和目的】          三角网格水平平面切片（轮廓提取）类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef MESHSLICER3D_HPP
+#define MESHSLICER3D_HPP
+
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//uint8_t所属头文件
+#include <cstdint>
+//std::pair所属头文件
+#include <utility>
+
+/*************************************************************************
+【类名】             SliceContour3D
+【功能】             切片轮廓：平面上依次相连的折线
+【接口说明】         数据类，成员公开；闭合轮廓的首点不在末尾重复，
+                    末点与首点之间隐含一段；相邻点互不相同
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class SliceContour3D{
+public:
+    //依次相连的点（Z坐标均等于所在层高度）
+    std::vector<Coord3D> Points;
+    //是否闭合（网格在该处有边界或非流形边时可能不闭合）
+    bool IsClosed;
+};
+
+/*************************************************************************
+【类名】             SliceLayer3D
+【功能】             一层切片：一个水平平面与网格的全部交线轮廓
+【接口说明】         数据类，成员公开；网格绕向一致且外法向朝外时，
+                    从+Z方向看外轮廓为逆时针，孔为顺时针
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class SliceLayer3D{
+public:
+    //平面高度（Z = Height）
+    double Height;
+    //该层的全部轮廓
+    std::vector<SliceContour3D> Contours;
+};
+
+/*************************************************************************
+【类名】             MeshSlicer3D
+【功能】             用一组水平平面切割三角网格，得到每层的交线轮廓
+【接口说明】         顶点高度不低于平面视为在上方（其余在下方），面跨越
+                    平面当且仅当三顶点不全在同侧，此时恰有两条边跨越，
+                    交线段由“上到下”的边指向“下到上”的边（按面的绕向）；
+                    交点只由边的两端点决定，相邻面在共享边上得到完全
+                    相同的点，轮廓因此严格闭合；
+                    切片前建立工作副本：顶点按高度排序并重新编号，面按
+                    最低点高度排序，同一层的面与顶点因此在内存中大致
+                    连续；各层高度排序后，每个面按其Z范围二分得到所跨越
+                    的层区间，只与这些层求交：面-层对按层做并行计数排序
+                    （各块面分别计数、按层与块顺序求前缀和后并行填入）；
+                    之后各层并行求交线段，以起点边为键放入开放寻址
+                    散列表，每段的下一段即起点边等于其终点边的段，
+                    不需排序即可首尾相接串成轮廓
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class MeshSlicer3D{
+public:
+    //默认构造函数，无切片结果
+    MeshSlicer3D() = default;
+    //拷贝构造函数
+    MeshSlicer3D(const MeshSlicer3D& Source) = default;
+    //虚析构函数
+    virtual ~MeshSlicer3D() = default;
+    //赋值运算符
+    MeshSlicer3D& operator=(const MeshSlicer3D& Source) = default;
+
+    //Setter
+    //用高度为Heights的各平面切割网格（高度顺序任意，可重复），
+    //结果Layers各层与Heights一一对应
+    void Slice(const std::vector<Coord3D>& Vertices,
+        const std::vector<std::array<size_t, 3>>& Faces,
+        const std::vector<double>& Heights,
+        std::vector<SliceLayer3D>& Layers);
+
+    //Getter
+    //上次切片全部层的交线段数（含长度为0的段）
+    size_t SegmentNum() const;
+
+private:
+    //边编号：两端点下标（较小者在前）
+    using EdgeKey = std::pair<size_t, size_t>;
+    //一个面与平面的交线段
+    class Segment{
+    public:
+        //起点所在边（按面绕向由上方到下方的边）
+        EdgeKey StartEdge;
+        //终点所在边（按面绕向由下方到上方的边）
+        EdgeKey EndEdge;
+        //起点
+        Coord3D Start;
+        //终点
+        Coord3D End;
+    };
+
+    //各线程复用的单层工作数组
+    class Workspace{
+    public:
+        //该层的交线段
+        std::vector<Segment> Segments;
+        //以起点边为键的散列表（段下标，空位为SIZE_MAX）
+        std::vector<size_t> Table;
+        //每段的下一段（无下一段时为段数）
+        std::vector<size_t> Next;
+        //每段是否已有前驱
+        std::vector<uint8_t> HasPrev;
+        //每段是否已串入轮廓
+        std::vector<uint8_t> IsVisited;
+    };
+
+    //建立工作副本：顶点按高度排序并重新编号，面按最低点高度排序
+    void SortByHeight(const std::vector<Coord3D>& Vertices,
+        const std::vector<std::array<size_t, 3>>& Faces);
+    //上方顶点Above与下方顶点Below所连边与平面的交点
+    Coord3D EdgePoint(size_t Above, size_t Below, double Height) const;
+    //求一个面与平面的交线段，面不跨越平面时返回false
+    bool CutFace(size_t Face, double Height, Segment& Result) const;
+    //求一层：对指定面求交线段并串成轮廓
+    void SliceLayer(const size_t* FaceBegin, const size_t* FaceEnd,
+        Workspace& Work, SliceLayer3D& Layer) const;
+    //边编号的散列值
+    static size_t HashEdge(const EdgeKey& Key);
+    //把点加入轮廓（与上一点相同时忽略）
+    static void AppendPoint(SliceContour3D& Contour, const Coord3D& Point);
+
+    //按高度排序的顶点（仅切片期间有效）
+    std::vector<Coord3D> m_Vertices{};
+    //按最低点高度排序、以新顶点编号表示的面（仅切片期间有效）
+    std::vector<std::array<size_t, 3>> m_Faces{};
+    //上次切片全部层的交线段数
+    size_t m_ullSegmentNum{0};
+};
+
+#endif //MESHSLICER3D_HPP
@@ -4,6 +4,32 @@
 【开发者及日期】            梁思奇 2024/8/5
 【更改记录】               梁思奇 2024/8/8 调整bug并增加对点线面的操作
                           梁思奇 2024/8/9 增加模型元素批量合并与移除接口
+                          梁思奇 2026/10/18 增加按标签O(1)删除与批量删除
+                          梁思奇 2026/10/18 增加面BVH射线查询与按标签改点
+                          梁思奇 2026/10/18 增加批量射线查询
+                          梁思奇 2026/10/18 增加网格索引与顶点k-d树
+                          梁思奇 2026/10/18 增加元素空间网格与区域查询
+                          梁思奇 2026/10/18 增加容差顶点焊接
+                          梁思奇 2026/10/18 增加半边拓扑结构
+                          梁思奇 2026/10/18 增加连通分量拆分与小碎块删除
+                          梁思奇 2026/10/18 增加网格校验报告
+                          梁思奇 2026/10/18 增加体积、质心与惯性张量
+                          梁思奇 2026/10/18 增加有向包围盒与包围球
+                          梁思奇 2026/10/18 增加凸包
+                          梁思奇 2026/10/18 增加面法向与顶点法向缓冲区
+                          梁思奇 2026/10/18 增加SIMD批量面积与长度计算
+                          梁思奇 2026/10/18 面积、长度总和改为补偿累加并
+                          增加漂移校验
+                          梁思奇 2026/10/18 增加QEM网格简化
+                          梁思奇 2026/10/18 增加由索引网格直接创建模型
+                          梁思奇 2026/10/18 增加水平平面切片
+                          梁思奇 2026/10/18 增加表面与实体体素化
+                          梁思奇 2026/10/18 增加批量点内外判定
+                          梁思奇 2026/10/18 增加模型间面相交查询
+                          梁思奇 2026/10/18 增加模型间表面距离
+                          梁思奇 2026/10/18 增加结构差异与补丁
+                          梁思奇 2026/10/18 增加整体仿射变换
+                          梁思奇 2026/10/18 增加共享顶点移动
 *************************************************************************/
 
 //自身类头文件
@@ -26,6 +52,40 @@
 #include <functional>
 //std::string所属头文件
 #include <string>
+//BVH3D类所属头文件
+#include "BVH3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//KDTree3D类所属头文件
+#include "KDTree3D.hpp"
+//SpatialGrid3D类所属头文件
+#include "SpatialGrid3D.hpp"
+//HalfEdgeMesh3D类所属头文件
+#include "HalfEdgeMesh3D.hpp"
+//CompensatedSum类所属头文件
+#include "CompensatedSum.hpp"
+//BoundingVolume3D类所属头文件
+#include "BoundingVolume3D.hpp"
+//ConvexHull3D类所属头文件
+#include "ConvexHull3D.hpp"
+//NormalBuffer3D类所属头文件
+#include "NormalBuffer3D.hpp"
+//MeasureKernel3D类所属头文件
+#include "MeasureKernel3D.hpp"
+//MeshDecimator3D类所属头文件
+#include "MeshDecimator3D.hpp"
+//std::array所属头文件
+#include <array>
+//std::atomic所属头文件
+#include <atomic>
+//std::pair所属头文件
+#include <utility>
+//uint8_t所属头文件
+#include <cstdint>
+//std::abs所属头文件
+#include <cmath>
 
 /*************************************************************************
 【函数名称】        NO_POINT_OPERATE
@@ -58,7 +118,7 @@ Model3D::Model3D(){
 【参数】            const Model3D& Source：另一个Model3D对象
 【返回值】          无
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 同时拷贝面积、长度补偿累加器
 *************************************************************************/
 Model3D::Model3D(const Model3D& Source){
     //拷贝Face3D和Line3D以及其他数据成员
@@ -70,10 +130,14 @@ Model3D::Model3D(const Model3D& Source){
     m_ullElementNum = Source.ElementNum;
     m_rFaceArea_Sum = Source.FaceArea_Sum;
     m_rLineLength_Sum = Source.LineLength_Sum;
+    m_FaceAreaAccumulator = Source.m_FaceAreaAccumulator;
+    m_LineLengthAccumulator = Source.m_LineLengthAccumulator;
     m_rEncaseCuboid_Length = Source.m_rEncaseCuboid_Length;
     m_rEncaseCuboid_Width = Source.m_rEncaseCuboid_Width;
     m_rEncaseCuboid_Height = Source.m_rEncaseCuboid_Height;
     m_rEncaseCuboid_Volume = Source.EncaseCuboid_Volume;
+    m_EncaseCuboid_Min = Source.m_EncaseCuboid_Min;
+    m_EncaseCuboid_Max = Source.m_EncaseCuboid_Max;
     Name = Source.Name;
     Notes = Source.Notes;
 }
@@ -104,7 +168,7 @@ Model3D::Model3D(const std::vector<Face3D>& vFaces,
 【参数】            const Model3D& Source：另一个Model3D对象
 【返回值】          当前Model3D对象的引用
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 同时拷贝面积、长度补偿累加器
 *************************************************************************/
 Model3D& Model3D::operator=(const Model3D& Source){
     //检查自赋值
@@ -116,25 +180,74 @@ Model3D& Model3D::operator=(const Model3D& Source){
         m_ullElementNum = Source.ElementNum;
         m_rFaceArea_Sum = Source.FaceArea_Sum;
         m_rLineLength_Sum = Source.LineLength_Sum;
+        m_FaceAreaAccumulator = Source.m_FaceAreaAccumulator;
+        m_LineLengthAccumulator = Source.m_LineLengthAccumulator;
         m_rEncaseCuboid_Length = Source.m_rEncaseCuboid_Length;
         m_rEncaseCuboid_Width = Source.m_rEncaseCuboid_Width;
         m_rEncaseCuboid_Height = Source.m_rEncaseCuboid_Height;
         m_rEncaseCuboid_Volume = Source.EncaseCuboid_Volume;
+        m_EncaseCuboid_Min = Source.m_EncaseCuboid_Min;
+        m_EncaseCuboid_Max = Source.m_EncaseCuboid_Max;
         Name = Source.Name;
         Notes = Source.Notes;
+        //几何整体变化，BVH失效
+        OnFacesReset();
     }
     return *this;
 }
 
 //Face3D增删改操作
 
+/*************************************************************************
+【函数名称】        FromMesh
+【函数功能】        由索引网格直接创建模型：并行新建Face3D与Line3D对象，
+                   整体替换元素列表并重算统计数据；不做重复元素检查，
+                   调用方保证面、线各自不重复且每个元素的点互不相同
+【参数】            const std::string& Name：模型名
+                   const std::vector<Coord3D>& Vertices：顶点坐标
+                   const std::vector<std::array<size_t, 3>>& Faces：
+                   面的顶点下标
+                   const std::vector<Segment3D>& Segments：线段端点坐标
+【返回值】          std::shared_ptr<Model3D>，新模型
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::shared_ptr<Model3D> Model3D::FromMesh(const std::string& Name,
+    const std::vector<Coord3D>& Vertices,
+    const std::vector<std::array<size_t, 3>>& Faces,
+    const std::vector<Segment3D>& Segments){
+    auto ToPoint = [](const Coord3D& Point){
+        return Point3D(Point[0], Point[1], Point[2]);
+    };
+    std::vector<std::shared_ptr<Face3D>> NewFaces(Faces.size());
+    Parallel::For(0, Faces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            NewFaces[i] = std::make_shared<Face3D>(
+                ToPoint(Vertices[Faces[i][0]]), 
+                ToPoint(Vertices[Faces[i][1]]),
+                ToPoint(Vertices[Faces[i][2]]));
+        }
+    });
+    std::vector<std::shared_ptr<Line3D>> NewLines(Segments.size());
+    Parallel::For(0, Segments.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            NewLines[i] = std::make_shared<Line3D>(
+                ToPoint(Segments[i][0]), ToPoint(Segments[i][1]));
+        }
+    });
+    std::shared_ptr<Model3D> Result = std::make_shared<Model3D>();
+    Result->m_sName = Name;
+    Result->ResetElements(std::move(NewFaces), std::move(NewLines));
+    return Result;
+}
+
 /*************************************************************************
 【函数名称】        AddFace
 【函数功能】        添加一个指定的Face3D对象到模型中
 【参数】            const Face3D& Face1：要添加的Face3D对象
 【返回值】          如果成功添加，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
 *************************************************************************/
 bool Model3D::AddFace(const Face3D& Face1){
     //查找是否已经存在相同的Face3D
@@ -152,9 +265,11 @@ bool Model3D::AddFace(const Face3D& Face1){
     //元素数加1
     m_ullElementNum++;
     //总面积加上新面的面积
-    m_rFaceArea_Sum += TempPtr->GetArea();
+    AccumulateFaceArea(TempPtr->GetArea());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何修改
+    OnFaceAdded();
     return true;
 }
 
@@ -214,7 +329,7 @@ Model3D Model3D::operator+(const std::vector<Face3D>& vFaces) const{
                    const Face3D& NewFace：新的Face3D对象
 【返回值】          如果替换成功，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
 *************************************************************************/
 bool Model3D::ChangeFace(const Face3D& OldFace, const Face3D& NewFace){
     //查找旧的Face3D对象
@@ -227,10 +342,12 @@ bool Model3D::ChangeFace(const Face3D& OldFace, const Face3D& NewFace){
     //更新旧的Face3D为新的Face3D
     *(*ItOld) = NewFace;
     //更新统计数据
-    m_rFaceArea_Sum -= OldFace.GetArea();
-    m_rFaceArea_Sum += NewFace.GetArea();
+    AccumulateFaceArea(-OldFace.GetArea());
+    AccumulateFaceArea(NewFace.GetArea());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何修改
+    OnFaceChanged(static_cast<size_t>(ItOld - m_Faces.begin()));
     return true;
 }
 
@@ -273,13 +390,53 @@ bool Model3D::ChangeFace(
     return ChangeFace(Face1, Face1.Points[Index], NewPoint);
 }
 
+/*************************************************************************
+【函数名称】        ChangeFacePoint
+【函数功能】        按标签修改Face3D中指定索引处的点，O(1)：
+                   面积和增量更新，包围长方体仅在必要时重算，BVH增量重拟合；
+                   以新对象替换原指针，不影响共享该面的模型副本
+【参数】            size_t FaceTag：Face3D标签
+                   size_t PointTag：点的索引
+                   const Point3D& NewPoint：新的点
+【返回值】          修改成功返回true；标签越界或新点与面内其他点重复返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
+*************************************************************************/
+bool Model3D::ChangeFacePoint(
+    size_t FaceTag, size_t PointTag, const Point3D& NewPoint){
+    if (FaceTag >= m_Faces.size() || PointTag >= m_Faces[FaceTag]->PointNum) {
+        return false;
+    }
+    const Face3D& OldFace = *m_Faces[FaceTag];
+    //新点不能与面内已有点重复
+    if (OldFace.Points.IsExist(NewPoint)) {
+        return false;
+    }
+    //修改前记录是否位于包围长方体表面
+    bool IsBound = IsOnEncaseCuboid(OldFace);
+    //创建修改后的Face3D对象
+    std::shared_ptr<Face3D> TempPtr{new Face3D{OldFace}};
+    TempPtr->ChangePoint(OldFace.Points[PointTag], NewPoint);
+    //总面积增量更新
+    AccumulateFaceArea(-OldFace.GetArea());
+    AccumulateFaceArea(TempPtr->GetArea());
+    m_Faces[FaceTag] = TempPtr;
+    //旧面触及表面或新点超出包围长方体时才需重新计算
+    if (IsBound || !IsInEncaseCuboid(NewPoint)) {
+        CalcEncaseCuboid();
+    }
+    //通知几何修改
+    OnFaceChanged(FaceTag);
+    return true;
+}
+
 /*************************************************************************
 【函数名称】        DeleteFace
 【函数功能】        删除模型中的指定Face3D对象
 【参数】            const Face3D& Face1：要删除的Face3D对象
 【返回值】          如果删除成功，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
 *************************************************************************/
 bool Model3D::DeleteFace(const Face3D& Face1){
     //查找要删除的Face3D对象
@@ -296,9 +453,11 @@ bool Model3D::DeleteFace(const Face3D& Face1){
     //元素数减1
     m_ullElementNum--;
     //总面积减去删除面的面积
-    m_rFaceArea_Sum -= Face1.GetArea();
+    AccumulateFaceArea(-Face1.GetArea());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //删除后标签整体前移，通知几何整体变化
+    OnFacesReset();
     return true;
 }
 
@@ -316,6 +475,95 @@ bool Model3D::DeleteFace(
     return DeleteFace(Face3D(Point1, Point2, Point3));
 }
 
+/*************************************************************************
+【函数名称】        DeleteFaceByTag
+【函数功能】        按标签删除模型中的Face3D对象，采用“交换-弹出”：
+                   用最后一个Face3D接替被删标签，避免整体移动尾部元素
+【参数】            size_t FaceTag：要删除的Face3D标签
+【返回值】          如果删除成功，返回true；标签越界返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
+*************************************************************************/
+bool Model3D::DeleteFaceByTag(size_t FaceTag){
+    if (FaceTag >= m_Faces.size()) {
+        return false;
+    }
+    //删除前记录面积与是否位于包围长方体表面
+    double TempArea = m_Faces[FaceTag]->GetArea();
+    bool IsBound = IsOnEncaseCuboid(*m_Faces[FaceTag]);
+    //最后一个Face3D接替被删标签，再弹出尾部
+    if (FaceTag != m_Faces.size() - 1) {
+        m_Faces[FaceTag] = std::move(m_Faces.back());
+    }
+    m_Faces.pop_back();
+    //面数减1
+    m_ullFaceNum--;
+    //点数减3
+    m_ullPointNum -= 3;
+    //元素数减1
+    m_ullElementNum--;
+    //总面积减去删除面的面积
+    AccumulateFaceArea(-TempArea);
+    //仅当被删面触及包围长方体表面时才需重新计算
+    if (IsBound) {
+        CalcEncaseCuboid();
+    }
+    //通知几何修改
+    OnFaceRemoved(FaceTag);
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        DeleteFacesByTags
+【函数功能】        按标签批量删除Face3D对象：先对所有标签打墓碑标记，
+                   再一次性压缩列表，幸存的Face3D保持原相对顺序
+【参数】            const std::vector<size_t>& FaceTags：要删除的标签集合，
+                   越界或重复的标签被忽略
+【返回值】          实际删除的Face3D个数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
+*************************************************************************/
+size_t Model3D::DeleteFacesByTags(const std::vector<size_t>& FaceTags){
+    //墓碑标记，true表示待删除
+    std::vector<bool> Tombstones(m_Faces.size(), false);
+    //实际删除数
+    size_t DeleteCount = 0;
+    //是否有被删面触及包围长方体表面
+    bool IsBound = false;
+    for (auto Tag : FaceTags) {
+        if (Tag >= m_Faces.size() || Tombstones[Tag]) {
+            continue;
+        }
+        Tombstones[Tag] = true;
+        DeleteCount++;
+        AccumulateFaceArea(-m_Faces[Tag]->GetArea());
+        IsBound = IsBound || IsOnEncaseCuboid(*m_Faces[Tag]);
+    }
+    if (DeleteCount == 0) {
+        return 0;
+    }
+    //一次压缩：幸存面依次前移
+    size_t NewSize = 0;
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (!Tombstones[i]) {
+            m_Faces[NewSize] = std::move(m_Faces[i]);
+            NewSize++;
+        }
+    }
+    m_Faces.resize(NewSize);
+    //更新统计数据
+    m_ullFaceNum -= DeleteCount;
+    m_ullPointNum -= 3 * DeleteCount;
+    m_ullElementNum -= DeleteCount;
+    //仅当有被删面触及包围长方体表面时才需重新计算
+    if (IsBound) {
+        CalcEncaseCuboid();
+    }
+    //标签整体前移，通知几何整体变化
+    OnFacesReset();
+    return DeleteCount;
+}
+
 /*************************************************************************
 【函数名称】        operator-=
 【函数功能】        从模型中删除多个指定的Face3D对象
@@ -355,12 +603,13 @@ Model3D Model3D::operator-(const std::vector<Face3D>& vFaces) const{
 【参数】            无
 【返回值】          无
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 面积总和改为补偿累加
 *************************************************************************/
 void Model3D::ClearFaces(){
     //清空所有Face3D对象
     m_Faces.clear();
     //面积和清零
+    m_FaceAreaAccumulator = CompensatedSum();
     m_rFaceArea_Sum = 0.0;
     //元素数减去面数
     m_ullElementNum -= m_ullFaceNum;
@@ -370,6 +619,8 @@ void Model3D::ClearFaces(){
     m_ullFaceNum = 0;
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何整体变化
+    OnFacesReset();
 }
 
 //Line3D增删改操作
@@ -380,7 +631,7 @@ void Model3D::ClearFaces(){
 【参数】            const Line3D& Line1：要添加的Line3D对象
 【返回值】          如果成功添加，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
 *************************************************************************/
 bool Model3D::AddLine(const Line3D& Line1){
     //查找是否已经存在相同的Line3D
@@ -398,9 +649,11 @@ bool Model3D::AddLine(const Line3D& Line1){
     //元素数加1
     m_ullElementNum++;
     //总线长加上新线的长度
-    m_rLineLength_Sum += TempPtr->GetLength();
+    AccumulateLineLength(TempPtr->GetLength());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何修改
+    OnLineAdded();
     return true;
 }
 
@@ -459,7 +712,7 @@ Model3D Model3D::operator+(const std::vector<Line3D>& vLines) const{
                    const Line3D& NewLine：新的Line3D对象
 【返回值】          如果替换成功，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
 *************************************************************************/
 bool Model3D::ChangeLine(const Line3D& OldLine, const Line3D& NewLine){
     //查找旧的Line3D对象
@@ -472,10 +725,12 @@ bool Model3D::ChangeLine(const Line3D& OldLine, const Line3D& NewLine){
     //更新旧的Line3D为新的Line3D
     *(*ItOld) = NewLine;
     //更新统计数据
-    m_rLineLength_Sum -= OldLine.GetLength();
-    m_rLineLength_Sum += NewLine.GetLength();
+    AccumulateLineLength(-OldLine.GetLength());
+    AccumulateLineLength(NewLine.GetLength());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何修改
+    OnLineChanged(static_cast<size_t>(ItOld - m_Lines.begin()));
     return true;
 }
 
@@ -519,13 +774,53 @@ bool Model3D::ChangeLine(
     return ChangeLine(Line1, Line1.Points[Index], NewPoint);
 }
 
+/*************************************************************************
+【函数名称】        ChangeLinePoint
+【函数功能】        按标签修改Line3D中指定索引处的点，O(1)：
+                   总线长增量更新，包围长方体仅在必要时重算；
+                   以新对象替换原指针，不影响共享该线的模型副本
+【参数】            size_t LineTag：Line3D标签
+                   size_t PointTag：点的索引
+                   const Point3D& NewPoint：新的点
+【返回值】          修改成功返回true；标签越界或新点与线内其他点重复返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
+*************************************************************************/
+bool Model3D::ChangeLinePoint(
+    size_t LineTag, size_t PointTag, const Point3D& NewPoint){
+    if (LineTag >= m_Lines.size() || PointTag >= m_Lines[LineTag]->PointNum) {
+        return false;
+    }
+    const Line3D& OldLine = *m_Lines[LineTag];
+    //新点不能与线内已有点重复
+    if (OldLine.Points.IsExist(NewPoint)) {
+        return false;
+    }
+    //修改前记录是否位于包围长方体表面
+    bool IsBound = IsOnEncaseCuboid(OldLine);
+    //创建修改后的Line3D对象
+    std::shared_ptr<Line3D> TempPtr{new Line3D{OldLine}};
+    TempPtr->ChangePoint(OldLine.Points[PointTag], NewPoint);
+    //总线长增量更新
+    AccumulateLineLength(-OldLine.GetLength());
+    AccumulateLineLength(TempPtr->GetLength());
+    m_Lines[LineTag] = TempPtr;
+    //旧线触及表面或新点超出包围长方体时才需重新计算
+    if (IsBound || !IsInEncaseCuboid(NewPoint)) {
+        CalcEncaseCuboid();
+    }
+    //通知几何修改
+    OnLineChanged(LineTag);
+    return true;
+}
+
 /*************************************************************************
 【函数名称】        DeleteLine
 【函数功能】        删除模型中的指定Line3D对象
 【参数】            const Line3D& Line1：要删除的Line3D对象
 【返回值】          如果删除成功，返回true；否则返回false
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
 *************************************************************************/
 bool Model3D::DeleteLine(const Line3D& Line1){
     //查找要删除的Line3D对象
@@ -542,9 +837,11 @@ bool Model3D::DeleteLine(const Line3D& Line1){
     //元素数减1
     m_ullElementNum--;
     //总线长减去删除线的长度
-    m_rLineLength_Sum -= Line1.GetLength();
+    AccumulateLineLength(-Line1.GetLength());
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //删除后标签整体前移，通知几何整体变化
+    OnLinesReset();
     return true;
 }
 
@@ -561,6 +858,95 @@ bool Model3D::DeleteLine(const Point3D& Point1, const Point3D& Point2){
     return DeleteLine(Line3D(Point1, Point2));
 }
 
+/*************************************************************************
+【函数名称】        DeleteLineByTag
+【函数功能】        按标签删除模型中的Line3D对象，采用“交换-弹出”：
+                   用最后一个Line3D接替被删标签，避免整体移动尾部元素
+【参数】            size_t LineTag：要删除的Line3D标签
+【返回值】          如果删除成功，返回true；标签越界返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
+*************************************************************************/
+bool Model3D::DeleteLineByTag(size_t LineTag){
+    if (LineTag >= m_Lines.size()) {
+        return false;
+    }
+    //删除前记录长度与是否位于包围长方体表面
+    double TempLength = m_Lines[LineTag]->GetLength();
+    bool IsBound = IsOnEncaseCuboid(*m_Lines[LineTag]);
+    //最后一个Line3D接替被删标签，再弹出尾部
+    if (LineTag != m_Lines.size() - 1) {
+        m_Lines[LineTag] = std::move(m_Lines.back());
+    }
+    m_Lines.pop_back();
+    //线数减1
+    m_ullLineNum--;
+    //点数减2
+    m_ullPointNum -= 2;
+    //元素数减1
+    m_ullElementNum--;
+    //总线长减去删除线的长度
+    AccumulateLineLength(-TempLength);
+    //仅当被删线触及包围长方体表面时才需重新计算
+    if (IsBound) {
+        CalcEncaseCuboid();
+    }
+    //通知几何修改
+    OnLineRemoved(LineTag);
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        DeleteLinesByTags
+【函数功能】        按标签批量删除Line3D对象：先对所有标签打墓碑标记，
+                   再一次性压缩列表，幸存的Line3D保持原相对顺序
+【参数】            const std::vector<size_t>& LineTags：要删除的标签集合，
+                   越界或重复的标签被忽略
+【返回值】          实际删除的Line3D个数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
+*************************************************************************/
+size_t Model3D::DeleteLinesByTags(const std::vector<size_t>& LineTags){
+    //墓碑标记，true表示待删除
+    std::vector<bool> Tombstones(m_Lines.size(), false);
+    //实际删除数
+    size_t DeleteCount = 0;
+    //是否有被删线触及包围长方体表面
+    bool IsBound = false;
+    for (auto Tag : LineTags) {
+        if (Tag >= m_Lines.size() || Tombstones[Tag]) {
+            continue;
+        }
+        Tombstones[Tag] = true;
+        DeleteCount++;
+        AccumulateLineLength(-m_Lines[Tag]->GetLength());
+        IsBound = IsBound || IsOnEncaseCuboid(*m_Lines[Tag]);
+    }
+    if (DeleteCount == 0) {
+        return 0;
+    }
+    //一次压缩：幸存线依次前移
+    size_t NewSize = 0;
+    for (size_t i = 0; i < m_Lines.size(); i++) {
+        if (!Tombstones[i]) {
+            m_Lines[NewSize] = std::move(m_Lines[i]);
+            NewSize++;
+        }
+    }
+    m_Lines.resize(NewSize);
+    //更新统计数据
+    m_ullLineNum -= DeleteCount;
+    m_ullPointNum -= 2 * DeleteCount;
+    m_ullElementNum -= DeleteCount;
+    //仅当有被删线触及包围长方体表面时才需重新计算
+    if (IsBound) {
+        CalcEncaseCuboid();
+    }
+    //标签整体前移，通知几何整体变化
+    OnLinesReset();
+    return DeleteCount;
+}
+
 /*************************************************************************
 【函数名称】        operator-=
 【函数功能】        从模型中删除多个指定的Line3D对象
@@ -600,12 +986,13 @@ Model3D Model3D::operator-(const std::vector<Line3D>& vLines) const{
 【参数】            无
 【返回值】          无
 【开发者及日期】    梁思奇 2024/8/5
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 长度总和改为补偿累加
 *************************************************************************/
 void Model3D::ClearLines(){
     //清空所有Line3D对象
     m_Lines.clear();
     //线长和清零
+    m_LineLengthAccumulator = CompensatedSum();
     m_rLineLength_Sum = 0.0;
     //元素数减去线数
     m_ullElementNum -= m_ullLineNum;
@@ -615,6 +1002,148 @@ void Model3D::ClearLines(){
     m_ullLineNum = 0;
     //重新计算最小包围长方体
     CalcEncaseCuboid();
+    //通知几何整体变化
+    OnLinesReset();
+}
+
+/*************************************************************************
+【函数名称】        MoveVertex
+【函数功能】        按坐标移动一个顶点：由顶点关联索引找到含该点的全部
+                   Face3D、Line3D，逐个以新对象替换原指针并通知修改，
+                   O(顶点度数)；面积、长度总和先减旧值再加新值；
+                   新点超出包围长方体时直接扩展，只有该点原在包围
+                   长方体某个面上且沿该轴向内移动（包围长方体可能收缩）
+                   时才重新计算；新点已是顶点时，修改后的元素只可能与
+                   新点的相邻元素重复，逐个比较，O(两顶点度数之积)
+【参数】            const Point3D& OldPoint：顶点原坐标
+                   const Point3D& NewPoint：顶点新坐标
+                   bool& IsRepeatElement：返回false时，原因是否为修改后
+                   的元素与已有元素重复
+【返回值】          移动成功（或新旧坐标相同）返回true；原坐标不是顶点，
+                   新点与某个相邻元素的其他点重复，或修改后的元素与已有
+                   元素重复时返回false，模型不变
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 拒绝移动后与已有元素重复
+*************************************************************************/
+bool Model3D::MoveVertex(const Point3D& OldPoint, const Point3D& NewPoint,
+    bool& IsRepeatElement){
+    IsRepeatElement = false;
+    size_t Vertex;
+    if (!GetVertexIncidence().FindVertex(OldPoint.GetXYZ(), Vertex)) {
+        return false;
+    }
+    if (NewPoint == OldPoint) {
+        return true;
+    }
+    //相邻标签复制一份：修改过程中索引随通知更新
+    std::vector<size_t> FaceTags = m_pVertexIncidence->VertexFaces(Vertex);
+    std::vector<size_t> LineTags = m_pVertexIncidence->VertexLines(Vertex);
+    //先全部检查，避免只修改了一部分
+    for (auto Tag : FaceTags) {
+        if (m_Faces[Tag]->Points.IsExist(NewPoint)) {
+            return false;
+        }
+    }
+    for (auto Tag : LineTags) {
+        if (m_Lines[Tag]->Points.IsExist(NewPoint)) {
+            return false;
+        }
+    }
+    //创建修改后的Face3D、Line3D对象
+    std::vector<std::shared_ptr<Face3D>> NewFaces;
+    NewFaces.reserve(FaceTags.size());
+    for (auto Tag : FaceTags) {
+        NewFaces.emplace_back(new Face3D{*m_Faces[Tag]});
+        NewFaces.back()->ChangePoint(OldPoint, NewPoint);
+    }
+    std::vector<std::shared_ptr<Line3D>> NewLines;
+    NewLines.reserve(LineTags.size());
+    for (auto Tag : LineTags) {
+        NewLines.emplace_back(new Line3D{*m_Lines[Tag]});
+        NewLines.back()->ChangePoint(OldPoint, NewPoint);
+    }
+    //修改后的元素含新点，只可能与新点的相邻元素重复（这些元素不含
+    //原点，不在修改之列）；修改后的元素之间重复则修改前已重复
+    size_t NewVertex;
+    if (m_pVertexIncidence->FindVertex(NewPoint.GetXYZ(), NewVertex)) {
+        for (const auto& TempFace : NewFaces) {
+            for (auto Tag : m_pVertexIncidence->VertexFaces(NewVertex)) {
+                if (*m_Faces[Tag] == *TempFace) {
+                    IsRepeatElement = true;
+                    return false;
+                }
+            }
+        }
+        for (const auto& TempLine : NewLines) {
+            for (auto Tag : m_pVertexIncidence->VertexLines(NewVertex)) {
+                if (*m_Lines[Tag] == *TempLine) {
+                    IsRepeatElement = true;
+                    return false;
+                }
+            }
+        }
+    }
+    //该点原在包围长方体某个面上且沿该轴向内移动时，包围长方体可能收缩
+    std::array<double, 3> OldXYZ = OldPoint.GetXYZ();
+    std::array<double, 3> NewXYZ = NewPoint.GetXYZ();
+    bool IsShrunk = false;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        IsShrunk = IsShrunk 
+            || (OldXYZ[Axis] <= m_EncaseCuboid_Min[Axis] 
+            && NewXYZ[Axis] > m_EncaseCuboid_Min[Axis])
+            || (OldXYZ[Axis] >= m_EncaseCuboid_Max[Axis] 
+            && NewXYZ[Axis] < m_EncaseCuboid_Max[Axis]);
+    }
+    for (size_t i = 0; i < FaceTags.size(); i++) {
+        size_t Tag = FaceTags[i];
+        //总面积增量更新
+        AccumulateFaceArea(-m_Faces[Tag]->GetArea());
+        AccumulateFaceArea(NewFaces[i]->GetArea());
+        m_Faces[Tag] = NewFaces[i];
+        //通知几何修改
+        OnFaceChanged(Tag);
+    }
+    for (size_t i = 0; i < LineTags.size(); i++) {
+        size_t Tag = LineTags[i];
+        //总长度增量更新
+        AccumulateLineLength(-m_Lines[Tag]->GetLength());
+        AccumulateLineLength(NewLines[i]->GetLength());
+        m_Lines[Tag] = NewLines[i];
+        //通知几何修改
+        OnLineChanged(Tag);
+    }
+    if (IsShrunk) {
+        CalcEncaseCuboid();
+    }
+    else if (!IsInEncaseCuboid(NewPoint)) {
+        //只可能扩展：并入新点
+        std::array<double, 3> Min = m_EncaseCuboid_Min;
+        std::array<double, 3> Max = m_EncaseCuboid_Max;
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Min[Axis] = std::min(Min[Axis], NewXYZ[Axis]);
+            Max[Axis] = std::max(Max[Axis], NewXYZ[Axis]);
+        }
+        SetEncaseCuboid(Min, Max);
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        VertexValence
+【函数功能】        由顶点关联索引获取含指定点的Face3D与Line3D总数
+【参数】            const Point3D& Point1：顶点坐标
+【返回值】          size_t，顶点度数，不是顶点时为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+size_t Model3D::VertexValence(const Point3D& Point1) const{
+    const VertexIncidence3D& Index = GetVertexIncidence();
+    size_t Vertex;
+    if (!Index.FindVertex(Point1.GetXYZ(), Vertex)) {
+        return 0;
+    }
+    return Index.VertexFaces(Vertex).size() 
+        + Index.VertexLines(Vertex).size();
 }
 
 //Point3D增删改,在本类不可操作（虚函数，更高级的Model3D派生类可重写）
@@ -762,111 +1291,1393 @@ Model3D Model3D::operator-(const Model3D& Model1) const{
 }
 
 /*************************************************************************
-【函数名称】        FaceSearcher
-【函数功能】        查找指定Face3D对象的迭代器
-【参数】            const Face3D& Face1：要查找的Face3D对象
-【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
-【开发者及日期】    梁思奇 2024/8/5
+【函数名称】        WeldVertices
+【函数功能】        容差顶点焊接：由网格索引的去重顶点做空间哈希焊接，
+                   各面、线的顶点下标并行重映射到代表顶点；
+                   顶点重合的面、线（塌缩）删除，焊接后与更小标签元素
+                   相同的面、线（重复）删除，幸存元素保持原相对顺序；
+                   顶点未变的元素沿用原对象，其余并行重建
+【参数】            double Tolerance：焊接容差，不大于0时不做处理
+                   size_t& RemovedFaceNum：删除的Face3D数（重写）
+                   size_t& RemovedLineNum：删除的Line3D数（重写）
+【返回值】          size_t，被焊接的顶点数（不重复计算）
+【开发者及日期】    梁思奇 2026/10/18
 【更改记录】         
 *************************************************************************/
-std::vector<std::shared_ptr<Face3D>>::iterator Model3D::FaceSearcher(
-    const Face3D& Face1){
-    //使用Lambda表达式进行查找
-    auto Finder =
-        [&Face1](std::shared_ptr<Face3D> Ptr)->bool{return *Ptr == Face1;};
-    //使用find_if函数进行查找，返回查找结果
-    auto Result = find_if(m_Faces.begin(), m_Faces.end(), Finder);
-    return Result;
+size_t Model3D::WeldVertices(double Tolerance, 
+    size_t& RemovedFaceNum, size_t& RemovedLineNum){
+    RemovedFaceNum = 0;
+    RemovedLineNum = 0;
+    const MeshIndex3D& Mesh = GetMeshIndex();
+    std::vector<size_t> Representatives;
+    size_t WeldCount = Mesh.Weld(Tolerance, Representatives);
+    if (WeldCount == 0) {
+        return 0;
+    }
+    //并行重映射，Keys为排序后的顶点下标（用于查重），塌缩的元素不保留
+    using FaceKey = std::array<size_t, 3>;
+    using LineKey = std::array<size_t, 2>;
+    std::vector<FaceKey> FaceVertices(m_Faces.size());
+    std::vector<std::pair<FaceKey, size_t>> FaceKeys(m_Faces.size());
+    std::vector<uint8_t> IsFaceKept(m_Faces.size(), 1);
+    Parallel::For(0, m_Faces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 3; k++) {
+                FaceVertices[i][k] = Representatives[Mesh.FaceVertices[i][k]];
+            }
+            FaceKey Key = FaceVertices[i];
+            std::sort(Key.begin(), Key.end());
+            FaceKeys[i] = std::make_pair(Key, i);
+            if (Key[0] == Key[1] || Key[1] == Key[2]) {
+                IsFaceKept[i] = 0;
+            }
+        }
+    });
+    std::vector<LineKey> LineVertices(m_Lines.size());
+    std::vector<std::pair<LineKey, size_t>> LineKeys(m_Lines.size());
+    std::vector<uint8_t> IsLineKept(m_Lines.size(), 1);
+    Parallel::For(0, m_Lines.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 2; k++) {
+                LineVertices[i][k] = Representatives[Mesh.LineVertices[i][k]];
+            }
+            LineKey Key = LineVertices[i];
+            std::sort(Key.begin(), Key.end());
+            LineKeys[i] = std::make_pair(Key, i);
+            if (Key[0] == Key[1]) {
+                IsLineKept[i] = 0;
+            }
+        }
+    });
+    //排序查重：相同顶点组只保留最小标签
+    Parallel::Sort(FaceKeys.begin(), FaceKeys.end(),
+        [](const std::pair<FaceKey, size_t>& Lhs,
+            const std::pair<FaceKey, size_t>& Rhs){return Lhs < Rhs;});
+    for (size_t i = 1; i < FaceKeys.size(); i++) {
+        if (FaceKeys[i].first == FaceKeys[i - 1].first) {
+            IsFaceKept[FaceKeys[i].second] = 0;
+        }
+    }
+    Parallel::Sort(LineKeys.begin(), LineKeys.end(),
+        [](const std::pair<LineKey, size_t>& Lhs,
+            const std::pair<LineKey, size_t>& Rhs){return Lhs < Rhs;});
+    for (size_t i = 1; i < LineKeys.size(); i++) {
+        if (LineKeys[i].first == LineKeys[i - 1].first) {
+            IsLineKept[LineKeys[i].second] = 0;
+        }
+    }
+    //压缩：幸存元素依次前移，记录原标签
+    std::vector<size_t> FaceSources;
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (IsFaceKept[i]) {
+            FaceSources.push_back(i);
+        }
+    }
+    std::vector<size_t> LineSources;
+    for (size_t i = 0; i < m_Lines.size(); i++) {
+        if (IsLineKept[i]) {
+            LineSources.push_back(i);
+        }
+    }
+    RemovedFaceNum = m_Faces.size() - FaceSources.size();
+    RemovedLineNum = m_Lines.size() - LineSources.size();
+    //并行重建顶点有变化的元素
+    auto ToPoint = [&Mesh](size_t Vertex){
+        const Coord3D& TempVertex = Mesh.Vertices[Vertex];
+        return Point3D(TempVertex[0], TempVertex[1], TempVertex[2]);
+    };
+    std::vector<std::shared_ptr<Face3D>> NewFaces(FaceSources.size());
+    Parallel::For(0, FaceSources.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t Source = FaceSources[i];
+            if (FaceVertices[Source] == Mesh.FaceVertices[Source]) {
+                NewFaces[i] = m_Faces[Source];
+            }
+            else {
+                NewFaces[i] = std::make_shared<Face3D>(
+                    ToPoint(FaceVertices[Source][0]),
+                    ToPoint(FaceVertices[Source][1]),
+                    ToPoint(FaceVertices[Source][2]));
+            }
+        }
+    });
+    std::vector<std::shared_ptr<Line3D>> NewLines(LineSources.size());
+    Parallel::For(0, LineSources.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t Source = LineSources[i];
+            if (LineVertices[Source] == Mesh.LineVertices[Source]) {
+                NewLines[i] = m_Lines[Source];
+            }
+            else {
+                NewLines[i] = std::make_shared<Line3D>(
+                    ToPoint(LineVertices[Source][0]),
+                    ToPoint(LineVertices[Source][1]));
+            }
+        }
+    });
+    ResetElements(std::move(NewFaces), std::move(NewLines));
+    return WeldCount;
 }
 
 /*************************************************************************
-【函数名称】        LineSearcher
-【函数功能】        查找指定Line3D对象的迭代器
-【参数】            const Line3D& Line1：要查找的Line3D对象
-【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
-【开发者及日期】    梁思奇 2024/8/5
+【函数名称】        LabelComponents
+【函数功能】        按共享顶点标记Face3D、Line3D的连通分量
+                   （网格索引上的并发并查集，近似线性）
+【参数】            std::vector<size_t>& FaceLabels：各面分量编号（重写）
+                   std::vector<size_t>& LineLabels：各线分量编号（重写）
+【返回值】          size_t，连通分量数，编号按元素首次出现顺序（先面后线）
+【开发者及日期】    梁思奇 2026/10/18
 【更改记录】         
 *************************************************************************/
-std::vector<std::shared_ptr<Line3D>>::iterator Model3D::LineSearcher(
-    const Line3D& Line1){
-    //使用Lambda表达式进行查找
-    auto Finder =
-        [&Line1](std::shared_ptr<Line3D>& Ptr)->bool{return *Ptr == Line1;};
-    //使用find_if函数进行查找，返回查找结果
-    auto Result = find_if(m_Lines.begin(), m_Lines.end(), Finder);
-    return Result;
+size_t Model3D::LabelComponents(std::vector<size_t>& FaceLabels,
+    std::vector<size_t>& LineLabels) const{
+    return GetMeshIndex().LabelComponents(FaceLabels, LineLabels);
 }
 
 /*************************************************************************
-【函数名称】        PointSearcher
-【函数功能】        查找指定Point3D对象的迭代器
-【参数】            const Point3D& Point1：要查找的Point3D对象
-【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
-【开发者及日期】    梁思奇 2024/8/5
+【函数名称】        SplitComponents
+【函数功能】        按连通分量拆分为新模型，各分量元素保持原相对顺序，
+                   元素对象并行新建，不与原模型共享
+【参数】            无
+【返回值】          std::vector<std::shared_ptr<Model3D>>，各分量模型，
+                   下标即分量编号
+【开发者及日期】    梁思奇 2026/10/18
 【更改记录】         
 *************************************************************************/
-std::vector<std::shared_ptr<Point3D>>::iterator Model3D::PointSearcher(
-    const Point3D& Point1){
-    //使用Lambda表达式进行查找
-    auto Finder =
-        [&Point1](std::shared_ptr<Point3D> Ptr)->bool{return *Ptr == Point1;};
-    //使用find_if函数进行查找，返回查找结果
-    auto Result = find_if(m_Points.begin(), m_Points.end(), Finder);
-    return Result;
+std::vector<std::shared_ptr<Model3D>> Model3D::SplitComponents() const{
+    std::vector<size_t> FaceLabels;
+    std::vector<size_t> LineLabels;
+    size_t ComponentCount = LabelComponents(FaceLabels, LineLabels);
+    //并行新建全部元素对象
+    std::vector<std::shared_ptr<Face3D>> AllFaces(m_Faces.size());
+    Parallel::For(0, m_Faces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            AllFaces[i] = std::make_shared<Face3D>(*m_Faces[i]);
+        }
+    });
+    std::vector<std::shared_ptr<Line3D>> AllLines(m_Lines.size());
+    Parallel::For(0, m_Lines.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            AllLines[i] = std::make_shared<Line3D>(*m_Lines[i]);
+        }
+    });
+    //按分量分发，各分量内保持原相对顺序
+    std::vector<std::vector<std::shared_ptr<Face3D>>> 
+        ComponentFaces(ComponentCount);
+    std::vector<std::vector<std::shared_ptr<Line3D>>> 
+        ComponentLines(ComponentCount);
+    for (size_t i = 0; i < AllFaces.size(); i++) {
+        ComponentFaces[FaceLabels[i]].push_back(std::move(AllFaces[i]));
+    }
+    for (size_t i = 0; i < AllLines.size(); i++) {
+        ComponentLines[LineLabels[i]].push_back(std::move(AllLines[i]));
+    }
+    std::vector<std::shared_ptr<Model3D>> Components(ComponentCount);
+    for (size_t c = 0; c < ComponentCount; c++) {
+        Components[c] = std::make_shared<Model3D>();
+        Components[c]->m_sName = m_sName + "_" + std::to_string(c);
+        Components[c]->ResetElements(
+            std::move(ComponentFaces[c]), std::move(ComponentLines[c]));
+    }
+    return Components;
 }
 
 /*************************************************************************
-【函数名称】        CalcEncaseCuboid
-【函数功能】        计算并更新模型的最小包围长方体的尺寸和体积
-【参数】            无
-【返回值】          无
-【开发者及日期】    梁思奇 2024/8/5
+【函数名称】        RemoveSmallComponents
+【函数功能】        删除面数少于MinFaceNum或面积小于MinArea的连通分量
+                   （只含线的分量面数为0），幸存元素保持原相对顺序
+【参数】            size_t MinFaceNum：分量最少面数，0表示不限
+                   double MinArea：分量最小面积，不大于0表示不限
+                   size_t& RemovedFaceNum：删除的面数
+                   size_t& RemovedLineNum：删除的线数
+【返回值】          size_t，删除的连通分量数
+【开发者及日期】    梁思奇 2026/10/18
 【更改记录】         
 *************************************************************************/
-void Model3D::CalcEncaseCuboid(){
-    //如果没有Element(Face3D和Line3D对象)，最小包围长方体尺寸为0
-    if (ElementNum == 0) {
-        m_rEncaseCuboid_Length = 0.0;
-        m_rEncaseCuboid_Width = 0.0;
-        m_rEncaseCuboid_Height = 0.0;
-        m_rEncaseCuboid_Volume = 0.0;
-        return;
+size_t Model3D::RemoveSmallComponents(size_t MinFaceNum, double MinArea,
+    size_t& RemovedFaceNum, size_t& RemovedLineNum){
+    RemovedFaceNum = 0;
+    RemovedLineNum = 0;
+    std::vector<size_t> FaceLabels;
+    std::vector<size_t> LineLabels;
+    size_t ComponentCount = LabelComponents(FaceLabels, LineLabels);
+    //统计各分量面数与面积
+    std::vector<size_t> FaceCounts(ComponentCount, 0);
+    std::vector<double> Areas(ComponentCount, 0.0);
+    for (size_t i = 0; i < FaceLabels.size(); i++) {
+        FaceCounts[FaceLabels[i]]++;
+        Areas[FaceLabels[i]] += m_Faces[i]->GetArea();
     }
-    std::vector<Point3D> AllPoints;
-    //将所有Face3D对象的点添加到AllPoints
-    for (auto & TempFace : Faces) {
-        for (size_t i = 0; i < 3; i++) {
-            AllPoints.push_back(TempFace->Points[i]);
+    std::vector<uint8_t> IsComponentKept(ComponentCount, 1);
+    size_t RemovedCount = 0;
+    for (size_t c = 0; c < ComponentCount; c++) {
+        if (FaceCounts[c] < MinFaceNum || Areas[c] < MinArea) {
+            IsComponentKept[c] = 0;
+            RemovedCount++;
         }
     }
-    //将所有Line3D对象的点添加到AllPoints
-    for (auto & TempLine : Lines) {
-        for (size_t i = 0; i < 2; i++) {
-            AllPoints.push_back(TempLine->Points[i]);
+    if (RemovedCount == 0) {
+        return 0;
+    }
+    //压缩：幸存元素依次前移（沿用原对象）
+    std::vector<std::shared_ptr<Face3D>> NewFaces;
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (IsComponentKept[FaceLabels[i]]) {
+            NewFaces.push_back(m_Faces[i]);
         }
     }
+    std::vector<std::shared_ptr<Line3D>> NewLines;
+    for (size_t i = 0; i < m_Lines.size(); i++) {
+        if (IsComponentKept[LineLabels[i]]) {
+            NewLines.push_back(m_Lines[i]);
+        }
+    }
+    RemovedFaceNum = m_Faces.size() - NewFaces.size();
+    RemovedLineNum = m_Lines.size() - NewLines.size();
+    ResetElements(std::move(NewFaces), std::move(NewLines));
+    return RemovedCount;
+}
 
-    //定义简化后的迭代器类型
-    using PointIt = std::vector<Point3D>::iterator;
-    //注：以下3个计算式很长，均拆分为从第2行开始缩进4格的常规形式
-    //使用标准算法库找到所有点中X的最大最小值
-    std::pair<PointIt, PointIt> MinMax_X = std::minmax_element(
-        AllPoints.begin(),
-        AllPoints.end(),
-        [](const Point3D& Pointlhs, const Point3D& Pointrhs){
-        return Pointlhs.GetX() < Pointrhs.GetX();});
-    //找到X轴最大最小值的迭代器
-    auto Min_X_it = MinMax_X.first;
-    auto Max_X_it = MinMax_X.second;
+/*************************************************************************
+【函数名称】        ApplyPatch
+【函数功能】        应用补丁：先校验基准面数、线数与标签（越界、重复或
+                   同时移动与删除均不符），再校验移动与新增的元素（点
+                   重合，或与未改动的、其他移动或新增的元素相同均不符，
+                   由ModelDiff3D按规范键散列检查，O(n)），最后按“移动
+                   的原位改为新对象、删除的移除（幸存元素保持原相对
+                   顺序）、新增的追加”组成新列表，整体替换后重算统计数据
+【参数】            const ModelPatch3D& Patch：补丁
+【返回值】          bool，应用成功返回true；补丁与本模型不符返回false，
+                   模型不变
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 校验移动与新增元素的点重合与元素
+                   重合，避免构造时抛出异常或产生重复元素
+*************************************************************************/
+bool Model3D::ApplyPatch(const ModelPatch3D& Patch){
+    if (Patch.BaseFaceNum != m_Faces.size() 
+        || Patch.BaseLineNum != m_Lines.size()) {
+        return false;
+    }
+    //各元素的改动：0为不变，1为移动，2为删除
+    auto Mark = [](std::vector<uint8_t>& States, size_t Tag, uint8_t State){
+        if (Tag >= States.size() || States[Tag] != 0) {
+            return false;
+        }
+        States[Tag] = State;
+        return true;
+    };
+    std::vector<uint8_t> FaceStates(m_Faces.size(), 0);
+    std::vector<uint8_t> LineStates(m_Lines.size(), 0);
+    bool IsValid = true;
+    for (const auto& Moved : Patch.MovedFaces) {
+        IsValid = IsValid && Mark(FaceStates, Moved.first, 1);
+    }
+    for (size_t Tag : Patch.RemovedFaceTags) {
+        IsValid = IsValid && Mark(FaceStates, Tag, 2);
+    }
+    for (const auto& Moved : Patch.MovedLines) {
+        IsValid = IsValid && Mark(LineStates, Moved.first, 1);
+    }
+    for (size_t Tag : Patch.RemovedLineTags) {
+        IsValid = IsValid && Mark(LineStates, Tag, 2);
+    }
+    if (!IsValid) {
+        return false;
+    }
+    //按应用后的内容校验：未改动的元素在前，移动与新增的在后
+    std::vector<Triangle3D> CheckFaces;
+    CheckFaces.reserve(m_Faces.size() + Patch.AddedFaces.size());
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (FaceStates[i] == 0) {
+            CheckFaces.push_back(GetFaceTriangle(i));
+        }
+    }
+    size_t FirstNewFace = CheckFaces.size();
+    for (const auto& Moved : Patch.MovedFaces) {
+        CheckFaces.push_back(Moved.second);
+    }
+    CheckFaces.insert(CheckFaces.end(), Patch.AddedFaces.begin(),
+        Patch.AddedFaces.end());
+    std::vector<Segment3D> CheckLines;
+    CheckLines.reserve(m_Lines.size() + Patch.AddedLines.size());
+    for (size_t i = 0; i < m_Lines.size(); i++) {
+        if (LineStates[i] == 0) {
+            CheckLines.push_back(GetLineSegment(i));
+        }
+    }
+    size_t FirstNewLine = CheckLines.size();
+    for (const auto& Moved : Patch.MovedLines) {
+        CheckLines.push_back(Moved.second);
+    }
+    CheckLines.insert(CheckLines.end(), Patch.AddedLines.begin(),
+        Patch.AddedLines.end());
+    if (ModelDiff3D::HasRepeat(CheckFaces, FirstNewFace)
+        || ModelDiff3D::HasRepeat(CheckLines, FirstNewLine)) {
+        return false;
+    }
+    auto ToPoint = [](const Coord3D& Point){
+        return Point3D(Point[0], Point[1], Point[2]);
+    };
+    //移动的面、线原位改为新对象
+    std::vector<std::shared_ptr<Face3D>> MovedFaces(m_Faces);
+    for (const auto& Moved : Patch.MovedFaces) {
+        MovedFaces[Moved.first] = std::make_shared<Face3D>(
+            ToPoint(Moved.second[0]), ToPoint(Moved.second[1]),
+            ToPoint(Moved.second[2]));
+    }
+    std::vector<std::shared_ptr<Line3D>> MovedLines(m_Lines);
+    for (const auto& Moved : Patch.MovedLines) {
+        MovedLines[Moved.first] = std::make_shared<Line3D>(
+            ToPoint(Moved.second[0]), ToPoint(Moved.second[1]));
+    }
+    //删除的面、线移除，新增的追加到末尾
+    std::vector<std::shared_ptr<Face3D>> NewFaces;
+    NewFaces.reserve(m_Faces.size() - Patch.RemovedFaceTags.size()
+        + Patch.AddedFaces.size());
+    for (size_t i = 0; i < MovedFaces.size(); i++) {
+        if (FaceStates[i] != 2) {
+            NewFaces.push_back(std::move(MovedFaces[i]));
+        }
+    }
+    for (const Triangle3D& Added : Patch.AddedFaces) {
+        NewFaces.push_back(std::make_shared<Face3D>(
+            ToPoint(Added[0]), ToPoint(Added[1]), ToPoint(Added[2])));
+    }
+    std::vector<std::shared_ptr<Line3D>> NewLines;
+    NewLines.reserve(m_Lines.size() - Patch.RemovedLineTags.size()
+        + Patch.AddedLines.size());
+    for (size_t i = 0; i < MovedLines.size(); i++) {
+        if (LineStates[i] != 2) {
+            NewLines.push_back(std::move(MovedLines[i]));
+        }
+    }
+    for (const Segment3D& Added : Patch.AddedLines) {
+        NewLines.push_back(std::make_shared<Line3D>(
+            ToPoint(Added[0]), ToPoint(Added[1])));
+    }
+    ResetElements(std::move(NewFaces), std::move(NewLines));
+    return true;
+}
 
-    //使用标准算法库找到所有点中Y的最大最小值
-    std::pair<PointIt, PointIt> MinMax_Y = std::minmax_element(
-        AllPoints.begin(),
-        AllPoints.end(),
-        [](const Point3D& Pointlhs, const Point3D& Pointrhs){
-        return Pointlhs.GetY() < Pointrhs.GetY();});
-    //找到Y轴最大最小值的迭代器
-    auto Min_Y_it = MinMax_Y.first;
+/*************************************************************************
+【函数名称】        Transform
+【函数功能】        仿射变换全部点：面、线分块收集坐标后经SIMD内核变换并
+                   新建对象（全部线程并行），包围长方体在同一遍中求得；
+                   线性部分为s倍正交阵（相似变换：平移、旋转、镜像与
+                   均匀缩放的组合）时面积总和乘s²、长度总和乘|s|，
+                   否则在同一遍中由内核重算；线性部分行列式为负（含
+                   镜像）时同遍交换各面后两个顶点，保持顶点环绕方向与
+                   外法向一致，有向体积不变号；新列表整体替换后通知
+                   几何整体变化
+【参数】            const std::array<double, 16>& Matrix：按行存放的4×4
+                   矩阵，点(x, y, z)变为前三行与(x, y, z, 1)的乘积
+【返回值】          bool，变换成功返回true；矩阵含非有限值、末行不为
+                   (0, 0, 0, 1)、线性部分不可逆或变换后有元素的点重合
+                   时返回false，模型不变
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 行列式为负时翻转面的顶点顺序
+*************************************************************************/
+bool Model3D::Transform(const std::array<double, 16>& Matrix){
+    for (double Value : Matrix) {
+        if (!std::isfinite(Value)) {
+            return false;
+        }
+    }
+    if (Matrix[12] != 0.0 || Matrix[13] != 0.0 || Matrix[14] != 0.0
+        || Matrix[15] != 1.0) {
+        return false;
+    }
+    const double* M = Matrix.data();
+    double Det = M[0] * (M[5] * M[10] - M[6] * M[9])
+        - M[1] * (M[4] * M[10] - M[6] * M[8])
+        + M[2] * (M[4] * M[9] - M[5] * M[8]);
+    if (!(std::abs(Det) > 0.0) || !std::isfinite(Det)) {
+        return false;
+    }
+    //线性部分各列的内积矩阵为s²倍单位阵时是相似变换
+    double Gram[3][3];
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            Gram[i][j] = M[i] * M[j] + M[4 + i] * M[4 + j]
+                + M[8 + i] * M[8 + j];
+        }
+    }
+    double Scale2 = (Gram[0][0] + Gram[1][1] + Gram[2][2]) / 3.0;
+    bool IsSimilar = true;
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            double Expected = i == j ? Scale2 : 0.0;
+            IsSimilar = IsSimilar && std::abs(Gram[i][j] - Expected)
+                <= SIMILARITY_TOLERANCE * Scale2;
+        }
+    }
+    //各块的累计量：面积或长度的补偿和，以及变换后点的包围盒
+    using Partial = std::pair<CompensatedSum, std::array<Coord3D, 2>>;
+    const double Inf = std::numeric_limits<double>::infinity();
+    const Partial Empty{CompensatedSum{},
+        {{{{Inf, Inf, Inf}}, {{-Inf, -Inf, -Inf}}}}};
+    auto Combine = [](Partial Lhs, const Partial& Rhs){
+        Lhs.first += Rhs.first;
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Lhs.second[0][Axis]
+                = std::min(Lhs.second[0][Axis], Rhs.second[0][Axis]);
+            Lhs.second[1][Axis]
+                = std::max(Lhs.second[1][Axis], Rhs.second[1][Axis]);
+        }
+        return Lhs;
+    };
+    std::vector<std::shared_ptr<Face3D>> NewFaces(m_Faces.size());
+    Partial FacePartial = Parallel::Reduce(0, m_Faces.size(), Empty,
+        [&](size_t First, size_t Last){
+            Partial Local = Empty;
+            Local.first = TransformFaces(First, Last, M, !IsSimilar,
+                Det < 0.0, NewFaces, Local.second);
+            return Local;
+        }, Combine);
+    std::vector<std::shared_ptr<Line3D>> NewLines(m_Lines.size());
+    Partial LinePartial = Parallel::Reduce(0, m_Lines.size(), Empty,
+        [&](size_t First, size_t Last){
+            Partial Local = Empty;
+            Local.first = TransformLines(
+                First, Last, M, !IsSimilar, NewLines, Local.second);
+            return Local;
+        }, Combine);
+    //有元素的点在舍入后重合，不能构成元素
+    if (std::find(NewFaces.begin(), NewFaces.end(), nullptr) 
+        != NewFaces.end()
+        || std::find(NewLines.begin(), NewLines.end(), nullptr)
+        != NewLines.end()) {
+        return false;
+    }
+    m_Faces = std::move(NewFaces);
+    m_Lines = std::move(NewLines);
+    //面积、长度总和：相似变换按比例更新，否则取同遍重算的值
+    if (IsSimilar) {
+        m_FaceAreaAccumulator 
+            = CompensatedSum(m_FaceAreaAccumulator.Value() * Scale2);
+        m_LineLengthAccumulator = CompensatedSum(
+            m_LineLengthAccumulator.Value() * std::sqrt(Scale2));
+    }
+    else {
+        m_FaceAreaAccumulator = FacePartial.first;
+        m_LineLengthAccumulator = LinePartial.first;
+    }
+    m_rFaceArea_Sum = m_FaceAreaAccumulator.Value();
+    m_rLineLength_Sum = m_LineLengthAccumulator.Value();
+    //包围长方体：两部分包围盒合并
+    if (m_ullElementNum > 0) {
+        Partial Total = Combine(FacePartial, LinePartial);
+        SetEncaseCuboid(Total.second[0], Total.second[1]);
+    }
+    //全部点均已改变，通知几何整体变化
+    OnFacesReset();
+    OnLinesReset();
+    return true;
+}
+
+//射线查询
+
+/*************************************************************************
+【函数名称】        RayCast
+【函数功能】        射线与模型所有Face3D求最近交点（BVH加速，双面可见）
+【参数】            const Point3D& Origin：射线起点
+                   const Vector3D<double>& Direction：射线方向（无需单位化）
+                   RayHit3D& Hit：命中结果，T为交点到起点的距离
+                   double MaxDistance：最大查询距离
+【返回值】          命中返回true；未命中或方向为零向量返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::RayCast(const Point3D& Origin, 
+    const Vector3D<double>& Direction, RayHit3D& Hit, 
+    double MaxDistance) const{
+    Hit.FaceTag = RayHit3D::NO_HIT;
+    double Length = Direction.Length();
+    if (!(Length > 0.0)) {
+        return false;
+    }
+    //方向单位化，射线参数即为距离
+    Coord3D UnitDirection{
+        Direction[0] / Length, Direction[1] / Length, Direction[2] / Length};
+    return GetFaceBVH().Intersect(
+        Origin.GetXYZ(), UnitDirection, MaxDistance, Hit);
+}
+
+/*************************************************************************
+【函数名称】        RayOccluded
+【函数功能】        判断射线在最大距离内是否被任一Face3D遮挡，
+                   找到任一交点即返回
+【参数】            const Point3D& Origin：射线起点
+                   const Vector3D<double>& Direction：射线方向（无需单位化）
+                   double MaxDistance：最大查询距离
+【返回值】          被遮挡返回true；否则或方向为零向量返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::RayOccluded(const Point3D& Origin, 
+    const Vector3D<double>& Direction, double MaxDistance) const{
+    double Length = Direction.Length();
+    if (!(Length > 0.0)) {
+        return false;
+    }
+    Coord3D UnitDirection{
+        Direction[0] / Length, Direction[1] / Length, Direction[2] / Length};
+    return GetFaceBVH().Occluded(
+        Origin.GetXYZ(), UnitDirection, MaxDistance);
+}
+
+/*************************************************************************
+【函数名称】        RayCastBatch
+【函数功能】        批量求射线与模型所有Face3D的最近交点：方向单位化后
+                   交由BVH按一致性组包，射线包在全部线程上并行遍历
+【参数】            const std::vector<Coord3D>& Origins：各射线起点
+                   const std::vector<Coord3D>& Directions：各射线方向
+                   （无需单位化）
+                   std::vector<RayHit3D>& Hits：各射线命中结果（重写），
+                   T为交点到起点的距离，未命中FaceTag为RayHit3D::NO_HIT
+                   double MaxDistance：最大查询距离
+【返回值】          起点与方向数量相等返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::RayCastBatch(const std::vector<Coord3D>& Origins,
+    const std::vector<Coord3D>& Directions, std::vector<RayHit3D>& Hits,
+    double MaxDistance) const{
+    if (Origins.size() != Directions.size()) {
+        return false;
+    }
+    GetFaceBVH().IntersectBatch(
+        Origins, NormalizeDirections(Directions), MaxDistance, Hits);
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        RayOccludedBatch
+【函数功能】        批量判断射线在最大距离内是否被Face3D遮挡，
+                   组包与并行方式同RayCastBatch
+【参数】            const std::vector<Coord3D>& Origins：各射线起点
+                   const std::vector<Coord3D>& Directions：各射线方向
+                   （无需单位化）
+                   std::vector<uint8_t>& Results：各射线是否被遮挡（重写）
+                   double MaxDistance：最大查询距离
+【返回值】          起点与方向数量相等返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::RayOccludedBatch(const std::vector<Coord3D>& Origins,
+    const std::vector<Coord3D>& Directions, std::vector<uint8_t>& Results,
+    double MaxDistance) const{
+    if (Origins.size() != Directions.size()) {
+        return false;
+    }
+    GetFaceBVH().OccludedBatch(
+        Origins, NormalizeDirections(Directions), MaxDistance, Results);
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        ContainsPoints
+【函数功能】        批量判断点是否在Face3D围成的封闭网格内：面BVH上自各点
+                   向+Z的射线穿面次数为奇数即在内部，穿面判定精确，射线
+                   恰过共享边或顶点时只计一个面；点排序后全部线程并行
+【参数】            const std::vector<double>& Coordinates：各点的X、Y、Z
+                   std::vector<uint64_t>& Mask：结果位掩码（会被重写），
+                   第i / 64个字的第i % 64位对应第i个点
+【返回值】          bool，Coordinates长度是3的倍数返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::ContainsPoints(const std::vector<double>& Coordinates,
+    std::vector<uint64_t>& Mask) const{
+    if (Coordinates.size() % 3 != 0) {
+        return false;
+    }
+    GetFaceBVH().ContainsBatch(Coordinates, Mask);
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        Intersects
+【函数功能】        与另一模型的Face3D相交查询：两模型的面BVH同时遍历，
+                   各线程分别负责不同的子树对，叶节点内精确判定三角形
+                   相交（接触也算相交）；与自身查询时相邻面也计入
+【参数】            const Model3D& Other：另一模型
+                   bool IsAnyHit：是否找到一对即停止
+                   std::vector<std::pair<size_t, size_t>>& FacePairs：
+                   相交的（本模型面标签，另一模型面标签）（会被重写）
+【返回值】          bool，存在相交的面返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::Intersects(const Model3D& Other, bool IsAnyHit,
+    std::vector<std::pair<size_t, size_t>>& FacePairs) const{
+    const BVH3D& OtherBVH = Other.GetFaceBVH();
+    GetFaceBVH().IntersectPairs(OtherBVH, IsAnyHit, FacePairs);
+    return !FacePairs.empty();
+}
+
+/*************************************************************************
+【函数名称】        SurfaceDistanceTo
+【函数功能】        到另一模型Face3D的单向表面距离：采样点为本模型各面
+                   用到的去重顶点，以及按累积面积分层的面内点（前k个面
+                   共有floor(前k个面面积和 × 密度)个，各面的点由点编号
+                   散列得到均匀分布的重心坐标，结果可重复）；各采样点在
+                   另一模型的面BVH上求最近点，全部线程并行，块内与块间
+                   补偿求和；相邻采样点的距离之差不超过两点间距，
+                   以上一点的距离加间距为初始上限，查询只访问少量节点；
+                   任一距离超过ErrorBound时置位停止标记，各线程见到后停止
+【参数】            const Model3D& Other：另一模型
+                   double SampleDensity：每单位面积的面内采样点数
+                   （不为正时只取顶点）
+                   SurfaceDistance3D& Distance：距离统计（会被重写）
+                   double ErrorBound：误差界，默认为无穷大（不提前停止）
+【返回值】          bool，两模型均有面时返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::SurfaceDistanceTo(const Model3D& Other, double SampleDensity,
+    SurfaceDistance3D& Distance, double ErrorBound) const{
+    Distance = SurfaceDistance3D{0.0, 0.0, 0.0, {{0.0, 0.0, 0.0}}, 0, false};
+    if (m_Faces.empty() || Other.m_Faces.empty()) {
+        return false;
+    }
+    const BVH3D& Target = Other.GetFaceBVH();
+    const MeshIndex3D& Mesh = GetMeshIndex();
+    //面用到的去重顶点
+    std::vector<uint8_t> IsUsed(Mesh.Vertices.size(), 0);
+    for (const std::array<size_t, 3>& Face : Mesh.FaceVertices) {
+        for (size_t Vertex : Face) {
+            IsUsed[Vertex] = 1;
+        }
+    }
+    std::vector<size_t> Vertices;
+    for (size_t i = 0; i < IsUsed.size(); i++) {
+        if (IsUsed[i] != 0) {
+            Vertices.push_back(i);
+        }
+    }
+    //各面面内采样点编号区间[SampleStarts[i], SampleStarts[i + 1])
+    std::vector<double> Areas;
+    GetFaceAreas(Areas);
+    std::vector<size_t> SampleStarts(Areas.size() + 1, 0);
+    double Density = std::max(SampleDensity, 0.0);
+    CompensatedSum Cumulative;
+    for (size_t i = 0; i < Areas.size(); i++) {
+        Cumulative += Areas[i];
+        SampleStarts[i + 1] = std::max(SampleStarts[i],
+            static_cast<size_t>(std::floor(Cumulative.Value() * Density)));
+    }
+    //块的累计量
+    class Partial{
+    public:
+        double Max{-1.0};
+        Coord3D Farthest{{0.0, 0.0, 0.0}};
+        CompensatedSum Sum{};
+        CompensatedSum SquareSum{};
+        size_t Count{0};
+    };
+    std::atomic<bool> IsStopped{false};
+    //前Vertices.size()项为顶点，其后每项为一个面的面内采样点
+    Partial Total = Parallel::Reduce(0, Vertices.size() + Areas.size(),
+        Partial{}, [&](size_t First, size_t Last){
+            Partial Local;
+            //上一采样点及其距离（初始上限的依据）
+            Coord3D Previous{{0.0, 0.0, 0.0}};
+            double PreviousDistance
+                = std::numeric_limits<double>::infinity();
+            auto Measure = [&](const Coord3D& Point){
+                double Bound = (PreviousDistance + Geometry3D::Length(
+                    Geometry3D::Sub(Point, Previous))) * (1.0 + 1e-9);
+                size_t FaceTag = 0;
+                Coord3D Closest;
+                if (!Target.ClosestPoint(Point, Bound, FaceTag, Closest)) {
+                    //舍入使上限略小时放开重查
+                    Target.ClosestPoint(Point,
+                        std::numeric_limits<double>::infinity(),
+                        FaceTag, Closest);
+                }
+                double Current
+                    = Geometry3D::Length(Geometry3D::Sub(Point, Closest));
+                Previous = Point;
+                PreviousDistance = Current;
+                Local.Sum += Current;
+                Local.SquareSum += Current * Current;
+                Local.Count++;
+                if (Current > Local.Max) {
+                    Local.Max = Current;
+                    Local.Farthest = Point;
+                }
+                if (Current > ErrorBound) {
+                    IsStopped = true;
+                }
+            };
+            for (size_t i = First; i < Last; i++) {
+                if (IsStopped.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                if (i < Vertices.size()) {
+                    Measure(Mesh.Vertices[Vertices[i]]);
+                    continue;
+                }
+                size_t FaceTag = i - Vertices.size();
+                const std::array<size_t, 3>& Face
+                    = Mesh.FaceVertices[FaceTag];
+                const Coord3D& A = Mesh.Vertices[Face[0]];
+                Coord3D AB = Geometry3D::Sub(Mesh.Vertices[Face[1]], A);
+                Coord3D AC = Geometry3D::Sub(Mesh.Vertices[Face[2]], A);
+                for (size_t k = SampleStarts[FaceTag];
+                    k < SampleStarts[FaceTag + 1]; k++) {
+                    //点编号散列（splitmix64）为两个[0, 1)均匀数，
+                    //重心坐标(1 - √r1, √r1(1 - r2), √r1·r2)在面上均匀
+                    uint64_t Hash = k + 0x9E3779B97F4A7C15ULL;
+                    Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBULL;
+                    Hash ^= Hash >> 31;
+                    double Root = std::sqrt(
+                        static_cast<double>(Hash >> 32) * 0x1.0p-32);
+                    double R2 = static_cast<double>(Hash & 0xFFFFFFFFULL)
+                        * 0x1.0p-32;
+                    Measure(Geometry3D::Add(A, Geometry3D::Add(
+                        Geometry3D::Scale(AB, Root * (1.0 - R2)),
+                        Geometry3D::Scale(AC, Root * R2))));
+                }
+            }
+            return Local;
+        },
+        [](Partial Lhs, const Partial& Rhs){
+            if (Rhs.Max > Lhs.Max) {
+                Lhs.Max = Rhs.Max;
+                Lhs.Farthest = Rhs.Farthest;
+            }
+            Lhs.Sum += Rhs.Sum;
+            Lhs.SquareSum += Rhs.SquareSum;
+            Lhs.Count += Rhs.Count;
+            return Lhs;
+        });
+    if (Total.Count > 0) {
+        Distance.Hausdorff = Total.Max;
+        Distance.FarthestPoint = Total.Farthest;
+        Distance.Mean = Total.Sum.Value() / static_cast<double>(Total.Count);
+        Distance.RMS = std::sqrt(std::max(0.0,
+            Total.SquareSum.Value() / static_cast<double>(Total.Count)));
+    }
+    Distance.SampleNum = Total.Count;
+    Distance.IsStopped = IsStopped;
+    return true;
+}
+
+//网格索引与顶点查询
+
+/*************************************************************************
+【函数名称】        GetMeshIndex
+【函数功能】        获取与当前几何一致的网格索引，不一致时重建
+【参数】            无
+【返回值】          const MeshIndex3D&，网格索引
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const MeshIndex3D& Model3D::GetMeshIndex() const{
+    if (m_pMeshIndex == nullptr 
+        || m_ullMeshIndexVersion != m_ullGeometryVersion) {
+        if (m_pMeshIndex == nullptr) {
+            m_pMeshIndex = std::make_shared<MeshIndex3D>();
+        }
+        m_pMeshIndex->Build(ExtractFaceTriangles(), ExtractLineSegments());
+        m_ullMeshIndexVersion = m_ullGeometryVersion;
+    }
+    return *m_pMeshIndex;
+}
+
+/*************************************************************************
+【函数名称】        GetVertexTree
+【函数功能】        获取与当前几何一致的顶点k-d树，不一致时由网格索引的
+                   去重顶点重建
+【参数】            无
+【返回值】          const KDTree3D&，顶点k-d树
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const KDTree3D& Model3D::GetVertexTree() const{
+    if (m_pVertexTree == nullptr 
+        || m_ullVertexTreeVersion != m_ullGeometryVersion) {
+        if (m_pVertexTree == nullptr) {
+            m_pVertexTree = std::make_shared<KDTree3D>();
+        }
+        m_pVertexTree->Build(GetMeshIndex().Vertices);
+        m_ullVertexTreeVersion = m_ullGeometryVersion;
+    }
+    return *m_pVertexTree;
+}
+
+/*************************************************************************
+【函数名称】        GetHalfEdgeMesh
+【函数功能】        获取与当前几何一致的半边拓扑结构，不一致时由网格索引
+                   重建
+【参数】            无
+【返回值】          const HalfEdgeMesh3D&，半边拓扑结构
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const HalfEdgeMesh3D& Model3D::GetHalfEdgeMesh() const{
+    if (m_pHalfEdgeMesh == nullptr 
+        || m_ullHalfEdgeMeshVersion != m_ullGeometryVersion) {
+        if (m_pHalfEdgeMesh == nullptr) {
+            m_pHalfEdgeMesh = std::make_shared<HalfEdgeMesh3D>();
+        }
+        m_pHalfEdgeMesh->Build(GetMeshIndex());
+        m_ullHalfEdgeMeshVersion = m_ullGeometryVersion;
+    }
+    return *m_pHalfEdgeMesh;
+}
+
+/*************************************************************************
+【函数名称】        Validate
+【函数功能】        网格校验：边统计取自半边结构；再并行遍历各面，
+                   以叉积判定退化，沿第一条边的相邻半边找出顶点相同
+                   且标签更小的面判定重复（重复面必共享全部三条边）
+【参数】            MeshReport3D& Report：校验报告（重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::Validate(MeshReport3D& Report) const{
+    const MeshIndex3D& Mesh = GetMeshIndex();
+    const HalfEdgeMesh3D& HalfEdges = GetHalfEdgeMesh();
+    size_t FaceCount = Mesh.FaceVertices.size();
+    std::vector<uint8_t> IsDegenerate(FaceCount, 0);
+    std::vector<uint8_t> IsDuplicate(FaceCount, 0);
+    Parallel::For(0, FaceCount, [&](size_t First, size_t Last){
+        std::vector<size_t> Candidates;
+        for (size_t i = First; i < Last; i++) {
+            const std::array<size_t, 3>& Vertices = Mesh.FaceVertices[i];
+            const Coord3D& A = Mesh.Vertices[Vertices[0]];
+            Coord3D AB = Geometry3D::Sub(Mesh.Vertices[Vertices[1]], A);
+            Coord3D AC = Geometry3D::Sub(Mesh.Vertices[Vertices[2]], A);
+            Coord3D BC = Geometry3D::Sub(AC, AB);
+            double LongestSquared = std::max({Geometry3D::Dot(AB, AB),
+                Geometry3D::Dot(AC, AC), Geometry3D::Dot(BC, BC)});
+            double DoubleArea = Geometry3D::Length(Geometry3D::Cross(AB, AC));
+            if (DoubleArea <= DEGENERATE_RATIO * LongestSquared) {
+                IsDegenerate[i] = 1;
+            }
+            std::array<size_t, 3> Key = Vertices;
+            std::sort(Key.begin(), Key.end());
+            HalfEdges.EdgeHalfEdges(HalfEdges.Edge(3 * i), Candidates);
+            for (auto Candidate : Candidates) {
+                size_t Other = HalfEdges.Face(Candidate);
+                if (Other >= i) {
+                    continue;
+                }
+                std::array<size_t, 3> OtherKey = Mesh.FaceVertices[Other];
+                std::sort(OtherKey.begin(), OtherKey.end());
+                if (OtherKey == Key) {
+                    IsDuplicate[i] = 1;
+                    break;
+                }
+            }
+        }
+    });
+    Report.DegenerateFaceTags.clear();
+    Report.DuplicateFaceTags.clear();
+    for (size_t i = 0; i < FaceCount; i++) {
+        if (IsDegenerate[i]) {
+            Report.DegenerateFaceTags.push_back(i);
+        }
+        if (IsDuplicate[i]) {
+            Report.DuplicateFaceTags.push_back(i);
+        }
+    }
+    Report.EdgeNum = HalfEdges.EdgeNum();
+    Report.BoundaryEdgeNum = HalfEdges.BoundaryEdgeNum();
+    Report.NonManifoldEdgeNum = HalfEdges.NonManifoldEdgeNum();
+    Report.InconsistentEdgeNum = HalfEdges.InconsistentEdgeNum();
+    Report.IsValid = Report.DegenerateFaceTags.empty()
+        && Report.DuplicateFaceTags.empty()
+        && Report.BoundaryEdgeNum == 0
+        && Report.NonManifoldEdgeNum == 0
+        && Report.InconsistentEdgeNum == 0;
+}
+
+/*************************************************************************
+【函数名称】        GetMassProperties
+【函数功能】        获取与当前几何一致的质量属性，不一致时重算：
+                   每个面与原点构成有向四面体，d = a·(b×c)为其6倍有向体积，
+                   体积 = Σd/6，体积质心 = Σd(a+b+c)/(4Σd)，
+                   二阶矩∫x_i x_j = Σd(a_i a_j + b_i b_j + c_i c_j
+                   + s_i s_j)/120（s = a+b+c），再平移到体积质心；
+                   各面按块并行计算，块内与块间均为补偿求和
+【参数】            无
+【返回值】          const MassProperties3D&，质量属性
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const MassProperties3D& Model3D::GetMassProperties() const{
+    if (m_pMassProperties != nullptr 
+        && m_ullMassPropertiesVersion == m_ullGeometryVersion) {
+        return *m_pMassProperties;
+    }
+    //累加项：0为Σd，1~3为Σd·s，4为Σ2倍面积，5~7为Σ2倍面积·s，
+    //8~13为二阶矩xx、yy、zz、xy、yz、zx（未除以120）
+    using Moments = std::array<CompensatedSum, 14>;
+    const MeshIndex3D& Mesh = GetMeshIndex();
+    Moments Sums = Parallel::Reduce(0, Mesh.FaceVertices.size(), Moments{},
+        [&](size_t First, size_t Last){
+            Moments Partial{};
+            for (size_t i = First; i < Last; i++) {
+                const Coord3D& A = Mesh.Vertices[Mesh.FaceVertices[i][0]];
+                const Coord3D& B = Mesh.Vertices[Mesh.FaceVertices[i][1]];
+                const Coord3D& C = Mesh.Vertices[Mesh.FaceVertices[i][2]];
+                double D = Geometry3D::Dot(A, Geometry3D::Cross(B, C));
+                Coord3D S = Geometry3D::Add(Geometry3D::Add(A, B), C);
+                double DoubleArea = Geometry3D::Length(Geometry3D::Cross(
+                    Geometry3D::Sub(B, A), Geometry3D::Sub(C, A)));
+                Partial[0] += D;
+                Partial[4] += DoubleArea;
+                for (size_t k = 0; k < 3; k++) {
+                    Partial[1 + k] += D * S[k];
+                    Partial[5 + k] += DoubleArea * S[k];
+                    //对角项与非对角项：k与(k + 1) % 3
+                    size_t j = (k + 1) % 3;
+                    Partial[8 + k] += D * (A[k] * A[k] + B[k] * B[k] 
+                        + C[k] * C[k] + S[k] * S[k]);
+                    Partial[11 + k] += D * (A[k] * A[j] + B[k] * B[j] 
+                        + C[k] * C[j] + S[k] * S[j]);
+                }
+            }
+            return Partial;
+        },
+        [](Moments Lhs, const Moments& Rhs){
+            for (size_t k = 0; k < Lhs.size(); k++) {
+                Lhs[k] += Rhs[k];
+            }
+            return Lhs;
+        });
+    if (m_pMassProperties == nullptr) {
+        m_pMassProperties = std::make_shared<MassProperties3D>();
+    }
+    MassProperties3D& Result = *m_pMassProperties;
+    double SumD = Sums[0].Value();
+    double SumDoubleArea = Sums[4].Value();
+    Result.Volume = SumD / 6.0;
+    Result.Area = SumDoubleArea / 2.0;
+    for (size_t k = 0; k < 3; k++) {
+        Result.VolumeCentroid[k] 
+            = SumD != 0.0 ? Sums[1 + k].Value() / (4.0 * SumD) : 0.0;
+        Result.SurfaceCentroid[k] = SumDoubleArea != 0.0 
+            ? Sums[5 + k].Value() / (3.0 * SumDoubleArea) : 0.0;
+    }
+    //关于原点的二阶矩，平移到体积质心
+    std::array<Coord3D, 3> Second;
+    for (size_t k = 0; k < 3; k++) {
+        size_t j = (k + 1) % 3;
+        Second[k][k] = Sums[8 + k].Value() / 120.0;
+        Second[k][j] = Sums[11 + k].Value() / 120.0;
+        Second[j][k] = Second[k][j];
+    }
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t j = 0; j < 3; j++) {
+            Second[k][j] -= Result.Volume 
+                * Result.VolumeCentroid[k] * Result.VolumeCentroid[j];
+        }
+    }
+    //惯性张量 I = tr(C)·E - C
+    double Trace = Second[0][0] + Second[1][1] + Second[2][2];
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t j = 0; j < 3; j++) {
+            Result.Inertia[k][j] = (k == j ? Trace : 0.0) - Second[k][j];
+        }
+    }
+    m_ullMassPropertiesVersion = m_ullGeometryVersion;
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        GetOrientedBox
+【函数功能】        获取与当前几何一致的有向包围盒，不一致时由网格索引的
+                   去重顶点重算
+【参数】            无
+【返回值】          const OrientedBox3D&，有向包围盒
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const OrientedBox3D& Model3D::GetOrientedBox() const{
+    if (m_pOrientedBox == nullptr 
+        || m_ullOrientedBoxVersion != m_ullGeometryVersion) {
+        m_pOrientedBox = std::make_shared<OrientedBox3D>(
+            BoundingVolume3D::OrientedBox(GetMeshIndex().Vertices));
+        m_ullOrientedBoxVersion = m_ullGeometryVersion;
+    }
+    return *m_pOrientedBox;
+}
+
+/*************************************************************************
+【函数名称】        GetBoundingSphere
+【函数功能】        获取与当前几何一致的近似最小包围球，不一致时由网格索引
+                   的去重顶点重算
+【参数】            无
+【返回值】          const BoundingSphere3D&，包围球
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const BoundingSphere3D& Model3D::GetBoundingSphere() const{
+    if (m_pBoundingSphere == nullptr 
+        || m_ullBoundingSphereVersion != m_ullGeometryVersion) {
+        m_pBoundingSphere = std::make_shared<BoundingSphere3D>(
+            BoundingVolume3D::BoundingSphere(GetMeshIndex().Vertices));
+        m_ullBoundingSphereVersion = m_ullGeometryVersion;
+    }
+    return *m_pBoundingSphere;
+}
+
+/*************************************************************************
+【函数名称】        ConvexHull
+【函数功能】        由网格索引的去重顶点计算凸包（Quickhull，并行划分，
+                   精确方位判定），生成各面外法向朝外的新模型
+【参数】            无
+【返回值】          std::shared_ptr<Model3D>，凸包模型；
+                   顶点全部共面（含更低维）时为nullptr
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::shared_ptr<Model3D> Model3D::ConvexHull() const{
+    ConvexHull3D Hull;
+    if (!Hull.Build(GetMeshIndex().Vertices)) {
+        return nullptr;
+    }
+    const std::vector<Coord3D>& Vertices = Hull.HullVertices();
+    const std::vector<std::array<size_t, 3>>& HullFaces = Hull.HullFaces();
+    auto ToPoint = [&Vertices](size_t Vertex){
+        return Point3D(Vertices[Vertex][0], Vertices[Vertex][1], 
+            Vertices[Vertex][2]);
+    };
+    std::vector<std::shared_ptr<Face3D>> NewFaces(HullFaces.size());
+    Parallel::For(0, HullFaces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            NewFaces[i] = std::make_shared<Face3D>(ToPoint(HullFaces[i][0]),
+                ToPoint(HullFaces[i][1]), ToPoint(HullFaces[i][2]));
+        }
+    });
+    std::shared_ptr<Model3D> Result = std::make_shared<Model3D>();
+    Result->m_sName = m_sName + "_hull";
+    Result->ResetElements(std::move(NewFaces), 
+        std::vector<std::shared_ptr<Line3D>>());
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Decimate
+【函数功能】        QEM边塌缩简化：网格索引的去重顶点与面载入简化器的
+                   紧凑工作数组，简化后由结果并行新建Face3D，Line3D
+                   原样拷贝为新对象，组成新模型
+【参数】            size_t TargetFaceNum：目标面数
+                   double MaxError：单次塌缩允许的最大误差（距离平方和）
+【返回值】          std::shared_ptr<Model3D>，简化模型；
+                   规模超出简化器编号范围时返回nullptr
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 改由FromMesh创建结果模型
+*************************************************************************/
+std::shared_ptr<Model3D> Model3D::Decimate(size_t TargetFaceNum,
+    double MaxError) const{
+    const MeshIndex3D& Index = GetMeshIndex();
+    MeshDecimator3D Decimator;
+    if (!Decimator.Load(Index.Vertices, Index.FaceVertices)) {
+        return nullptr;
+    }
+    Decimator.Simplify(TargetFaceNum, MaxError);
+    std::vector<Coord3D> Vertices;
+    std::vector<std::array<size_t, 3>> Faces;
+    Decimator.Extract(Vertices, Faces);
+    return FromMesh(m_sName + "_simplified", Vertices, Faces,
+        ExtractLineSegments());
+}
+
+/*************************************************************************
+【函数名称】        Slice
+【函数功能】        水平平面切片：网格索引的去重顶点与面交给MeshSlicer3D，
+                   共享顶点的相邻面在共享边上得到相同交点
+【参数】            const std::vector<double>& Heights：各平面高度
+                   std::vector<SliceLayer3D>& Layers：各层轮廓（会被重写）
+【返回值】          size_t，全部层的交线段数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+size_t Model3D::Slice(const std::vector<double>& Heights,
+    std::vector<SliceLayer3D>& Layers) const{
+    const MeshIndex3D& Index = GetMeshIndex();
+    MeshSlicer3D Slicer;
+    Slicer.Slice(Index.Vertices, Index.FaceVertices, Heights, Layers);
+    return Slicer.SegmentNum();
+}
+
+/*************************************************************************
+【函数名称】        Voxelize
+【函数功能】        体素化：各Face3D展开为三角形交给VoxelGrid3D，
+                   Line3D不参与
+【参数】            double VoxelSize：体素边长
+                   bool IsSolid：是否填充内部
+                   VoxelGrid3D& Grid：体素网格（会被重写）
+【返回值】          bool，成功返回true；无面、边长不为正或单轴体素数
+                   超限时返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::Voxelize(double VoxelSize, bool IsSolid,
+    VoxelGrid3D& Grid) const{
+    return Grid.Build(ExtractFaceTriangles(), VoxelSize, IsSolid);
+}
+
+/*************************************************************************
+【函数名称】        DiffTo
+【函数功能】        与修订版模型的结构差异：两模型的面、线坐标交给
+                   ModelDiff3D按规范键散列配对
+【参数】            const Model3D& Revised：修订版模型
+                   ModelPatch3D& Patch：由本模型得到修订版的补丁（会被重写）
+                   size_t& UnchangedFaceNum：未改动的面数
+                   size_t& UnchangedLineNum：未改动的线数
+                   double Tolerance：坐标取整容差，默认为0（精确比较）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::DiffTo(const Model3D& Revised, ModelPatch3D& Patch,
+    size_t& UnchangedFaceNum, size_t& UnchangedLineNum,
+    double Tolerance) const{
+    ModelDiff3D Diff;
+    Diff.Compare(ExtractFaceTriangles(), ExtractLineSegments(),
+        Revised.ExtractFaceTriangles(), Revised.ExtractLineSegments(),
+        Tolerance, Patch);
+    UnchangedFaceNum = Diff.UnchangedFaceNum();
+    UnchangedLineNum = Diff.UnchangedLineNum();
+}
+
+/*************************************************************************
+【函数名称】        GetFaceAreas
+【函数功能】        并行批量求各Face3D面积（叉积模长的一半，SIMD内核）
+【参数】            std::vector<double>& Areas：各面面积（会被重写），
+                   下标即面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::GetFaceAreas(std::vector<double>& Areas) const{
+    Areas.resize(m_Faces.size());
+    Parallel::For(0, m_Faces.size(), [&](size_t First, size_t Last){
+        MeasureFaces(First, Last, Areas.data() + First);
+    });
+}
+
+/*************************************************************************
+【函数名称】        GetLineLengths
+【函数功能】        并行批量求各Line3D长度（SIMD内核）
+【参数】            std::vector<double>& Lengths：各线长度（会被重写），
+                   下标即线标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::GetLineLengths(std::vector<double>& Lengths) const{
+    Lengths.resize(m_Lines.size());
+    Parallel::For(0, m_Lines.size(), [&](size_t First, size_t Last){
+        MeasureLines(First, Last, Lengths.data() + First);
+    });
+}
+
+/*************************************************************************
+【函数名称】        GetNormals
+【函数功能】        获取与当前几何一致的法向缓冲区：不一致或孤立顶点过多
+                   时由网格索引并行重建，否则只重算增量修改登记的脏面
+                   及其邻域顶点
+【参数】            无
+【返回值】          const NormalBuffer3D&，法向缓冲区
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const NormalBuffer3D& Model3D::GetNormals() const{
+    if (!IsNormalBufferFresh() || m_pNormalBuffer->NeedRebuild()) {
+        if (m_pNormalBuffer == nullptr) {
+            m_pNormalBuffer = std::make_shared<NormalBuffer3D>();
+        }
+        m_pNormalBuffer->Build(GetMeshIndex());
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    else if (m_pNormalBuffer->IsDirty()) {
+        m_pNormalBuffer->Refresh();
+    }
+    return *m_pNormalBuffer;
+}
+
+/*************************************************************************
+【函数名称】        VerifyMeasureSums
+【函数功能】        并行全量重算面积、长度总和（补偿求和），与增量维护的
+                   总和比较，用于检查长时间编辑后的累计漂移
+【参数】            MeasureDrift3D& Drift：校验结果（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::VerifyMeasureSums(MeasureDrift3D& Drift) const{
+    //相对漂移，重算值为0时取绝对漂移
+    auto Relative = [](double Difference, double Reference){
+        return Reference == 0.0 ? 
+            Difference : Difference / std::abs(Reference);
+    };
+    Drift.MaintainedArea = m_rFaceArea_Sum;
+    Drift.RecomputedArea = SumFaceAreas().Value();
+    Drift.AreaDrift = std::abs(Drift.MaintainedArea - Drift.RecomputedArea);
+    Drift.AreaRelativeDrift = Relative(Drift.AreaDrift, Drift.RecomputedArea);
+    Drift.MaintainedLength = m_rLineLength_Sum;
+    Drift.RecomputedLength = SumLineLengths().Value();
+    Drift.LengthDrift = 
+        std::abs(Drift.MaintainedLength - Drift.RecomputedLength);
+    Drift.LengthRelativeDrift = 
+        Relative(Drift.LengthDrift, Drift.RecomputedLength);
+}
+
+/*************************************************************************
+【函数名称】        FindElementsInBox
+【函数功能】        查询与包围盒相交的Face3D与Line3D，
+                   由空间网格筛选候选后精确检验，不拷贝元素对象
+【参数】            const Point3D& MinPoint, const Point3D& MaxPoint：
+                   包围盒最小、最大角点
+                   std::vector<size_t>& FaceTags：相交面标签（重写，升序）
+                   std::vector<size_t>& LineTags：相交线标签（重写，升序）
+【返回值】          无，角点某轴最小值大于最大值时结果为空
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::FindElementsInBox(const Point3D& MinPoint, 
+    const Point3D& MaxPoint, std::vector<size_t>& FaceTags, 
+    std::vector<size_t>& LineTags) const{
+    GetElementGrid().BoxQuery(MinPoint.GetXYZ(), MaxPoint.GetXYZ(),
+        FaceTags, LineTags);
+}
+
+/*************************************************************************
+【函数名称】        FindElementsInSphere
+【函数功能】        查询与球相交的Face3D与Line3D，
+                   由空间网格筛选候选后按最近点距离精确检验
+【参数】            const Point3D& Center：球心
+                   double Radius：半径
+                   std::vector<size_t>& FaceTags：相交面标签（重写，升序）
+                   std::vector<size_t>& LineTags：相交线标签（重写，升序）
+【返回值】          无，半径为负时结果为空
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::FindElementsInSphere(const Point3D& Center, double Radius,
+    std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const{
+    GetElementGrid().SphereQuery(Center.GetXYZ(), Radius, 
+        FaceTags, LineTags);
+}
+
+/*************************************************************************
+【函数名称】        FaceSearcher
+【函数功能】        查找指定Face3D对象的迭代器
+【参数】            const Face3D& Face1：要查找的Face3D对象
+【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
+【开发者及日期】    梁思奇 2024/8/5
+【更改记录】         
+*************************************************************************/
+std::vector<std::shared_ptr<Face3D>>::iterator Model3D::FaceSearcher(
+    const Face3D& Face1){
+    //使用Lambda表达式进行查找
+    auto Finder =
+        [&Face1](std::shared_ptr<Face3D> Ptr)->bool{return *Ptr == Face1;};
+    //使用find_if函数进行查找，返回查找结果
+    auto Result = find_if(m_Faces.begin(), m_Faces.end(), Finder);
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        LineSearcher
+【函数功能】        查找指定Line3D对象的迭代器
+【参数】            const Line3D& Line1：要查找的Line3D对象
+【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
+【开发者及日期】    梁思奇 2024/8/5
+【更改记录】         
+*************************************************************************/
+std::vector<std::shared_ptr<Line3D>>::iterator Model3D::LineSearcher(
+    const Line3D& Line1){
+    //使用Lambda表达式进行查找
+    auto Finder =
+        [&Line1](std::shared_ptr<Line3D>& Ptr)->bool{return *Ptr == Line1;};
+    //使用find_if函数进行查找，返回查找结果
+    auto Result = find_if(m_Lines.begin(), m_Lines.end(), Finder);
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        PointSearcher
+【函数功能】        查找指定Point3D对象的迭代器
+【参数】            const Point3D& Point1：要查找的Point3D对象
+【返回值】          如果找到，返回具体迭代器；否则返回尾迭代器
+【开发者及日期】    梁思奇 2024/8/5
+【更改记录】         
+*************************************************************************/
+std::vector<std::shared_ptr<Point3D>>::iterator Model3D::PointSearcher(
+    const Point3D& Point1){
+    //使用Lambda表达式进行查找
+    auto Finder =
+        [&Point1](std::shared_ptr<Point3D> Ptr)->bool{return *Ptr == Point1;};
+    //使用find_if函数进行查找，返回查找结果
+    auto Result = find_if(m_Points.begin(), m_Points.end(), Finder);
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        CalcEncaseCuboid
+【函数功能】        计算并更新模型的最小包围长方体的尺寸和体积
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2024/8/5
+【更改记录】        梁思奇 2026/10/18 尺寸、面积与体积改由SetEncaseCuboid设定
+*************************************************************************/
+void Model3D::CalcEncaseCuboid(){
+    //如果没有Element(Face3D和Line3D对象)，最小包围长方体尺寸为0
+    if (ElementNum == 0) {
+        m_rEncaseCuboid_Length = 0.0;
+        m_rEncaseCuboid_Width = 0.0;
+        m_rEncaseCuboid_Height = 0.0;
+        m_rEncaseCuboid_Volume = 0.0;
+        m_EncaseCuboid_Min = {0.0, 0.0, 0.0};
+        m_EncaseCuboid_Max = {0.0, 0.0, 0.0};
+        return;
+    }
+    std::vector<Point3D> AllPoints;
+    //将所有Face3D对象的点添加到AllPoints
+    for (auto & TempFace : Faces) {
+        for (size_t i = 0; i < 3; i++) {
+            AllPoints.push_back(TempFace->Points[i]);
+        }
+    }
+    //将所有Line3D对象的点添加到AllPoints
+    for (auto & TempLine : Lines) {
+        for (size_t i = 0; i < 2; i++) {
+            AllPoints.push_back(TempLine->Points[i]);
+        }
+    }
+
+    //定义简化后的迭代器类型
+    using PointIt = std::vector<Point3D>::iterator;
+    //注：以下3个计算式很长，均拆分为从第2行开始缩进4格的常规形式
+    //使用标准算法库找到所有点中X的最大最小值
+    std::pair<PointIt, PointIt> MinMax_X = std::minmax_element(
+        AllPoints.begin(),
+        AllPoints.end(),
+        [](const Point3D& Pointlhs, const Point3D& Pointrhs){
+        return Pointlhs.GetX() < Pointrhs.GetX();});
+    //找到X轴最大最小值的迭代器
+    auto Min_X_it = MinMax_X.first;
+    auto Max_X_it = MinMax_X.second;
+
+    //使用标准算法库找到所有点中Y的最大最小值
+    std::pair<PointIt, PointIt> MinMax_Y = std::minmax_element(
+        AllPoints.begin(),
+        AllPoints.end(),
+        [](const Point3D& Pointlhs, const Point3D& Pointrhs){
+        return Pointlhs.GetY() < Pointrhs.GetY();});
+    //找到Y轴最大最小值的迭代器
+    auto Min_Y_it = MinMax_Y.first;
     auto Max_Y_it = MinMax_Y.second;
 
     //使用标准算法库找到所有点中Z的最大最小值
@@ -879,10 +2690,30 @@ void Model3D::CalcEncaseCuboid(){
     auto Min_Z_it = MinMax_Z.first;
     auto Max_Z_it = MinMax_Z.second;
 
+    //由角点设定最小包围长方体
+    SetEncaseCuboid(
+        {Min_X_it->GetX(), Min_Y_it->GetY(), Min_Z_it->GetZ()},
+        {Max_X_it->GetX(), Max_Y_it->GetY(), Max_Z_it->GetZ()});
+}
+
+/*************************************************************************
+【函数名称】        SetEncaseCuboid
+【函数功能】        由角点设定最小包围长方体，并更新其尺寸、面积和体积
+【参数】            const std::array<double, 3>& Min：最小角点
+                   const std::array<double, 3>& Max：最大角点
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::SetEncaseCuboid(const std::array<double, 3>& Min,
+    const std::array<double, 3>& Max){
+    //记录最小包围长方体的角点
+    m_EncaseCuboid_Min = Min;
+    m_EncaseCuboid_Max = Max;
     //更新最小包围长方体的尺寸
-    m_rEncaseCuboid_Length = Max_X_it->GetX() - Min_X_it->GetX();
-    m_rEncaseCuboid_Width = Max_Y_it->GetY() - Min_Y_it->GetY();
-    m_rEncaseCuboid_Height = Max_Z_it->GetZ() - Min_Z_it->GetZ();
+    m_rEncaseCuboid_Length = Max[0] - Min[0];
+    m_rEncaseCuboid_Width = Max[1] - Min[1];
+    m_rEncaseCuboid_Height = Max[2] - Min[2];
     //更新最小包围长方体的面积
     m_rEncaseCuboid_Area 
         = 2 * (m_rEncaseCuboid_Length * m_rEncaseCuboid_Width
@@ -894,3 +2725,818 @@ void Model3D::CalcEncaseCuboid(){
         * m_rEncaseCuboid_Width 
         * m_rEncaseCuboid_Height;
 }
+
+/*************************************************************************
+【函数名称】        ResetElements
+【函数功能】        整体替换Face3D、Line3D列表，并行重算面积、长度总和，
+                   重算最小包围长方体并通知几何整体变化
+【参数】            std::vector<std::shared_ptr<Face3D>>&& NewFaces：新面列表
+                   std::vector<std::shared_ptr<Line3D>>&& NewLines：新线列表
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 面积、长度改由SIMD内核分块计算
+                   梁思奇 2026/10/18 面积、长度改为补偿求和并重置累加器
+*************************************************************************/
+void Model3D::ResetElements(std::vector<std::shared_ptr<Face3D>>&& NewFaces,
+    std::vector<std::shared_ptr<Line3D>>&& NewLines){
+    m_Faces = std::move(NewFaces);
+    m_Lines = std::move(NewLines);
+    //更新统计数据
+    m_ullFaceNum = m_Faces.size();
+    m_ullLineNum = m_Lines.size();
+    m_ullPointNum = 3 * m_ullFaceNum + 2 * m_ullLineNum;
+    m_ullElementNum = m_ullFaceNum + m_ullLineNum;
+    m_FaceAreaAccumulator = SumFaceAreas();
+    m_rFaceArea_Sum = m_FaceAreaAccumulator.Value();
+    m_LineLengthAccumulator = SumLineLengths();
+    m_rLineLength_Sum = m_LineLengthAccumulator.Value();
+    //重新计算最小包围长方体
+    CalcEncaseCuboid();
+    //标签整体变化，通知几何整体变化
+    OnFacesReset();
+    OnLinesReset();
+}
+
+/*************************************************************************
+【函数名称】        IsOnEncaseCuboid
+【函数功能】        判断元素是否有点位于最小包围长方体的表面上；
+                   删除不触及表面的元素不会改变包围长方体，无需重算
+【参数】            const FixedElements3D& Element：要判断的元素
+【返回值】          有点位于表面返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsOnEncaseCuboid(const FixedElements3D& Element) const{
+    for (size_t i = 0; i < Element.PointNum; i++) {
+        std::array<double, 3> TempXYZ = Element.Points[i].GetXYZ();
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            if (TempXYZ[Axis] <= m_EncaseCuboid_Min[Axis] 
+                || TempXYZ[Axis] >= m_EncaseCuboid_Max[Axis]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*************************************************************************
+【函数名称】        IsInEncaseCuboid
+【函数功能】        判断点是否位于最小包围长方体内（含表面）；
+                   加入不超出包围长方体的点不会改变包围长方体
+【参数】            const Point3D& Point1：要判断的点
+【返回值】          位于长方体内返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsInEncaseCuboid(const Point3D& Point1) const{
+    std::array<double, 3> TempXYZ = Point1.GetXYZ();
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        if (TempXYZ[Axis] < m_EncaseCuboid_Min[Axis] 
+            || TempXYZ[Axis] > m_EncaseCuboid_Max[Axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        OnFaceAdded
+【函数功能】        添加Face3D后递增几何版本号，BVH随之失效；
+                   空间网格、法向缓冲区原本有效时插入新面，保持有效
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 增量维护空间网格
+                   梁思奇 2026/10/18 增量维护法向缓冲区
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnFaceAdded(){
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsGridFresh) {
+        m_pElementGrid->InsertFace(GetFaceTriangle(m_Faces.size() - 1));
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_pNormalBuffer->InsertFace(GetFaceTriangle(m_Faces.size() - 1));
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->InsertFace(GetFaceTriangle(m_Faces.size() - 1));
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnFaceChanged
+【函数功能】        修改Face3D后递增几何版本号；BVH原本有效时
+                   只重拟合该面所在叶节点到根的路径，BVH保持有效；
+                   空间网格、法向缓冲区原本有效时更新该面，保持有效
+【参数】            size_t FaceTag：被修改的Face3D标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 增量维护空间网格
+                   梁思奇 2026/10/18 增量维护法向缓冲区
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnFaceChanged(size_t FaceTag){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_pFaceBVH->Refit(FaceTag, GetFaceTriangle(FaceTag));
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    if (IsGridFresh) {
+        m_pElementGrid->UpdateFace(FaceTag, GetFaceTriangle(FaceTag));
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_pNormalBuffer->UpdateFace(FaceTag, GetFaceTriangle(FaceTag));
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->UpdateFace(FaceTag, GetFaceTriangle(FaceTag));
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnFaceRemoved
+【函数功能】        交换-弹出删除Face3D后递增几何版本号；BVH原本有效时
+                   置墓碑并同步标签映射，墓碑过多时留待下次查询重建；
+                   空间网格、法向缓冲区原本有效时同样交换-弹出删除
+【参数】            size_t FaceTag：被删除的Face3D标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 增量维护空间网格
+                   梁思奇 2026/10/18 增量维护法向缓冲区
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnFaceRemoved(size_t FaceTag){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_pFaceBVH->Remove(FaceTag);
+        if (!m_pFaceBVH->NeedRebuild()) {
+            m_ullFaceBVHVersion = m_ullGeometryVersion;
+        }
+    }
+    if (IsGridFresh) {
+        m_pElementGrid->RemoveFace(FaceTag);
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_pNormalBuffer->RemoveFace(FaceTag);
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->RemoveFace(FaceTag);
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnFacesReset
+【函数功能】        Face3D整体变化后递增几何版本号并释放BVH、空间网格与
+                   法向缓冲区
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 同时释放空间网格
+                   梁思奇 2026/10/18 同时释放法向缓冲区
+                   梁思奇 2026/10/18 同时释放顶点关联索引
+*************************************************************************/
+void Model3D::OnFacesReset(){
+    m_ullGeometryVersion++;
+    m_pFaceBVH = nullptr;
+    m_pElementGrid = nullptr;
+    m_pNormalBuffer = nullptr;
+    m_pVertexIncidence = nullptr;
+}
+
+/*************************************************************************
+【函数名称】        OnLineAdded
+【函数功能】        添加Line3D后递增几何版本号；面BVH不受影响，
+                   原本有效时保持有效；空间网格原本有效时插入新线
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 法向缓冲区原本有效时同样保持有效
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnLineAdded(){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsGridFresh) {
+        m_pElementGrid->InsertLine(GetLineSegment(m_Lines.size() - 1));
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->InsertLine(GetLineSegment(m_Lines.size() - 1));
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnLineChanged
+【函数功能】        修改Line3D后递增几何版本号；面BVH原本有效时保持有效；
+                   空间网格原本有效时更新该线
+【参数】            size_t LineTag：被修改的Line3D标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 法向缓冲区原本有效时同样保持有效
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnLineChanged(size_t LineTag){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsGridFresh) {
+        m_pElementGrid->UpdateLine(LineTag, GetLineSegment(LineTag));
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->UpdateLine(LineTag, GetLineSegment(LineTag));
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnLineRemoved
+【函数功能】        交换-弹出删除Line3D后递增几何版本号；面BVH原本有效时
+                   保持有效；空间网格原本有效时同样交换-弹出删除
+【参数】            size_t LineTag：被删除的Line3D标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 法向缓冲区原本有效时同样保持有效
+                   梁思奇 2026/10/18 增量维护顶点关联索引
+*************************************************************************/
+void Model3D::OnLineRemoved(size_t LineTag){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    bool IsGridFresh = IsElementGridFresh();
+    bool IsIncidenceFresh = IsVertexIncidenceFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    if (IsGridFresh) {
+        m_pElementGrid->RemoveLine(LineTag);
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    if (IsIncidenceFresh) {
+        m_pVertexIncidence->RemoveLine(LineTag);
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+}
+
+/*************************************************************************
+【函数名称】        OnLinesReset
+【函数功能】        Line3D整体变化后递增几何版本号并释放空间网格；
+                   面BVH原本有效时保持有效
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 法向缓冲区原本有效时同样保持有效
+                   梁思奇 2026/10/18 同时释放顶点关联索引
+*************************************************************************/
+void Model3D::OnLinesReset(){
+    bool IsFresh = IsFaceBVHFresh();
+    bool IsNormalFresh = IsNormalBufferFresh();
+    m_ullGeometryVersion++;
+    if (IsFresh) {
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    if (IsNormalFresh) {
+        m_ullNormalBufferVersion = m_ullGeometryVersion;
+    }
+    m_pElementGrid = nullptr;
+    m_pVertexIncidence = nullptr;
+}
+
+/*************************************************************************
+【函数名称】        IsFaceBVHFresh
+【函数功能】        判断BVH是否已构建且与当前几何版本一致
+【参数】            无
+【返回值】          一致返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsFaceBVHFresh() const{
+    return m_pFaceBVH != nullptr 
+        && m_ullFaceBVHVersion == m_ullGeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        GetFaceBVH
+【函数功能】        获取与当前几何一致的BVH，不一致时由全部Face3D并行重建
+【参数】            无
+【返回值】          const BVH3D&，面BVH
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const BVH3D& Model3D::GetFaceBVH() const{
+    if (!IsFaceBVHFresh()) {
+        if (m_pFaceBVH == nullptr) {
+            m_pFaceBVH = std::make_shared<BVH3D>();
+        }
+        m_pFaceBVH->Build(ExtractFaceTriangles());
+        m_ullFaceBVHVersion = m_ullGeometryVersion;
+    }
+    return *m_pFaceBVH;
+}
+
+/*************************************************************************
+【函数名称】        IsElementGridFresh
+【函数功能】        判断空间网格是否已构建且与当前几何版本一致
+【参数】            无
+【返回值】          一致返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsElementGridFresh() const{
+    return m_pElementGrid != nullptr 
+        && m_ullElementGridVersion == m_ullGeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        GetElementGrid
+【函数功能】        获取与当前几何一致的空间网格；不一致或增量修改后
+                   元素数偏离构建时过多时，在当前包围长方体上重建
+【参数】            无
+【返回值】          const SpatialGrid3D&，元素空间网格
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const SpatialGrid3D& Model3D::GetElementGrid() const{
+    if (!IsElementGridFresh() || m_pElementGrid->NeedRebuild()) {
+        if (m_pElementGrid == nullptr) {
+            m_pElementGrid = std::make_shared<SpatialGrid3D>();
+        }
+        m_pElementGrid->Build(ExtractFaceTriangles(), ExtractLineSegments(),
+            m_EncaseCuboid_Min, m_EncaseCuboid_Max);
+        m_ullElementGridVersion = m_ullGeometryVersion;
+    }
+    return *m_pElementGrid;
+}
+
+/*************************************************************************
+【函数名称】        IsNormalBufferFresh
+【函数功能】        判断法向缓冲区是否已构建且与当前几何版本一致
+                   （可能仍有待重算的脏面）
+【参数】            无
+【返回值】          一致返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsNormalBufferFresh() const{
+    return m_pNormalBuffer != nullptr 
+        && m_ullNormalBufferVersion == m_ullGeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        IsVertexIncidenceFresh
+【函数功能】        判断顶点关联索引是否已构建且与当前几何版本一致
+【参数】            无
+【返回值】          一致返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+bool Model3D::IsVertexIncidenceFresh() const{
+    return m_pVertexIncidence != nullptr 
+        && m_ullVertexIncidenceVersion == m_ullGeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        GetVertexIncidence
+【函数功能】        获取与当前几何一致的顶点关联索引；不一致或孤立顶点
+                   过多时由网格索引重建，否则直接返回增量维护的索引
+【参数】            无
+【返回值】          const VertexIncidence3D&，顶点关联索引
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+const VertexIncidence3D& Model3D::GetVertexIncidence() const{
+    if (!IsVertexIncidenceFresh() || m_pVertexIncidence->NeedRebuild()) {
+        if (m_pVertexIncidence == nullptr) {
+            m_pVertexIncidence = std::make_shared<VertexIncidence3D>();
+        }
+        m_pVertexIncidence->Build(GetMeshIndex());
+        m_ullVertexIncidenceVersion = m_ullGeometryVersion;
+    }
+    return *m_pVertexIncidence;
+}
+
+/*************************************************************************
+【函数名称】        GetFaceTriangle
+【函数功能】        获取指定标签Face3D的三顶点坐标
+【参数】            size_t FaceTag：Face3D标签（调用者保证不越界）
+【返回值】          Triangle3D，三顶点坐标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Triangle3D Model3D::GetFaceTriangle(size_t FaceTag) const{
+    const Face3D& TempFace = *m_Faces[FaceTag];
+    return Triangle3D{TempFace.Points[0].GetXYZ(),
+        TempFace.Points[1].GetXYZ(), TempFace.Points[2].GetXYZ()};
+}
+
+/*************************************************************************
+【函数名称】        GetLineSegment
+【函数功能】        获取指定标签Line3D的两端点坐标
+【参数】            size_t LineTag：Line3D标签（调用者保证不越界）
+【返回值】          Segment3D，两端点坐标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+Segment3D Model3D::GetLineSegment(size_t LineTag) const{
+    const Line3D& TempLine = *m_Lines[LineTag];
+    return Segment3D{TempLine.Points[0].GetXYZ(),
+        TempLine.Points[1].GetXYZ()};
+}
+
+/*************************************************************************
+【函数名称】        ExtractFaceTriangles
+【函数功能】        并行提取所有Face3D的三顶点坐标
+【参数】            无
+【返回值】          std::vector<BVH3D::Triangle3D>，下标即面标签
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::vector<BVH3D::Triangle3D> Model3D::ExtractFaceTriangles() const{
+    std::vector<BVH3D::Triangle3D> Triangles(m_Faces.size());
+    Parallel::For(0, m_Faces.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 3; k++) {
+                Triangles[i][k] = m_Faces[i]->Points[k].GetXYZ();
+            }
+        }
+    });
+    return Triangles;
+}
+
+/*************************************************************************
+【函数名称】        ExtractLineSegments
+【函数功能】        并行提取所有Line3D的两端点坐标
+【参数】            无
+【返回值】          std::vector<Segment3D>，下标即线标签
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::vector<Segment3D> Model3D::ExtractLineSegments() const{
+    std::vector<Segment3D> Segments(m_Lines.size());
+    Parallel::For(0, m_Lines.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 2; k++) {
+                Segments[i][k] = m_Lines[i]->Points[k].GetXYZ();
+            }
+        }
+    });
+    return Segments;
+}
+
+/*************************************************************************
+【函数名称】        MeasureFaces
+【函数功能】        按MeasureKernel3D::BLOCK_SIZE分块，把Face3D顶点坐标
+                   收集到栈上SoA数组后调用面积内核
+【参数】            size_t First, size_t Last：面标签范围[First, Last)
+                   double* Areas：非空时写入各面面积（Areas[0]对应First）
+【返回值】          CompensatedSum，范围内面积的补偿和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 改为返回补偿和
+*************************************************************************/
+CompensatedSum Model3D::MeasureFaces(size_t First, size_t Last, 
+    double* Areas) const{
+    const size_t BlockSize = MeasureKernel3D::BLOCK_SIZE;
+    //0~8为三顶点坐标分量，9为面积
+    double Block[10][MeasureKernel3D::BLOCK_SIZE];
+    CompensatedSum Sum{};
+    for (size_t Begin = First; Begin < Last; Begin += BlockSize) {
+        size_t Size = std::min(BlockSize, Last - Begin);
+        for (size_t i = 0; i < Size; i++) {
+            const Face3D& TempFace = *m_Faces[Begin + i];
+            for (size_t k = 0; k < 3; k++) {
+                std::array<double, 3> XYZ = TempFace.Points[k].GetXYZ();
+                Block[3 * k][i] = XYZ[0];
+                Block[3 * k + 1][i] = XYZ[1];
+                Block[3 * k + 2][i] = XYZ[2];
+            }
+        }
+        MeasureKernel3D::TriangleAreas(Size, Block[0], Block[1], Block[2],
+            Block[3], Block[4], Block[5], Block[6], Block[7], Block[8],
+            Block[9]);
+        for (size_t i = 0; i < Size; i++) {
+            Sum += Block[9][i];
+        }
+        if (Areas != nullptr) {
+            std::copy(Block[9], Block[9] + Size, Areas + (Begin - First));
+        }
+    }
+    return Sum;
+}
+
+/*************************************************************************
+【函数名称】        MeasureLines
+【函数功能】        按MeasureKernel3D::BLOCK_SIZE分块，把Line3D端点坐标
+                   收集到栈上SoA数组后调用长度内核
+【参数】            size_t First, size_t Last：线标签范围[First, Last)
+                   double* Lengths：非空时写入各线长度（Lengths[0]对应First）
+【返回值】          CompensatedSum，范围内长度的补偿和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 改为返回补偿和
+*************************************************************************/
+CompensatedSum Model3D::MeasureLines(size_t First, size_t Last, 
+    double* Lengths) const{
+    const size_t BlockSize = MeasureKernel3D::BLOCK_SIZE;
+    //0~5为两端点坐标分量，6为长度
+    double Block[7][MeasureKernel3D::BLOCK_SIZE];
+    CompensatedSum Sum{};
+    for (size_t Begin = First; Begin < Last; Begin += BlockSize) {
+        size_t Size = std::min(BlockSize, Last - Begin);
+        for (size_t i = 0; i < Size; i++) {
+            const Line3D& TempLine = *m_Lines[Begin + i];
+            for (size_t k = 0; k < 2; k++) {
+                std::array<double, 3> XYZ = TempLine.Points[k].GetXYZ();
+                Block[3 * k][i] = XYZ[0];
+                Block[3 * k + 1][i] = XYZ[1];
+                Block[3 * k + 2][i] = XYZ[2];
+            }
+        }
+        MeasureKernel3D::SegmentLengths(Size, Block[0], Block[1], Block[2],
+            Block[3], Block[4], Block[5], Block[6]);
+        for (size_t i = 0; i < Size; i++) {
+            Sum += Block[6][i];
+        }
+        if (Lengths != nullptr) {
+            std::copy(Block[6], Block[6] + Size, Lengths + (Begin - First));
+        }
+    }
+    return Sum;
+}
+
+/*************************************************************************
+【函数名称】        TransformFaces
+【函数功能】        按MeasureKernel3D::BLOCK_SIZE分块，把Face3D顶点坐标
+                   收集到栈上SoA数组，经仿射变换内核原位变换后新建
+                   Face3D对象（需要时交换后两个顶点），同时扩展包围盒；
+                   需要时再调用面积内核
+【参数】            size_t First, size_t Last：面标签范围[First, Last)
+                   const double* Matrix：按行存放的3×4矩阵
+                   bool IsMeasured：是否求变换后的面积
+                   bool IsFlipped：是否交换后两个顶点（矩阵行列式为负时
+                   保持环绕方向）
+                   std::vector<std::shared_ptr<Face3D>>& NewFaces：
+                   新对象（下标即面标签，顶点重合时为nullptr）
+                   std::array<Coord3D, 2>& Bounds：包围盒（最小、最大角点）
+【返回值】          CompensatedSum，IsMeasured为true时为变换后面积的补偿和，
+                   否则为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 增加顶点顺序翻转
+*************************************************************************/
+CompensatedSum Model3D::TransformFaces(size_t First, size_t Last,
+    const double* Matrix, bool IsMeasured, bool IsFlipped,
+    std::vector<std::shared_ptr<Face3D>>& NewFaces,
+    std::array<Coord3D, 2>& Bounds) const{
+    const size_t BlockSize = MeasureKernel3D::BLOCK_SIZE;
+    //0~2为各点（依次为全部A、全部B、全部C）的坐标分量，3为面积
+    double Block[4][3 * MeasureKernel3D::BLOCK_SIZE];
+    CompensatedSum Sum{};
+    for (size_t Begin = First; Begin < Last; Begin += BlockSize) {
+        size_t Size = std::min(BlockSize, Last - Begin);
+        for (size_t i = 0; i < Size; i++) {
+            const Face3D& TempFace = *m_Faces[Begin + i];
+            for (size_t k = 0; k < 3; k++) {
+                std::array<double, 3> XYZ = TempFace.Points[k].GetXYZ();
+                for (size_t Axis = 0; Axis < 3; Axis++) {
+                    Block[Axis][k * BlockSize + i] = XYZ[Axis];
+                }
+            }
+        }
+        for (size_t k = 0; k < 3; k++) {
+            MeasureKernel3D::TransformPoints(Size, Matrix,
+                Block[0] + k * BlockSize, Block[1] + k * BlockSize,
+                Block[2] + k * BlockSize);
+        }
+        for (size_t i = 0; i < Size; i++) {
+            std::array<Point3D, 3> Vertices;
+            for (size_t k = 0; k < 3; k++) {
+                size_t Index = k * BlockSize + i;
+                Vertices[k].SetXYZ(
+                    Block[0][Index], Block[1][Index], Block[2][Index]);
+                for (size_t Axis = 0; Axis < 3; Axis++) {
+                    Bounds[0][Axis] 
+                        = std::min(Bounds[0][Axis], Block[Axis][Index]);
+                    Bounds[1][Axis] 
+                        = std::max(Bounds[1][Axis], Block[Axis][Index]);
+                }
+            }
+            if (Vertices[0] == Vertices[1] || Vertices[1] == Vertices[2]
+                || Vertices[2] == Vertices[0]) {
+                NewFaces[Begin + i] = nullptr;
+                continue;
+            }
+            //面积与顶点顺序无关，内核结果不受影响
+            if (IsFlipped) {
+                std::swap(Vertices[1], Vertices[2]);
+            }
+            NewFaces[Begin + i] = std::make_shared<Face3D>(
+                Vertices[0], Vertices[1], Vertices[2]);
+        }
+        if (IsMeasured) {
+            MeasureKernel3D::TriangleAreas(Size, Block[0], Block[1],
+                Block[2], Block[0] + BlockSize, Block[1] + BlockSize,
+                Block[2] + BlockSize, Block[0] + 2 * BlockSize,
+                Block[1] + 2 * BlockSize, Block[2] + 2 * BlockSize,
+                Block[3]);
+            for (size_t i = 0; i < Size; i++) {
+                Sum += Block[3][i];
+            }
+        }
+    }
+    return Sum;
+}
+
+/*************************************************************************
+【函数名称】        TransformLines
+【函数功能】        按MeasureKernel3D::BLOCK_SIZE分块，把Line3D端点坐标
+                   收集到栈上SoA数组，经仿射变换内核原位变换后新建
+                   Line3D对象，同时扩展包围盒；需要时再调用长度内核
+【参数】            size_t First, size_t Last：线标签范围[First, Last)
+                   const double* Matrix：按行存放的3×4矩阵
+                   bool IsMeasured：是否求变换后的长度
+                   std::vector<std::shared_ptr<Line3D>>& NewLines：
+                   新对象（下标即线标签，端点重合时为nullptr）
+                   std::array<Coord3D, 2>& Bounds：包围盒（最小、最大角点）
+【返回值】          CompensatedSum，IsMeasured为true时为变换后长度的补偿和，
+                   否则为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+CompensatedSum Model3D::TransformLines(size_t First, size_t Last,
+    const double* Matrix, bool IsMeasured,
+    std::vector<std::shared_ptr<Line3D>>& NewLines,
+    std::array<Coord3D, 2>& Bounds) const{
+    const size_t BlockSize = MeasureKernel3D::BLOCK_SIZE;
+    //0~2为各点（依次为全部A、全部B）的坐标分量，3为长度
+    double Block[4][2 * MeasureKernel3D::BLOCK_SIZE];
+    CompensatedSum Sum{};
+    for (size_t Begin = First; Begin < Last; Begin += BlockSize) {
+        size_t Size = std::min(BlockSize, Last - Begin);
+        for (size_t i = 0; i < Size; i++) {
+            const Line3D& TempLine = *m_Lines[Begin + i];
+            for (size_t k = 0; k < 2; k++) {
+                std::array<double, 3> XYZ = TempLine.Points[k].GetXYZ();
+                for (size_t Axis = 0; Axis < 3; Axis++) {
+                    Block[Axis][k * BlockSize + i] = XYZ[Axis];
+                }
+            }
+        }
+        for (size_t k = 0; k < 2; k++) {
+            MeasureKernel3D::TransformPoints(Size, Matrix,
+                Block[0] + k * BlockSize, Block[1] + k * BlockSize,
+                Block[2] + k * BlockSize);
+        }
+        for (size_t i = 0; i < Size; i++) {
+            std::array<Point3D, 2> Ends;
+            for (size_t k = 0; k < 2; k++) {
+                size_t Index = k * BlockSize + i;
+                Ends[k].SetXYZ(
+                    Block[0][Index], Block[1][Index], Block[2][Index]);
+                for (size_t Axis = 0; Axis < 3; Axis++) {
+                    Bounds[0][Axis] 
+                        = std::min(Bounds[0][Axis], Block[Axis][Index]);
+                    Bounds[1][Axis] 
+                        = std::max(Bounds[1][Axis], Block[Axis][Index]);
+                }
+            }
+            if (Ends[0] == Ends[1]) {
+                NewLines[Begin + i] = nullptr;
+                continue;
+            }
+            NewLines[Begin + i] = std::make_shared<Line3D>(Ends[0], Ends[1]);
+        }
+        if (IsMeasured) {
+            MeasureKernel3D::SegmentLengths(Size, Block[0], Block[1],
+                Block[2], Block[0] + BlockSize, Block[1] + BlockSize,
+                Block[2] + BlockSize, Block[3]);
+            for (size_t i = 0; i < Size; i++) {
+                Sum += Block[3][i];
+            }
+        }
+    }
+    return Sum;
+}
+
+/*************************************************************************
+【函数名称】        SumFaceAreas
+【函数功能】        并行全量重算Face3D总面积，各块补偿求和后按块序合并
+【参数】            无
+【返回值】          CompensatedSum，总面积的补偿和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+CompensatedSum Model3D::SumFaceAreas() const{
+    return Parallel::Reduce(0, m_Faces.size(), CompensatedSum{},
+        [&](size_t First, size_t Last){
+            return MeasureFaces(First, Last, nullptr);
+        },
+        [](CompensatedSum Lhs, const CompensatedSum& Rhs){
+            Lhs += Rhs;
+            return Lhs;
+        });
+}
+
+/*************************************************************************
+【函数名称】        SumLineLengths
+【函数功能】        并行全量重算Line3D总长度，各块补偿求和后按块序合并
+【参数】            无
+【返回值】          CompensatedSum，总长度的补偿和
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+CompensatedSum Model3D::SumLineLengths() const{
+    return Parallel::Reduce(0, m_Lines.size(), CompensatedSum{},
+        [&](size_t First, size_t Last){
+            return MeasureLines(First, Last, nullptr);
+        },
+        [](CompensatedSum Lhs, const CompensatedSum& Rhs){
+            Lhs += Rhs;
+            return Lhs;
+        });
+}
+
+/*************************************************************************
+【函数名称】        AccumulateFaceArea
+【函数功能】        向面积补偿累加器加减一个面积，并更新对外的总面积
+【参数】            double Area：增加的面积（删除时为负）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::AccumulateFaceArea(double Area){
+    m_FaceAreaAccumulator += Area;
+    m_rFaceArea_Sum = m_FaceAreaAccumulator.Value();
+}
+
+/*************************************************************************
+【函数名称】        AccumulateLineLength
+【函数功能】        向长度补偿累加器加减一个长度，并更新对外的总长度
+【参数】            double Length：增加的长度（删除时为负）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+void Model3D::AccumulateLineLength(double Length){
+    m_LineLengthAccumulator += Length;
+    m_rLineLength_Sum = m_LineLengthAccumulator.Value();
+}
+
+/*************************************************************************
+【函数名称】        NormalizeDirections
+【函数功能】        并行单位化射线方向，使射线参数即为距离
+【参数】            const std::vector<Coord3D>& Directions：射线方向
+【返回值】          std::vector<Coord3D>，单位方向，零向量保持为零
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】         
+*************************************************************************/
+std::vector<Coord3D> Model3D::NormalizeDirections(
+    const std::vector<Coord3D>& Directions){
+    std::vector<Coord3D> UnitDirections(Directions.size());
+    Parallel::For(0, Directions.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            double Length = Geometry3D::Length(Directions[i]);
+            UnitDirections[i] = Length > 0.0
+                ? Geometry3D::Scale(Directions[i], 1.0 / Length)
+                : Coord3D{0.0, 0.0, 0.0};
+        }
+    });
+    return UnitDirections;
+}
@@ -4,6 +4,32 @@
 【开发者及日期】            梁思奇 2024/8/5
 【更改记录】               梁思奇 2024/8/8 调整bug并增加对点线面的操作
                           梁思奇 2024/8/9 增加模型元素批量合并与移除接口
+                          梁思奇 2026/10/18 增加按标签O(1)删除与批量删除
+                          梁思奇 2026/10/18 增加面BVH射线查询与按标签改点
+                          梁思奇 2026/10/18 增加批量射线查询
+                          梁思奇 2026/10/18 增加网格索引与顶点k-d树
+                          梁思奇 2026/10/18 增加元素空间网格与区域查询
+                          梁思奇 2026/10/18 增加容差顶点焊接
+                          梁思奇 2026/10/18 增加半边拓扑结构
+                          梁思奇 2026/10/18 增加连通分量拆分与小碎块删除
+                          梁思奇 2026/10/18 增加网格校验报告
+                          梁思奇 2026/10/18 增加体积、质心与惯性张量
+                          梁思奇 2026/10/18 增加有向包围盒与包围球
+                          梁思奇 2026/10/18 增加凸包
+                          梁思奇 2026/10/18 增加面法向与顶点法向缓冲区
+                          梁思奇 2026/10/18 增加SIMD批量面积与长度计算
+                          梁思奇 2026/10/18 面积、长度总和改为补偿累加并
+                          增加漂移校验
+                          梁思奇 2026/10/18 增加QEM网格简化
+                          梁思奇 2026/10/18 增加由索引网格直接创建模型
+                          梁思奇 2026/10/18 增加水平平面切片
+                          梁思奇 2026/10/18 增加表面与实体体素化
+                          梁思奇 2026/10/18 增加批量点内外判定
+                          梁思奇 2026/10/18 增加模型间面相交查询
+                          梁思奇 2026/10/18 增加模型间表面距离
+                          梁思奇 2026/10/18 增加结构差异与补丁
+                          梁思奇 2026/10/18 增加整体仿射变换
+                          梁思奇 2026/10/18 增加共享顶点移动
 *************************************************************************/
 
 #ifndef MODEL3D_HPP
@@ -23,6 +49,136 @@
 #include <memory>
 //std::string所属头文件
 #include <string>
+//std::array所属头文件
+#include <array>
+//std::numeric_limits所属头文件
+#include <limits>
+//BVH3D、RayHit3D类所属头文件
+#include "BVH3D.hpp"
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//KDTree3D类所属头文件
+#include "KDTree3D.hpp"
+//SpatialGrid3D类所属头文件
+#include "SpatialGrid3D.hpp"
+//HalfEdgeMesh3D类所属头文件
+#include "HalfEdgeMesh3D.hpp"
+//OrientedBox3D、BoundingSphere3D类所属头文件
+#include "BoundingVolume3D.hpp"
+//NormalBuffer3D类所属头文件
+#include "NormalBuffer3D.hpp"
+//CompensatedSum类所属头文件
+#include "CompensatedSum.hpp"
+//MeshSlicer3D、SliceLayer3D类所属头文件
+#include "MeshSlicer3D.hpp"
+//VoxelGrid3D类所属头文件
+#include "VoxelGrid3D.hpp"
+//ModelPatch3D类所属头文件
+#include "ModelDiff3D.hpp"
+//VertexIncidence3D类所属头文件
+#include "VertexIncidence3D.hpp"
+
+/*************************************************************************
+【类名】             MeshReport3D
+【功能】             网格校验报告
+【接口说明】         数据类：退化面与重复面标签，以及边界边、非流形边、
+                    绕向不一致边等边统计
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class MeshReport3D{
+public:
+    //退化面（三点共线，面积相对最长边可忽略）标签，升序
+    std::vector<size_t> DegenerateFaceTags;
+    //重复面（与更小标签的面顶点相同，不计顺序）标签，升序
+    std::vector<size_t> DuplicateFaceTags;
+    //无向边数
+    size_t EdgeNum;
+    //边界边数（只属于一个面，非零即不封闭）
+    size_t BoundaryEdgeNum;
+    //非流形边数（属于三个及以上面）
+    size_t NonManifoldEdgeNum;
+    //绕向不一致边数（两面在共享边上同向）
+    size_t InconsistentEdgeNum;
+    //是否全部检查通过
+    bool IsValid;
+};
+
+/*************************************************************************
+【类名】             MassProperties3D
+【功能】             模型质量属性（均匀密度1）
+【接口说明】         数据类：有向体积、表面积、面积加权与体积加权质心、
+                    关于体积质心的惯性张量；体积类属性只对封闭网格有意义，
+                    面绕向整体朝内时体积与惯性张量为负
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class MassProperties3D{
+public:
+    //有向体积
+    double Volume;
+    //表面积
+    double Area;
+    //面积加权质心（表面质心）
+    Coord3D SurfaceCentroid;
+    //体积加权质心，体积为0时取原点
+    Coord3D VolumeCentroid;
+    //关于体积质心的惯性张量（行主序）
+    std::array<Coord3D, 3> Inertia;
+};
+
+/*************************************************************************
+【类名】             MeasureDrift3D
+【功能】             面积、长度总和的漂移校验结果
+【接口说明】         数据类：增量维护的总和、并行全量重算的总和，以及二者
+                    的绝对差与相对差（重算值为0时相对差取绝对差）
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class MeasureDrift3D{
+public:
+    //增量维护的Face3D总面积
+    double MaintainedArea;
+    //全量重算的Face3D总面积
+    double RecomputedArea;
+    //面积绝对漂移
+    double AreaDrift;
+    //面积相对漂移
+    double AreaRelativeDrift;
+    //增量维护的Line3D总长度
+    double MaintainedLength;
+    //全量重算的Line3D总长度
+    double RecomputedLength;
+    //长度绝对漂移
+    double LengthDrift;
+    //长度相对漂移
+    double LengthRelativeDrift;
+};
+
+/*************************************************************************
+【类名】             SurfaceDistance3D
+【功能】             一个模型表面到另一模型表面的单向距离统计
+【接口说明】         数据类：各采样点到另一表面最近距离的最大值（单向
+                    Hausdorff距离）、平均值与均方根；提前停止时各量只
+                    统计已求的采样点，最大值为Hausdorff距离的下界
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class SurfaceDistance3D{
+public:
+    //最大距离（单向Hausdorff距离）
+    double Hausdorff;
+    //平均距离
+    double Mean;
+    //均方根距离
+    double RMS;
+    //取得最大距离的采样点
+    Coord3D FarthestPoint;
+    //已求距离的采样点数
+    size_t SampleNum;
+    //是否因距离超过误差界而提前停止
+    bool IsStopped;
+};
 
 /*************************************************************************
 【类名】             Model3D
@@ -32,6 +188,73 @@
 【开发者及日期】      梁思奇 2024/8/5
 【更改记录】         梁思奇 2024/8/8 调整bug并增加对点线面的操作
                     梁思奇 2024/8/9 增加模型元素批量合并与移除接口
+                    梁思奇 2026/10/18 增加按标签O(1)删除与批量删除，
+                    标签稳定性约定：
+                    按单个标签删除采用“交换-弹出”，被删标签由原最后一个
+                    元素接替，其余元素标签不变；
+                    按标签批量删除采用“墓碑标记+一次压缩”，幸存元素保持
+                    原相对顺序，标签依次前移；
+                    按对象删除（DeleteFace/DeleteLine）保持原有顺序语义
+                    梁思奇 2026/10/18 增加面BVH射线查询与按标签改点，
+                    几何版本号在每次几何修改时递增，BVH按需惰性构建；
+                    改点只重拟合BVH，交换-弹出删除只置墓碑，
+                    其余修改使BVH失效，下次查询时重建
+                    梁思奇 2026/10/18 增加批量射线查询（射线包并行遍历）
+                    梁思奇 2026/10/18 增加网格索引与顶点k-d树，
+                    二者均按几何版本号惰性重建
+                    梁思奇 2026/10/18 增加元素空间网格与区域查询，
+                    网格惰性构建，之后随面、线的增、改、交换-弹出删除
+                    增量维护，其余修改使网格失效
+                    梁思奇 2026/10/18 增加容差顶点焊接，焊接后塌缩与
+                    重复的面、线被删除，幸存元素保持原相对顺序
+                    梁思奇 2026/10/18 增加半边拓扑结构，按几何版本号
+                    惰性重建
+                    梁思奇 2026/10/18 增加连通分量拆分与小碎块删除，
+                    面、线经共享顶点（坐标相同）连通；拆分得到的模型
+                    持有新建的Face3D、Line3D对象，不与原模型共享
+                    梁思奇 2026/10/18 增加网格校验报告，边统计取自缓存的
+                    半边结构，退化面与重复面在一次并行遍历中判定
+                    梁思奇 2026/10/18 增加体积、质心与惯性张量，
+                    按几何版本号惰性计算（并行补偿求和）
+                    梁思奇 2026/10/18 增加有向包围盒与包围球，
+                    由去重顶点计算，按几何版本号惰性重算
+                    梁思奇 2026/10/18 增加凸包，由去重顶点以Quickhull
+                    计算，结果为新模型
+                    梁思奇 2026/10/18 增加面法向与顶点法向缓冲区，
+                    惰性构建，之后随面的增、改、交换-弹出删除只登记
+                    脏面，获取时只重算脏面及其邻域顶点，其余修改使
+                    缓冲区失效
+                    梁思奇 2026/10/18 增加SIMD批量面积与长度计算，
+                    面积、长度总和的整体重算与批量查询均分块收集坐标后
+                    调用MeasureKernel3D（运行时选择指令集）
+                    梁思奇 2026/10/18 面积、长度总和改为补偿累加：
+                    增、删、改只向补偿累加器加减单个元素的量，改动拆成
+                    先减旧值、再加新值两次累加，误差不随编辑次数增长；
+                    整体重算时各块补偿求和后按块合并；可并行全量重算
+                    以校验漂移
+                    梁思奇 2026/10/18 增加QEM网格简化，由网格索引载入
+                    紧凑的工作数组（MeshDecimator3D）简化，结果为新模型
+                    梁思奇 2026/10/18 增加由索引网格直接创建模型，
+                    不逐个查重，供简化、多细节层次等批量生成结果使用
+                    梁思奇 2026/10/18 增加水平平面切片，由网格索引的
+                    去重顶点切割，相邻面交点一致，轮廓严格闭合
+                    梁思奇 2026/10/18 增加表面与实体体素化，结果为
+                    稀疏分块位图（VoxelGrid3D）
+                    梁思奇 2026/10/18 增加批量点内外判定，由面BVH上的
+                    竖直射线奇偶计数，结果为位掩码
+                    梁思奇 2026/10/18 增加模型间面相交查询，两模型的
+                    面BVH同时遍历，三角形相交精确判定
+                    梁思奇 2026/10/18 增加模型间表面距离，本模型表面
+                    按面积确定性采样，在另一模型的面BVH上并行求最近点
+                    梁思奇 2026/10/18 增加结构差异与补丁，面、线按规范键
+                    散列配对（ModelDiff3D），补丁整体替换元素列表后应用
+                    梁思奇 2026/10/18 增加整体仿射变换，全部点分块经SIMD
+                    内核变换；相似变换的面积、长度总和按比例解析更新，
+                    其余变换在同一遍中重算，包围长方体同遍求得
+                    梁思奇 2026/10/18 增加共享顶点移动，由顶点关联索引
+                    （VertexIncidence3D）找到相邻面、线，O(顶点度数)；
+                    索引惰性构建，之后随面、线的增、改、交换-弹出删除
+                    增量维护，其余修改使索引失效
 *************************************************************************/
 class Model3D{
 public:
@@ -52,6 +275,12 @@ public:
     virtual ~Model3D() = default;
     //赋值运算符
     Model3D& operator=(const Model3D& Source);
+    //静态函数：由顶点坐标、面顶点下标与线段坐标直接创建模型
+    //（并行新建元素，不查重）
+    static std::shared_ptr<Model3D> FromMesh(const std::string& Name,
+        const std::vector<Coord3D>& Vertices,
+        const std::vector<std::array<size_t, 3>>& Faces,
+        const std::vector<Segment3D>& Segments);
     
     //Face3D增删改操作（除Getter标注外全Setter）
 
@@ -70,11 +299,18 @@ public:
         const Point3D& OldFace, const Point3D& NewFace);
     bool ChangeFace(const Face3D& Face1, 
         size_t Index, const Point3D& NewFace);
+    //按标签修改一个Face3D中的指定点（O(1)，BVH增量重拟合）
+    bool ChangeFacePoint(size_t FaceTag, size_t PointTag, 
+        const Point3D& NewPoint);
 
     //删除一个Face3D
     bool DeleteFace(const Face3D& Face1);
     bool DeleteFace(const Point3D& Point1, 
         const Point3D& Point2, const Point3D& Point3);
+    //按标签删除一个Face3D（交换-弹出，O(1)）
+    bool DeleteFaceByTag(size_t FaceTag);
+    //按标签批量删除Face3D（墓碑标记+一次压缩，O(N + n)），返回删除数
+    size_t DeleteFacesByTags(const std::vector<size_t>& FaceTags);
     //运算符重载：模型移除Face3D
     Model3D& operator-=(const std::vector<Face3D>& vFaces);
     //Getter
@@ -98,16 +334,33 @@ public:
         const Point3D& OldLine, const Point3D& NewLine);
     bool ChangeLine(const Line3D& Line1, 
         size_t Index, const Point3D& NewFace);
+    //按标签修改一个Line3D中的指定点（O(1)）
+    bool ChangeLinePoint(size_t LineTag, size_t PointTag, 
+        const Point3D& NewPoint);
 
     //删除一个Line3D
     bool DeleteLine(const Line3D& Line1);
     bool DeleteLine(const Point3D& Point1, const Point3D& Point2);
+    //按标签删除一个Line3D（交换-弹出，O(1)）
+    bool DeleteLineByTag(size_t LineTag);
+    //按标签批量删除Line3D（墓碑标记+一次压缩，O(N + n)），返回删除数
+    size_t DeleteLinesByTags(const std::vector<size_t>& LineTags);
     //运算符重载：模型移除Line3D
     Model3D& operator-=(const std::vector<Line3D>& vLines);
     //Getter
     Model3D operator-(const std::vector<Line3D>& vLines) const;
     //删除所有 Line3D
     void ClearLines();
+
+    //共享顶点修改
+
+    //按坐标移动一个顶点：含该点的全部Face3D、Line3D同时修改，
+    //O(顶点度数)；修改后与已有元素重复时失败，IsRepeatElement为true
+    bool MoveVertex(const Point3D& OldPoint, const Point3D& NewPoint,
+        bool& IsRepeatElement);
+    //Getter
+    //含该点的Face3D与Line3D总数（顶点度数），不是顶点时为0
+    size_t VertexValence(const Point3D& Point1) const;
     
     //Point3D增删改操作，Model3D基类不用（考虑派生更复杂的模型类）
 
@@ -141,6 +394,116 @@ public:
     //模型移除运算符重载
     Model3D& operator-=(const Model3D& Model1);
     Model3D operator-(const Model3D& Model1) const;
+    //容差顶点焊接（空间哈希，期望O(n)，并行），返回被焊接的顶点数
+    size_t WeldVertices(double Tolerance, 
+        size_t& RemovedFaceNum, size_t& RemovedLineNum);
+    //Getter：标记连通分量（并发并查集），返回分量数
+    size_t LabelComponents(std::vector<size_t>& FaceLabels,
+        std::vector<size_t>& LineLabels) const;
+    //Getter：按连通分量拆分为新模型（按分量编号顺序，命名为“原名_编号”）
+    std::vector<std::shared_ptr<Model3D>> SplitComponents() const;
+    //删除面数少于MinFaceNum或面积小于MinArea的连通分量，
+    //幸存元素保持原相对顺序，返回删除的分量数
+    size_t RemoveSmallComponents(size_t MinFaceNum, double MinArea,
+        size_t& RemovedFaceNum, size_t& RemovedLineNum);
+    //应用由面数、线数与本模型相同的基准得到的补丁；补丁与本模型
+    //不符（计数不等、标签越界或重复，移动与新增的元素点重合或与
+    //其他元素相同）时返回false且不修改模型
+    bool ApplyPatch(const ModelPatch3D& Patch);
+    //仿射变换：全部点乘以按行存放的4×4矩阵Matrix（末行须为0 0 0 1，
+    //线性部分须可逆；行列式为负时翻转各面顶点顺序，保持外法向）；
+    //矩阵不符或变换后有元素的点重合时返回false，模型不变
+    bool Transform(const std::array<double, 16>& Matrix);
+
+    //射线查询（Getter，首次查询或几何修改后惰性构建BVH）
+    //最近交点查询，方向无需单位化，Hit.T为交点到起点的距离
+    bool RayCast(const Point3D& Origin, const Vector3D<double>& Direction,
+        RayHit3D& Hit, 
+        double MaxDistance = std::numeric_limits<double>::infinity()) const;
+    //遮挡查询：起点沿方向MaxDistance距离内是否有面
+    bool RayOccluded(const Point3D& Origin, 
+        const Vector3D<double>& Direction, 
+        double MaxDistance = std::numeric_limits<double>::infinity()) const;
+    //批量最近交点查询，起点与方向数量不等时返回false
+    bool RayCastBatch(const std::vector<Coord3D>& Origins,
+        const std::vector<Coord3D>& Directions, std::vector<RayHit3D>& Hits,
+        double MaxDistance = std::numeric_limits<double>::infinity()) const;
+    //批量遮挡查询，起点与方向数量不等时返回false
+    bool RayOccludedBatch(const std::vector<Coord3D>& Origins,
+        const std::vector<Coord3D>& Directions, 
+        std::vector<uint8_t>& Results,
+        double MaxDistance = std::numeric_limits<double>::infinity()) const;
+    //批量点内外判定（Face3D须构成封闭网格）：Coordinates依次为各点的
+    //X、Y、Z，Mask第i / 64个字的第i % 64位为第i个点是否在内部；
+    //Coordinates的长度不是3的倍数时返回false
+    bool ContainsPoints(const std::vector<double>& Coordinates,
+        std::vector<uint64_t>& Mask) const;
+    //与另一模型的Face3D相交查询：FacePairs为有公共点的（本模型面标签，
+    //另一模型面标签），按标签升序；IsAnyHit为true时至多找出一对；
+    //返回是否相交
+    bool Intersects(const Model3D& Other, bool IsAnyHit,
+        std::vector<std::pair<size_t, size_t>>& FacePairs) const;
+    //到另一模型Face3D的单向表面距离：本模型各Face3D的去重顶点，
+    //加上每单位面积SampleDensity个面内采样点（确定性），求到另一
+    //模型表面的最近距离；任一距离超过ErrorBound时提前停止；
+    //任一模型无面时返回false
+    bool SurfaceDistanceTo(const Model3D& Other, double SampleDensity,
+        SurfaceDistance3D& Distance,
+        double ErrorBound = std::numeric_limits<double>::infinity()) const;
+
+    //网格索引与顶点查询（Getter，首次获取或几何修改后惰性重建）
+    //网格索引：去重顶点与各面、线的顶点下标
+    const MeshIndex3D& GetMeshIndex() const;
+    //顶点k-d树，查询结果为GetMeshIndex().Vertices中的下标
+    const KDTree3D& GetVertexTree() const;
+    //半边拓扑结构，顶点下标同GetMeshIndex().Vertices，面标签同Faces
+    const HalfEdgeMesh3D& GetHalfEdgeMesh() const;
+    //网格校验：退化面、重复面、非流形边、边界边与绕向一致性
+    void Validate(MeshReport3D& Report) const;
+    //质量属性（有向四面体并行补偿求和）
+    const MassProperties3D& GetMassProperties() const;
+    //有向包围盒（PCA初值+凸包细化）
+    const OrientedBox3D& GetOrientedBox() const;
+    //近似最小包围球（Ritter+最远点扩张）
+    const BoundingSphere3D& GetBoundingSphere() const;
+    //凸包模型（命名为“原名_hull”），顶点全部共面时返回nullptr
+    std::shared_ptr<Model3D> ConvexHull() const;
+    //QEM边塌缩简化模型（命名为“原名_simplified”，Line3D原样拷贝），
+    //面数不超过TargetFaceNum或下一次塌缩误差（距离平方）超过MaxError
+    //时停止；规模超出简化器的编号范围时返回nullptr
+    std::shared_ptr<Model3D> Decimate(size_t TargetFaceNum,
+        double MaxError = std::numeric_limits<double>::infinity()) const;
+    //用高度为Heights的水平平面切割各Face3D，Layers各层与Heights
+    //一一对应，返回全部层的交线段数
+    size_t Slice(const std::vector<double>& Heights,
+        std::vector<SliceLayer3D>& Layers) const;
+    //以边长VoxelSize体素化各Face3D到Grid，IsSolid为true时按奇偶规则
+    //填充内部；无面、边长不为正或单轴体素数超限时返回false
+    bool Voxelize(double VoxelSize, bool IsSolid, VoxelGrid3D& Grid) const;
+    //与修订版模型的结构差异：面、线按规范键（顶点坐标按Tolerance取整，
+    //不为正时精确比较）散列配对，Patch应用于本模型即得修订版；
+    //UnchangedFaceNum、UnchangedLineNum为未改动的面数、线数
+    void DiffTo(const Model3D& Revised, ModelPatch3D& Patch,
+        size_t& UnchangedFaceNum, size_t& UnchangedLineNum,
+        double Tolerance = 0.0) const;
+    //批量求各Face3D面积（下标即面标签，并行SIMD）
+    void GetFaceAreas(std::vector<double>& Areas) const;
+    //批量求各Line3D长度（下标即线标签，并行SIMD）
+    void GetLineLengths(std::vector<double>& Lengths) const;
+    //面法向与面积加权顶点法向（SoA缓冲区，面标签同Faces，
+    //顶点编号为缓冲区自有编号）
+    const NormalBuffer3D& GetNormals() const;
+    //校验增量维护的面积、长度总和与并行全量重算值之差
+    void VerifyMeasureSums(MeasureDrift3D& Drift) const;
+
+    //区域查询（Getter，首次查询或网格失效后惰性构建空间网格），
+    //结果为升序的面、线标签
+    //与包围盒（含边界）相交的Face3D与Line3D
+    void FindElementsInBox(const Point3D& MinPoint, const Point3D& MaxPoint,
+        std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const;
+    //与球（含边界）相交的Face3D与Line3D
+    void FindElementsInSphere(const Point3D& Center, double Radius,
+        std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const;
     
     //数据成员Getter
     //模型名
@@ -177,6 +540,18 @@ public:
     const double& EncaseCuboid_Area{m_rEncaseCuboid_Area};
     //最小包围长方体体积
     const double& EncaseCuboid_Volume{m_rEncaseCuboid_Volume};
+    //最小包围长方体最小角点坐标
+    const std::array<double, 3>& EncaseCuboid_Min{m_EncaseCuboid_Min};
+    //最小包围长方体最大角点坐标
+    const std::array<double, 3>& EncaseCuboid_Max{m_EncaseCuboid_Max};
+    //几何版本号（每次点、线、面几何修改后递增，供缓存判断失效）
+    const size_t& GeometryVersion{m_ullGeometryVersion};
+
+    //静态常量：退化面判定比例（两倍面积不超过最长边平方的该倍数）
+    static constexpr double DEGENERATE_RATIO{1e-12};
+    //静态常量：相似变换判定的相对容差（线性部分各列的内积矩阵与
+    //s²倍单位阵之差）
+    static constexpr double SIMILARITY_TOLERANCE{1e-14};
     
 private:
     //私有成员函数
@@ -191,6 +566,90 @@ private:
         const Point3D& Point1);
     //计算更新最小包围长方体
     void CalcEncaseCuboid();
+    //由角点设定最小包围长方体及其尺寸、面积与体积
+    void SetEncaseCuboid(const std::array<double, 3>& Min,
+        const std::array<double, 3>& Max);
+    //整体替换Face3D、Line3D列表，重算统计数据并通知几何整体变化
+    void ResetElements(std::vector<std::shared_ptr<Face3D>>&& NewFaces,
+        std::vector<std::shared_ptr<Line3D>>&& NewLines);
+    //判断元素是否有点位于最小包围长方体表面（删除后是否需重算）
+    bool IsOnEncaseCuboid(const FixedElements3D& Element) const;
+    //判断点是否位于最小包围长方体内（含表面）
+    bool IsInEncaseCuboid(const Point3D& Point1) const;
+    //几何修改通知：维护几何版本号、BVH、空间网格与法向缓冲区；
+    //顶点关联索引与空间网格相同：有效时随增、改、删增量维护，整体变化时失效
+    //添加了Face3D（BVH失效，网格、法向缓冲区有效时插入）
+    void OnFaceAdded();
+    //修改了指定标签的Face3D（BVH、网格、法向缓冲区有效时增量更新）
+    void OnFaceChanged(size_t FaceTag);
+    //交换-弹出删除了指定标签的Face3D（BVH有效时置墓碑，
+    //网格、法向缓冲区有效时删除）
+    void OnFaceRemoved(size_t FaceTag);
+    //Face3D整体变化（批量删除、清空、赋值等，BVH、网格与
+    //法向缓冲区失效）
+    void OnFacesReset();
+    //添加了Line3D（不影响面BVH，网格有效时插入）
+    void OnLineAdded();
+    //修改了指定标签的Line3D（网格有效时更新）
+    void OnLineChanged(size_t LineTag);
+    //交换-弹出删除了指定标签的Line3D（网格有效时删除）
+    void OnLineRemoved(size_t LineTag);
+    //Line3D整体变化（批量删除、清空等，网格失效）
+    void OnLinesReset();
+    //BVH是否与当前几何版本一致
+    bool IsFaceBVHFresh() const;
+    //获取与当前几何一致的BVH（必要时重建）
+    const BVH3D& GetFaceBVH() const;
+    //空间网格是否与当前几何版本一致
+    bool IsElementGridFresh() const;
+    //获取与当前几何一致的空间网格（必要时重建）
+    const SpatialGrid3D& GetElementGrid() const;
+    //法向缓冲区是否与当前几何版本一致（可能含待重算的脏面）
+    bool IsNormalBufferFresh() const;
+    //顶点关联索引是否与当前几何版本一致
+    bool IsVertexIncidenceFresh() const;
+    //获取与当前几何一致的顶点关联索引（必要时重建）
+    const VertexIncidence3D& GetVertexIncidence() const;
+    //指定标签Face3D的三角形坐标
+    Triangle3D GetFaceTriangle(size_t FaceTag) const;
+    //指定标签Line3D的线段坐标
+    Segment3D GetLineSegment(size_t LineTag) const;
+    //并行提取所有Face3D的三角形坐标，下标即面标签
+    std::vector<BVH3D::Triangle3D> ExtractFaceTriangles() const;
+    //并行提取所有Line3D的线段坐标，下标即线标签
+    std::vector<Segment3D> ExtractLineSegments() const;
+    //求标签在[First, Last)内Face3D的面积（Areas非空时写入），
+    //返回面积的补偿和
+    CompensatedSum MeasureFaces(size_t First, size_t Last,
+        double* Areas) const;
+    //求标签在[First, Last)内Line3D的长度（Lengths非空时写入），
+    //返回长度的补偿和
+    CompensatedSum MeasureLines(size_t First, size_t Last,
+        double* Lengths) const;
+    //按3×4矩阵Matrix变换标签在[First, Last)内的Face3D，新对象写入
+    //NewFaces（点重合时为nullptr），Bounds扩展到变换后的点；
+    //IsFlipped为true时交换后两个顶点；
+    //IsMeasured为true时返回变换后面积的补偿和
+    CompensatedSum TransformFaces(size_t First, size_t Last,
+        const double* Matrix, bool IsMeasured, bool IsFlipped,
+        std::vector<std::shared_ptr<Face3D>>& NewFaces,
+        std::array<Coord3D, 2>& Bounds) const;
+    //按3×4矩阵Matrix变换标签在[First, Last)内的Line3D，同上
+    CompensatedSum TransformLines(size_t First, size_t Last,
+        const double* Matrix, bool IsMeasured,
+        std::vector<std::shared_ptr<Line3D>>& NewLines,
+        std::array<Coord3D, 2>& Bounds) const;
+    //并行全量重算Face3D总面积（补偿求和）
+    CompensatedSum SumFaceAreas() const;
+    //并行全量重算Line3D总长度（补偿求和）
+    CompensatedSum SumLineLengths() const;
+    //向面积累加器加减一个面积并更新总面积
+    void AccumulateFaceArea(double Area);
+    //向长度累加器加减一个长度并更新总长度
+    void AccumulateLineLength(double Length);
+    //并行单位化射线方向（零向量保持为零）
+    static std::vector<Coord3D> NormalizeDirections(
+        const std::vector<Coord3D>& Directions);
 
     //私有数据成员
     //模型名，默认为"NONE"
@@ -217,6 +676,10 @@ private:
     double m_rFaceArea_Sum{0};
     //Line3D总长度
     double m_rLineLength_Sum{0};
+    //Face3D总面积的补偿累加器（m_rFaceArea_Sum为其取值）
+    CompensatedSum m_FaceAreaAccumulator{};
+    //Line3D总长度的补偿累加器（m_rLineLength_Sum为其取值）
+    CompensatedSum m_LineLengthAccumulator{};
     //最小包围长方体X边长度
     double m_rEncaseCuboid_Length{0};
     //最小包围长方体Y边长度
@@ -227,6 +690,52 @@ private:
     double m_rEncaseCuboid_Area{0};
     //最小包围长方体体积
     double m_rEncaseCuboid_Volume{0};
+    //最小包围长方体最小角点坐标
+    std::array<double, 3> m_EncaseCuboid_Min{{0.0, 0.0, 0.0}};
+    //最小包围长方体最大角点坐标
+    std::array<double, 3> m_EncaseCuboid_Max{{0.0, 0.0, 0.0}};
+    //几何版本号
+    size_t m_ullGeometryVersion{0};
+    //面BVH缓存（惰性构建，const查询中可重建）
+    mutable std::shared_ptr<BVH3D> m_pFaceBVH{nullptr};
+    //面BVH对应的几何版本号
+    mutable size_t m_ullFaceBVHVersion{0};
+    //网格索引缓存
+    mutable std::shared_ptr<MeshIndex3D> m_pMeshIndex{nullptr};
+    //网格索引对应的几何版本号
+    mutable size_t m_ullMeshIndexVersion{0};
+    //顶点k-d树缓存
+    mutable std::shared_ptr<KDTree3D> m_pVertexTree{nullptr};
+    //顶点k-d树对应的几何版本号
+    mutable size_t m_ullVertexTreeVersion{0};
+    //元素空间网格缓存
+    mutable std::shared_ptr<SpatialGrid3D> m_pElementGrid{nullptr};
+    //元素空间网格对应的几何版本号
+    mutable size_t m_ullElementGridVersion{0};
+    //半边拓扑结构缓存
+    mutable std::shared_ptr<HalfEdgeMesh3D> m_pHalfEdgeMesh{nullptr};
+    //半边拓扑结构对应的几何版本号
+    mutable size_t m_ullHalfEdgeMeshVersion{0};
+    //质量属性缓存
+    mutable std::shared_ptr<MassProperties3D> m_pMassProperties{nullptr};
+    //质量属性对应的几何版本号
+    mutable size_t m_ullMassPropertiesVersion{0};
+    //有向包围盒缓存
+    mutable std::shared_ptr<OrientedBox3D> m_pOrientedBox{nullptr};
+    //有向包围盒对应的几何版本号
+    mutable size_t m_ullOrientedBoxVersion{0};
+    //包围球缓存
+    mutable std::shared_ptr<BoundingSphere3D> m_pBoundingSphere{nullptr};
+    //包围球对应的几何版本号
+    mutable size_t m_ullBoundingSphereVersion{0};
+    //法向缓冲区缓存
+    mutable std::shared_ptr<NormalBuffer3D> m_pNormalBuffer{nullptr};
+    //法向缓冲区对应的几何版本号
+    mutable size_t m_ullNormalBufferVersion{0};
+    //顶点关联索引缓存
+    mutable std::shared_ptr<VertexIncidence3D> m_pVertexIncidence{nullptr};
+    //顶点关联索引对应的几何版本号
+    mutable size_t m_ullVertexIncidenceVersion{0};
 };
 
 #endif /* MODEL3D_HPP */
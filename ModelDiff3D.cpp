@@ -0,0 +1,378 @@
+/*************************************************************************
+【文件名】                 ModelDiff3D.cpp
+【功能模块和目的】          模型结构差异（面、线的增删与移动）类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加重合元素检查
+*************************************************************************/
+
+//自身类头文件
+#include "ModelDiff3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::llround所属头文件
+#include <cmath>
+//std::memcpy所属头文件
+#include <cstring>
+//std::sort所属头文件
+#include <algorithm>
+//SIZE_MAX所属头文件
+#include <cstdint>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Compare
+【函数功能】        比较基准与修订版的面、线，分别按规范键配对，
+                   得到由基准得到修订版的补丁
+【参数】            const std::vector<Triangle3D>& BaseFaces：基准面
+                   const std::vector<Segment3D>& BaseLines：基准线
+                   const std::vector<Triangle3D>& RevisedFaces：修订版面
+                   const std::vector<Segment3D>& RevisedLines：修订版线
+                   double Tolerance：坐标取整容差，不为正时精确比较
+                   ModelPatch3D& Patch：补丁（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void ModelDiff3D::Compare(const std::vector<Triangle3D>& BaseFaces,
+    const std::vector<Segment3D>& BaseLines,
+    const std::vector<Triangle3D>& RevisedFaces,
+    const std::vector<Segment3D>& RevisedLines,
+    double Tolerance, ModelPatch3D& Patch){
+    Patch = ModelPatch3D{};
+    Patch.BaseFaceNum = BaseFaces.size();
+    Patch.BaseLineNum = BaseLines.size();
+    m_ullUnchangedFaceNum = Match(BaseFaces, RevisedFaces, Tolerance,
+        Patch.RemovedFaceTags, Patch.MovedFaces, Patch.AddedFaces);
+    m_ullUnchangedLineNum = Match(BaseLines, RevisedLines, Tolerance,
+        Patch.RemovedLineTags, Patch.MovedLines, Patch.AddedLines);
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        UnchangedFaceNum
+【函数功能】        获取上次比较中未改动的面数
+【参数】            无
+【返回值】          size_t，未改动的面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t ModelDiff3D::UnchangedFaceNum() const{
+    return m_ullUnchangedFaceNum;
+}
+
+/*************************************************************************
+【函数名称】        UnchangedLineNum
+【函数功能】        获取上次比较中未改动的线数
+【参数】            无
+【返回值】          size_t，未改动的线数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t ModelDiff3D::UnchangedLineNum() const{
+    return m_ullUnchangedLineNum;
+}
+
+/*************************************************************************
+【函数名称】        HasRepeat
+【函数功能】        检查面列表中新面的点重合与面重合（坐标精确比较）
+【参数】            const std::vector<Triangle3D>& Faces：面列表
+                   size_t FirstNew：新面的起始下标，之前的面之间不比较
+【返回值】          bool，有新面点重合或与其他面相同返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ModelDiff3D::HasRepeat(const std::vector<Triangle3D>& Faces,
+    size_t FirstNew){
+    return FindRepeat(Faces, FirstNew);
+}
+
+/*************************************************************************
+【函数名称】        HasRepeat
+【函数功能】        检查线列表中新线的点重合与线重合（坐标精确比较）
+【参数】            const std::vector<Segment3D>& Lines：线列表
+                   size_t FirstNew：新线的起始下标，之前的线之间不比较
+【返回值】          bool，有新线点重合或与其他线相同返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ModelDiff3D::HasRepeat(const std::vector<Segment3D>& Lines,
+    size_t FirstNew){
+    return FindRepeat(Lines, FirstNew);
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        Match
+【函数功能】        按规范键配对：并行求两侧元素的规范键与散列值；基准
+                   元素放入开放寻址表（键相同的各占一格），修订版元素
+                   依次查表，取第一个键相同且尚未配对的基准元素；
+                   未配对的修订版元素再按“去掉一个顶点”的N个子键放入
+                   第二张表，未配对的基准元素按标签顺序以各自的子键查表，
+                   取第一个尚未被取走的修订版元素作为移动，查不到的为
+                   删除；最后仍未被取走的修订版元素为新增
+【参数】            const std::vector<std::array<Coord3D, N>>& Base：
+                   基准元素
+                   const std::vector<std::array<Coord3D, N>>& Revised：
+                   修订版元素
+                   double Tolerance：坐标取整容差
+                   std::vector<size_t>& Removed：删除的基准下标（追加，升序）
+                   std::vector<std::pair<size_t, std::array<Coord3D, N>>>&
+                   Moved：移动的（基准下标，修订版坐标）（追加，升序）
+                   std::vector<std::array<Coord3D, N>>& Added：
+                   新增的修订版坐标（追加，按修订版顺序）
+【返回值】          size_t，未改动的元素数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<size_t N>
+size_t ModelDiff3D::Match(const std::vector<std::array<Coord3D, N>>& Base,
+    const std::vector<std::array<Coord3D, N>>& Revised, double Tolerance,
+    std::vector<size_t>& Removed,
+    std::vector<std::pair<size_t, std::array<Coord3D, N>>>& Moved,
+    std::vector<std::array<Coord3D, N>>& Added){
+    //规范键：各顶点键排序后连接
+    using Key = std::array<int64_t, 3 * N>;
+    //子键：规范键去掉一个顶点
+    using SubKey = std::array<int64_t, 3 * (N - 1)>;
+    auto Drop = [](const Key& Full, size_t Vertex){
+        SubKey Sub;
+        size_t Position = 0;
+        for (size_t v = 0; v < N; v++) {
+            if (v == Vertex) {
+                continue;
+            }
+            for (size_t k = 0; k < 3; k++) {
+                Sub[Position++] = Full[3 * v + k];
+            }
+        }
+        return Sub;
+    };
+    std::vector<Key> BaseKeys;
+    std::vector<uint64_t> BaseHashes;
+    MakeKeys(Base, Tolerance, BaseKeys, BaseHashes);
+    std::vector<Key> RevisedKeys;
+    std::vector<uint64_t> RevisedHashes;
+    MakeKeys(Revised, Tolerance, RevisedKeys, RevisedHashes);
+    //按规范键配对
+    std::vector<size_t> Table;
+    size_t Mask = BuildTable(BaseHashes, Table);
+    std::vector<uint8_t> IsBaseMatched(Base.size(), 0);
+    //未配对的修订版元素
+    std::vector<size_t> Unmatched;
+    for (size_t j = 0; j < Revised.size(); j++) {
+        bool IsMatched = false;
+        for (size_t Slot = RevisedHashes[j] & Mask; Table[Slot] != SIZE_MAX;
+            Slot = (Slot + 1) & Mask) {
+            size_t i = Table[Slot];
+            if (IsBaseMatched[i] == 0 && BaseKeys[i] == RevisedKeys[j]) {
+                IsBaseMatched[i] = 1;
+                IsMatched = true;
+                break;
+            }
+        }
+        if (!IsMatched) {
+            Unmatched.push_back(j);
+        }
+    }
+    //未配对的修订版元素按子键建表，第n个元素的第v个子键下标为n × N + v
+    std::vector<SubKey> SubKeys(Unmatched.size() * N);
+    std::vector<uint64_t> SubHashes(SubKeys.size());
+    for (size_t n = 0; n < Unmatched.size(); n++) {
+        for (size_t v = 0; v < N; v++) {
+            SubKeys[n * N + v] = Drop(RevisedKeys[Unmatched[n]], v);
+            SubHashes[n * N + v] = HashKey(
+                SubKeys[n * N + v].data(), SubKeys[n * N + v].size());
+        }
+    }
+    Mask = BuildTable(SubHashes, Table);
+    std::vector<uint8_t> IsTaken(Unmatched.size(), 0);
+    for (size_t i = 0; i < Base.size(); i++) {
+        if (IsBaseMatched[i] != 0) {
+            continue;
+        }
+        bool IsMoved = false;
+        for (size_t v = 0; v < N && !IsMoved; v++) {
+            SubKey Sub = Drop(BaseKeys[i], v);
+            for (size_t Slot = HashKey(Sub.data(), Sub.size()) & Mask;
+                Table[Slot] != SIZE_MAX; Slot = (Slot + 1) & Mask) {
+                size_t n = Table[Slot] / N;
+                if (IsTaken[n] == 0 && SubKeys[Table[Slot]] == Sub) {
+                    IsTaken[n] = 1;
+                    Moved.emplace_back(i, Revised[Unmatched[n]]);
+                    IsMoved = true;
+                    break;
+                }
+            }
+        }
+        if (!IsMoved) {
+            Removed.push_back(i);
+        }
+    }
+    for (size_t n = 0; n < Unmatched.size(); n++) {
+        if (IsTaken[n] == 0) {
+            Added.push_back(Revised[Unmatched[n]]);
+        }
+    }
+    return Revised.size() - Unmatched.size();
+}
+
+/*************************************************************************
+【函数名称】        MakeKeys
+【函数功能】        并行求各元素的规范键：各顶点键排序后连接，及其散列值
+【参数】            const std::vector<std::array<Coord3D, N>>& Elements：
+                   元素
+                   double Tolerance：坐标取整容差
+                   std::vector<std::array<int64_t, 3 * N>>& Keys：
+                   规范键（会被重写）
+                   std::vector<uint64_t>& Hashes：散列值（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<size_t N>
+void ModelDiff3D::MakeKeys(const std::vector<std::array<Coord3D, N>>& Elements,
+    double Tolerance, std::vector<std::array<int64_t, 3 * N>>& Keys,
+    std::vector<uint64_t>& Hashes){
+    Keys.resize(Elements.size());
+    Hashes.resize(Elements.size());
+    Parallel::For(0, Elements.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            std::array<VertexKey, N> Vertices;
+            for (size_t v = 0; v < N; v++) {
+                Vertices[v] = MakeVertexKey(Elements[i][v], Tolerance);
+            }
+            std::sort(Vertices.begin(), Vertices.end());
+            for (size_t v = 0; v < N; v++) {
+                for (size_t k = 0; k < 3; k++) {
+                    Keys[i][3 * v + k] = Vertices[v][k];
+                }
+            }
+            Hashes[i] = HashKey(Keys[i].data(), Keys[i].size());
+        }
+    });
+}
+
+/*************************************************************************
+【函数名称】        FindRepeat
+【函数功能】        求精确规范键（容差为0，与Point3D的相等判断一致）；
+                   新元素的规范键中相邻顶点键相同即点重合；全部元素
+                   放入开放寻址表，新元素逐个查表，遇到键相同的其他
+                   元素即重合；整体期望O(n)
+【参数】            const std::vector<std::array<Coord3D, N>>& Elements：
+                   元素
+                   size_t FirstNew：新元素的起始下标
+【返回值】          bool，有新元素点重合或与其他元素相同返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<size_t N>
+bool ModelDiff3D::FindRepeat(
+    const std::vector<std::array<Coord3D, N>>& Elements, size_t FirstNew){
+    if (FirstNew >= Elements.size()) {
+        return false;
+    }
+    std::vector<std::array<int64_t, 3 * N>> Keys;
+    std::vector<uint64_t> Hashes;
+    MakeKeys(Elements, 0.0, Keys, Hashes);
+    //点重合：排序后相邻顶点键相同
+    for (size_t i = FirstNew; i < Elements.size(); i++) {
+        for (size_t v = 1; v < N; v++) {
+            if (std::equal(Keys[i].begin() + 3 * (v - 1),
+                Keys[i].begin() + 3 * v, Keys[i].begin() + 3 * v)) {
+                return true;
+            }
+        }
+    }
+    //元素重合
+    std::vector<size_t> Table;
+    size_t Mask = BuildTable(Hashes, Table);
+    for (size_t i = FirstNew; i < Elements.size(); i++) {
+        for (size_t Slot = Hashes[i] & Mask; Table[Slot] != SIZE_MAX;
+            Slot = (Slot + 1) & Mask) {
+            size_t j = Table[Slot];
+            if (j != i && Keys[j] == Keys[i]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*************************************************************************
+【函数名称】        MakeVertexKey
+【函数功能】        坐标取整为顶点键：容差为正时各分量取最接近的容差整数
+                   倍（相距不足半个容差的坐标通常得到相同的键）；否则取
+                   各分量的位模式，-0.0先规整为0.0，使与相等比较一致
+【参数】            const Coord3D& Point：坐标
+                   double Tolerance：容差
+【返回值】          VertexKey，顶点键
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+ModelDiff3D::VertexKey ModelDiff3D::MakeVertexKey(const Coord3D& Point,
+    double Tolerance){
+    VertexKey Result;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        if (Tolerance > 0.0) {
+            Result[Axis] = static_cast<int64_t>(
+                std::llround(Point[Axis] / Tolerance));
+        }
+        else {
+            double Value = Point[Axis] == 0.0 ? 0.0 : Point[Axis];
+            std::memcpy(&Result[Axis], &Value, sizeof(Value));
+        }
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        HashKey
+【函数功能】        键的散列值：逐个分量混入后做splitmix64终混
+【参数】            const int64_t* Key：键的各分量
+                   size_t Length：分量数
+【返回值】          uint64_t，散列值
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+uint64_t ModelDiff3D::HashKey(const int64_t* Key, size_t Length){
+    uint64_t Hash = 0;
+    for (size_t i = 0; i < Length; i++) {
+        Hash = (Hash ^ static_cast<uint64_t>(Key[i])) * 0x9E3779B97F4A7C15ULL;
+        Hash ^= Hash >> 32;
+    }
+    Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBULL;
+    return Hash ^ (Hash >> 31);
+}
+
+/*************************************************************************
+【函数名称】        BuildTable
+【函数功能】        按散列值建立线性探测的开放寻址表：容量为不小于两倍
+                   元素数的2的幂，各元素下标依次放入自散列位置起的
+                   第一个空位
+【参数】            const std::vector<uint64_t>& Hashes：各元素散列值
+                   std::vector<size_t>& Table：表（会被重写）
+【返回值】          size_t，下标掩码（容量减1）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t ModelDiff3D::BuildTable(const std::vector<uint64_t>& Hashes,
+    std::vector<size_t>& Table){
+    size_t Capacity = 16;
+    while (Capacity < 2 * Hashes.size()) {
+        Capacity *= 2;
+    }
+    Table.assign(Capacity, SIZE_MAX);
+    const size_t Mask = Capacity - 1;
+    for (size_t i = 0; i < Hashes.size(); i++) {
+        size_t Slot = Hashes[i] & Mask;
+        while (Table[Slot] != SIZE_MAX) {
+            Slot = (Slot + 1) & Mask;
+        }
+        Table[Slot] = i;
+    }
+    return Mask;
+}
@@ -0,0 +1,139 @@
+/*************************************************************************
+【文件名】                 ModelDiff3D.hpp
+【功能模块和目的】          模型结构差异（面、线的增删与移动）与补丁类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef MODELDIFF3D_HPP
+#define MODELDIFF3D_HPP
+
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//int64_t、uint64_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::pair所属头文件
+#include <utility>
+
+/*************************************************************************
+【类名】             ModelPatch3D
+【功能】             模型补丁：由基准模型得到修订版模型所需的面、线改动
+【接口说明】         数据类，成员公开；标签均为基准模型中的标签（升序）；
+                    应用顺序：移动的元素原位改为新坐标，删除的元素被
+                    移除（幸存元素保持原相对顺序），新增的元素依次追加
+                    到末尾；基准面数、线数用于应用前校验
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class ModelPatch3D{
+public:
+    //基准模型的面数
+    size_t BaseFaceNum;
+    //基准模型的线数
+    size_t BaseLineNum;
+    //删除的面标签
+    std::vector<size_t> RemovedFaceTags;
+    //删除的线标签
+    std::vector<size_t> RemovedLineTags;
+    //移动的面：面标签与新坐标
+    std::vector<std::pair<size_t, Triangle3D>> MovedFaces;
+    //移动的线：线标签与新坐标
+    std::vector<std::pair<size_t, Segment3D>> MovedLines;
+    //新增的面
+    std::vector<Triangle3D> AddedFaces;
+    //新增的线
+    std::vector<Segment3D> AddedLines;
+};
+
+/*************************************************************************
+【类名】             ModelDiff3D
+【功能】             比较基准与修订版的面、线集合，得到结构差异补丁
+【接口说明】         顶点坐标按容差取整（容差不为正时取坐标本身，±0视为
+                    相同）得到顶点键，元素各顶点键排序后连接为规范键，
+                    与顶点顺序无关（同Face3D、Line3D的相等判断）；
+                    基准元素按规范键的散列值放入开放寻址表，修订版元素
+                    逐个查表配对（键相同的元素按个数一一配对），
+                    整体期望O(n + m)；未配对的元素中，只差一个顶点（其余
+                    顶点的键相同）的基准元素与修订版元素配为“移动”，
+                    其余为删除或新增；规范键并行计算，配对按标签顺序
+                    进行，结果可重复；另提供按精确规范键检查元素列表中
+                    重合元素的静态函数，供应用补丁前校验
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加重合元素检查
+*************************************************************************/
+class ModelDiff3D{
+public:
+    //默认构造函数，无比较结果
+    ModelDiff3D() = default;
+    //拷贝构造函数
+    ModelDiff3D(const ModelDiff3D& Source) = default;
+    //虚析构函数
+    virtual ~ModelDiff3D() = default;
+    //赋值运算符
+    ModelDiff3D& operator=(const ModelDiff3D& Source) = default;
+
+    //Setter
+    //比较基准与修订版的面、线，Patch为由基准得到修订版的补丁
+    void Compare(const std::vector<Triangle3D>& BaseFaces,
+        const std::vector<Segment3D>& BaseLines,
+        const std::vector<Triangle3D>& RevisedFaces,
+        const std::vector<Segment3D>& RevisedLines,
+        double Tolerance, ModelPatch3D& Patch);
+
+    //Getter
+    //上次比较中未改动的面数
+    size_t UnchangedFaceNum() const;
+    //上次比较中未改动的线数
+    size_t UnchangedLineNum() const;
+    //静态函数：下标不小于FirstNew的面中有点重合的，或与列表中其他面
+    //坐标完全相同（与顶点顺序无关）的，返回true
+    static bool HasRepeat(const std::vector<Triangle3D>& Faces,
+        size_t FirstNew);
+    //静态函数：下标不小于FirstNew的线中有点重合的，或与列表中其他线
+    //坐标完全相同（与顶点顺序无关）的，返回true
+    static bool HasRepeat(const std::vector<Segment3D>& Lines,
+        size_t FirstNew);
+
+private:
+    //顶点键
+    using VertexKey = std::array<int64_t, 3>;
+
+    //按规范键配对N个顶点的元素：Removed为删除的基准下标，Moved为
+    //移动的（基准下标，修订版坐标），Added为新增的修订版坐标，
+    //返回未改动的元素数
+    template<size_t N>
+    static size_t Match(const std::vector<std::array<Coord3D, N>>& Base,
+        const std::vector<std::array<Coord3D, N>>& Revised, double Tolerance,
+        std::vector<size_t>& Removed,
+        std::vector<std::pair<size_t, std::array<Coord3D, N>>>& Moved,
+        std::vector<std::array<Coord3D, N>>& Added);
+    //并行求N个顶点的元素的规范键（各顶点键排序后连接）与散列值
+    template<size_t N>
+    static void MakeKeys(const std::vector<std::array<Coord3D, N>>& Elements,
+        double Tolerance, std::vector<std::array<int64_t, 3 * N>>& Keys,
+        std::vector<uint64_t>& Hashes);
+    //检查N个顶点的元素的点重合与元素重合，同HasRepeat
+    template<size_t N>
+    static bool FindRepeat(const std::vector<std::array<Coord3D, N>>& Elements,
+        size_t FirstNew);
+    //坐标取整为顶点键
+    static VertexKey MakeVertexKey(const Coord3D& Point, double Tolerance);
+    //键的散列值
+    static uint64_t HashKey(const int64_t* Key, size_t Length);
+    //按散列值建立开放寻址表（空位为SIZE_MAX），返回下标掩码
+    static size_t BuildTable(const std::vector<uint64_t>& Hashes,
+        std::vector<size_t>& Table);
+
+    //上次比较中未改动的面数
+    size_t m_ullUnchangedFaceNum{0};
+    //上次比较中未改动的线数
+    size_t m_ullUnchangedLineNum{0};
+};
+
+#endif //MODELDIFF3D_HPP
@@ -0,0 +1,173 @@
+/*************************************************************************
+【文件名】                 ModelLOD3D.cpp
+【功能模块和目的】          模型多细节层次（LOD）链类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "ModelLOD3D.hpp"
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//MeshDecimator3D类所属头文件
+#include "MeshDecimator3D.hpp"
+//std::ceil所属头文件
+#include <cmath>
+//std::move所属头文件
+#include <utility>
+//std::chrono::seconds所属头文件
+#include <chrono>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Start
+【函数功能】        在调用线程取模型当前几何的快照，并启动后台构建；
+                   之前的后台任务（若仍在运行）先等待其结束再被替换
+【参数】            const Model3D& Source：源模型
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void ModelLOD3D::Start(const Model3D& Source){
+    const MeshIndex3D& Index = Source.GetMeshIndex();
+    std::vector<Segment3D> Segments(Index.LineVertices.size());
+    for (size_t i = 0; i < Segments.size(); i++) {
+        Segments[i] = {{Index.Vertices[Index.LineVertices[i][0]],
+            Index.Vertices[Index.LineVertices[i][1]]}};
+    }
+    m_Levels.clear();
+    m_Pending = std::async(std::launch::async, &ModelLOD3D::Build,
+        Source.Name, Index.Vertices, Index.FaceVertices,
+        std::move(Segments));
+    m_bHasSource = true;
+    m_ullSourceVersion = Source.GeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        Adopt
+【函数功能】        直接采用已有的各层（如与模型一同从文件读入），
+                   视为与模型当前几何一致
+【参数】            const Model3D& Source：源模型
+                   std::vector<std::shared_ptr<const Model3D>>&& Levels：
+                   第1层起的各层
+【返回值】          bool，层数为LEVEL_NUM - 1时采用并返回true，
+                   否则不变并返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ModelLOD3D::Adopt(const Model3D& Source,
+    std::vector<std::shared_ptr<const Model3D>>&& Levels){
+    if (Levels.size() != LEVEL_NUM - 1) {
+        return false;
+    }
+    if (m_Pending.valid()) {
+        m_Pending.wait();
+        m_Pending = {};
+    }
+    m_Levels = std::move(Levels);
+    m_bHasSource = true;
+    m_ullSourceVersion = Source.GeometryVersion;
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        GetLevel
+【函数功能】        获取指定层，后台仍在构建时等待其完成
+【参数】            size_t Level：层号（1 ≤ Level < LEVEL_NUM）
+【返回值】          std::shared_ptr<const Model3D>，该层模型；层号越界、
+                   尚未开始构建或模型规模超出简化器范围时为nullptr
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::shared_ptr<const Model3D> ModelLOD3D::GetLevel(size_t Level){
+    if (m_Pending.valid()) {
+        m_Pending.wait();
+    }
+    Collect();
+    if (Level == 0 || Level > m_Levels.size()) {
+        return nullptr;
+    }
+    return m_Levels[Level - 1];
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        IsFresh
+【函数功能】        判断是否已由模型当前几何开始构建或采用
+【参数】            const Model3D& Source：源模型
+【返回值】          bool，几何版本号一致返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ModelLOD3D::IsFresh(const Model3D& Source) const{
+    return m_bHasSource && m_ullSourceVersion == Source.GeometryVersion;
+}
+
+/*************************************************************************
+【函数名称】        IsReady
+【函数功能】        判断各层是否可立即获取
+【参数】            无
+【返回值】          bool，后台构建已完成或已采用返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool ModelLOD3D::IsReady() const{
+    if (m_Pending.valid()) {
+        return m_Pending.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+    }
+    return m_bHasSource;
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        后台构建：快照载入简化器后，按LEVEL_RATIOS逐级继续
+                   简化，每级导出一次并创建只读模型（命名为“原名_lodK”）
+【参数】            std::string Name：源模型名
+                   std::vector<Coord3D> Vertices：去重顶点坐标
+                   std::vector<std::array<size_t, 3>> Faces：面顶点下标
+                   std::vector<Segment3D> Segments：线段坐标（各层原样保留）
+【返回值】          std::vector<std::shared_ptr<const Model3D>>，第1层起的
+                   各层；规模超出简化器范围时为空
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+std::vector<std::shared_ptr<const Model3D>> ModelLOD3D::Build(
+    std::string Name, std::vector<Coord3D> Vertices,
+    std::vector<std::array<size_t, 3>> Faces,
+    std::vector<Segment3D> Segments){
+    std::vector<std::shared_ptr<const Model3D>> Levels;
+    MeshDecimator3D Decimator;
+    if (!Decimator.Load(Vertices, Faces)) {
+        return Levels;
+    }
+    const double FaceCount = static_cast<double>(Faces.size());
+    for (size_t Level = 1; Level < LEVEL_NUM; Level++) {
+        Decimator.Simplify(static_cast<size_t>(
+            std::ceil(LEVEL_RATIOS[Level] * FaceCount)));
+        Decimator.Extract(Vertices, Faces);
+        Levels.push_back(Model3D::FromMesh(
+            Name + "_lod" + std::to_string(Level), Vertices, Faces,
+            Segments));
+    }
+    return Levels;
+}
+
+/*************************************************************************
+【函数名称】        Collect
+【函数功能】        后台构建已完成时取回结果，未完成时不等待
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void ModelLOD3D::Collect(){
+    if (m_Pending.valid() && m_Pending.wait_for(std::chrono::seconds(0))
+        == std::future_status::ready) {
+        m_Levels = m_Pending.get();
+    }
+}
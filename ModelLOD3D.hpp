@@ -0,0 +1,95 @@
+/*************************************************************************
+【文件名】                 ModelLOD3D.hpp
+【功能模块和目的】          模型多细节层次（LOD）链类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef MODELLOD3D_HPP
+#define MODELLOD3D_HPP
+
+//Model3D类所属头文件
+#include "Model3D.hpp"
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::shared_ptr所属头文件
+#include <memory>
+//std::string所属头文件
+#include <string>
+//std::future所属头文件
+#include <future>
+
+/*************************************************************************
+【类名】             ModelLOD3D
+【功能】             一个模型的多细节层次链：按LEVEL_RATIOS的面数比例
+                    逐级简化得到的只读模型
+【接口说明】         Start时在调用线程取模型当前几何的快照（去重顶点、
+                    面顶点下标与线段坐标），之后在后台线程用同一个
+                    MeshDecimator3D逐级继续简化（后一层在前一层的基础上
+                    简化，总工作量与单次简化相当），调用方不必等待；
+                    记录快照时模型的几何版本号，模型修改后即不再新鲜；
+                    获取某层时若后台仍在构建则等待其完成；
+                    第0层为源模型本身，不在本类中保存；
+                    各层也可由外部（如从文件读入）直接采用
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class ModelLOD3D{
+public:
+    //默认构造函数，无层级
+    ModelLOD3D() = default;
+    //无拷贝构造函数（持有后台任务）
+    ModelLOD3D(const ModelLOD3D& Source) = delete;
+    //虚析构函数（等待后台任务结束）
+    virtual ~ModelLOD3D() = default;
+    //无赋值运算符
+    ModelLOD3D& operator=(const ModelLOD3D& Source) = delete;
+
+    //Setter
+    //取模型当前几何的快照，在后台线程构建第1层起的各层（替换已有层级）
+    void Start(const Model3D& Source);
+    //直接采用已有的第1层起的各层，视为与模型当前几何一致；
+    //层数不等于LEVEL_NUM - 1时返回false
+    bool Adopt(const Model3D& Source,
+        std::vector<std::shared_ptr<const Model3D>>&& Levels);
+    //获取第Level层（1 ≤ Level < LEVEL_NUM），后台仍在构建时等待
+    std::shared_ptr<const Model3D> GetLevel(size_t Level);
+
+    //Getter
+    //是否已由模型当前几何开始构建或采用
+    bool IsFresh(const Model3D& Source) const;
+    //各层是否已可立即获取（无需等待）
+    bool IsReady() const;
+
+    //静态常量：层数（含第0层源模型）
+    static constexpr size_t LEVEL_NUM{4};
+    //静态常量：各层面数相对源模型的比例
+    static constexpr std::array<double, LEVEL_NUM> LEVEL_RATIOS{
+        {1.0, 0.25, 0.06, 0.015}};
+
+private:
+    //后台构建：由快照逐级简化，返回第1层起的各层
+    static std::vector<std::shared_ptr<const Model3D>> Build(
+        std::string Name, std::vector<Coord3D> Vertices,
+        std::vector<std::array<size_t, 3>> Faces,
+        std::vector<Segment3D> Segments);
+    //后台构建已完成时取回结果
+    void Collect();
+
+    //是否已开始构建或采用
+    bool m_bHasSource{false};
+    //快照时模型的几何版本号
+    size_t m_ullSourceVersion{0};
+    //后台构建任务
+    std::future<std::vector<std::shared_ptr<const Model3D>>> m_Pending{};
+    //第1层起的各层
+    std::vector<std::shared_ptr<const Model3D>> m_Levels{};
+};
+
+#endif //MODELLOD3D_HPP
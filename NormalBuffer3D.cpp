@@ -0,0 +1,618 @@
+/*************************************************************************
+【文件名】                 NormalBuffer3D.cpp
+【功能模块和目的】          面法向与顶点法向缓冲区类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "NormalBuffer3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::sqrt所属头文件
+#include <cmath>
+//std::memcpy所属头文件
+#include <cstring>
+//std::min、std::find所属头文件
+#include <algorithm>
+
+/*************************************************************************
+【函数名称】        NormalBuffer3D
+【函数功能】        拷贝构造函数
+【参数】            const NormalBuffer3D& Source：另一个NormalBuffer3D对象
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+NormalBuffer3D::NormalBuffer3D(const NormalBuffer3D& Source)
+    : m_FaceNormalX(Source.m_FaceNormalX),
+    m_FaceNormalY(Source.m_FaceNormalY),
+    m_FaceNormalZ(Source.m_FaceNormalZ),
+    m_FaceArea(Source.m_FaceArea),
+    m_VertexNormalX(Source.m_VertexNormalX),
+    m_VertexNormalY(Source.m_VertexNormalY),
+    m_VertexNormalZ(Source.m_VertexNormalZ),
+    m_VertexX(Source.m_VertexX),
+    m_VertexY(Source.m_VertexY),
+    m_VertexZ(Source.m_VertexZ),
+    m_FaceVertices(Source.m_FaceVertices),
+    m_VertexFaces(Source.m_VertexFaces),
+    m_ullSortedNum(Source.m_ullSortedNum),
+    m_VertexMap(Source.m_VertexMap),
+    m_ullIsolatedNum(Source.m_ullIsolatedNum),
+    m_DirtyFaces(Source.m_DirtyFaces),
+    m_FaceDirty(Source.m_FaceDirty),
+    m_DirtyVertices(Source.m_DirtyVertices),
+    m_VertexDirty(Source.m_VertexDirty){
+}
+
+/*************************************************************************
+【函数名称】        operator=
+【函数功能】        赋值运算符
+【参数】            const NormalBuffer3D& Source：另一个NormalBuffer3D对象
+【返回值】          当前NormalBuffer3D对象的引用
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+NormalBuffer3D& NormalBuffer3D::operator=(const NormalBuffer3D& Source){
+    if (this != &Source) {
+        m_FaceNormalX = Source.m_FaceNormalX;
+        m_FaceNormalY = Source.m_FaceNormalY;
+        m_FaceNormalZ = Source.m_FaceNormalZ;
+        m_FaceArea = Source.m_FaceArea;
+        m_VertexNormalX = Source.m_VertexNormalX;
+        m_VertexNormalY = Source.m_VertexNormalY;
+        m_VertexNormalZ = Source.m_VertexNormalZ;
+        m_VertexX = Source.m_VertexX;
+        m_VertexY = Source.m_VertexY;
+        m_VertexZ = Source.m_VertexZ;
+        m_FaceVertices = Source.m_FaceVertices;
+        m_VertexFaces = Source.m_VertexFaces;
+        m_ullSortedNum = Source.m_ullSortedNum;
+        m_VertexMap = Source.m_VertexMap;
+        m_ullIsolatedNum = Source.m_ullIsolatedNum;
+        m_DirtyFaces = Source.m_DirtyFaces;
+        m_FaceDirty = Source.m_FaceDirty;
+        m_DirtyVertices = Source.m_DirtyVertices;
+        m_VertexDirty = Source.m_VertexDirty;
+    }
+    return *this;
+}
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        由网格索引构建：压缩掉只被线引用的顶点（保持字典序），
+                   建立相邻面表，再并行计算全部面法向与顶点法向
+【参数】            const MeshIndex3D& Index：网格索引（面标签同Model3D）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::Build(const MeshIndex3D& Index){
+    const std::vector<Coord3D>& Vertices = Index.Vertices;
+    const size_t FaceCount = Index.FaceVertices.size();
+    //只保留被面引用的顶点，NewIndex为压缩后的编号
+    std::vector<uint8_t> IsUsed(Vertices.size(), 0);
+    for (auto& Corners : Index.FaceVertices) {
+        for (auto Vertex : Corners) {
+            IsUsed[Vertex] = 1;
+        }
+    }
+    std::vector<size_t> NewIndex(Vertices.size(), 0);
+    size_t VertexCount = 0;
+    for (size_t i = 0; i < Vertices.size(); i++) {
+        NewIndex[i] = VertexCount;
+        VertexCount += IsUsed[i];
+    }
+    m_VertexX.resize(VertexCount);
+    m_VertexY.resize(VertexCount);
+    m_VertexZ.resize(VertexCount);
+    Parallel::For(0, Vertices.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            if (IsUsed[i] != 0) {
+                m_VertexX[NewIndex[i]] = Vertices[i][0];
+                m_VertexY[NewIndex[i]] = Vertices[i][1];
+                m_VertexZ[NewIndex[i]] = Vertices[i][2];
+            }
+        }
+    });
+    m_FaceVertices.resize(FaceCount);
+    Parallel::For(0, FaceCount, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            for (size_t k = 0; k < 3; k++) {
+                m_FaceVertices[i][k] = NewIndex[Index.FaceVertices[i][k]];
+            }
+        }
+    });
+    //构建时的顶点可二分查找，哈希表只登记之后新增的顶点
+    m_ullSortedNum = VertexCount;
+    m_VertexMap.clear();
+    //相邻面表
+    m_VertexFaces.assign(VertexCount, std::vector<size_t>());
+    for (size_t i = 0; i < FaceCount; i++) {
+        for (auto Vertex : m_FaceVertices[i]) {
+            m_VertexFaces[Vertex].push_back(i);
+        }
+    }
+    m_ullIsolatedNum = 0;
+    //脏标记清空
+    m_DirtyFaces.clear();
+    m_FaceDirty.assign(FaceCount, 0);
+    m_DirtyVertices.clear();
+    m_VertexDirty.assign(VertexCount, 0);
+    //并行计算全部面法向
+    m_FaceNormalX.resize(FaceCount);
+    m_FaceNormalY.resize(FaceCount);
+    m_FaceNormalZ.resize(FaceCount);
+    m_FaceArea.resize(FaceCount);
+    std::vector<size_t> AllFaces(FaceCount);
+    Parallel::For(0, FaceCount, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            AllFaces[i] = i;
+        }
+        ComputeFaces(AllFaces.data() + First, Last - First);
+    });
+    //并行计算全部顶点法向
+    m_VertexNormalX.resize(VertexCount);
+    m_VertexNormalY.resize(VertexCount);
+    m_VertexNormalZ.resize(VertexCount);
+    Parallel::For(0, VertexCount, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            ComputeVertex(i);
+        }
+    });
+}
+
+/*************************************************************************
+【函数名称】        InsertFace
+【函数功能】        插入一个面（标签为当前面数），登记为脏面
+【参数】            const Triangle3D& Triangle：三顶点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::InsertFace(const Triangle3D& Triangle){
+    size_t FaceTag = m_FaceVertices.size();
+    m_FaceVertices.push_back({AcquireVertex(Triangle[0]),
+        AcquireVertex(Triangle[1]), AcquireVertex(Triangle[2])});
+    m_FaceNormalX.push_back(0.0);
+    m_FaceNormalY.push_back(0.0);
+    m_FaceNormalZ.push_back(0.0);
+    m_FaceArea.push_back(0.0);
+    m_FaceDirty.push_back(0);
+    AttachFace(FaceTag);
+    MarkFace(FaceTag);
+}
+
+/*************************************************************************
+【函数名称】        UpdateFace
+【函数功能】        更新指定标签面的坐标：从旧顶点移除、登记到新顶点，
+                   该面与新旧顶点均登记为脏
+【参数】            size_t FaceTag：面标签（调用者保证不越界）
+                   const Triangle3D& Triangle：新三顶点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::UpdateFace(size_t FaceTag, const Triangle3D& Triangle){
+    DetachFace(FaceTag);
+    for (size_t k = 0; k < 3; k++) {
+        m_FaceVertices[FaceTag][k] = AcquireVertex(Triangle[k]);
+    }
+    AttachFace(FaceTag);
+    MarkFace(FaceTag);
+}
+
+/*************************************************************************
+【函数名称】        RemoveFace
+【函数功能】        交换-弹出删除指定标签的面：其顶点登记为脏，
+                   最后一个面的数据与脏标记移到该标签，相邻面表同步改名
+【参数】            size_t FaceTag：面标签（调用者保证不越界）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::RemoveFace(size_t FaceTag){
+    DetachFace(FaceTag);
+    size_t LastTag = m_FaceVertices.size() - 1;
+    if (FaceTag != LastTag) {
+        for (auto Vertex : m_FaceVertices[LastTag]) {
+            std::vector<size_t>& Faces = m_VertexFaces[Vertex];
+            *std::find(Faces.begin(), Faces.end(), LastTag) = FaceTag;
+        }
+        m_FaceVertices[FaceTag] = m_FaceVertices[LastTag];
+        m_FaceNormalX[FaceTag] = m_FaceNormalX[LastTag];
+        m_FaceNormalY[FaceTag] = m_FaceNormalY[LastTag];
+        m_FaceNormalZ[FaceTag] = m_FaceNormalZ[LastTag];
+        m_FaceArea[FaceTag] = m_FaceArea[LastTag];
+        m_FaceDirty[FaceTag] = m_FaceDirty[LastTag];
+        if (m_FaceDirty[FaceTag] != 0) {
+            m_DirtyFaces.push_back(FaceTag);
+        }
+    }
+    m_FaceVertices.pop_back();
+    m_FaceNormalX.pop_back();
+    m_FaceNormalY.pop_back();
+    m_FaceNormalZ.pop_back();
+    m_FaceArea.pop_back();
+    m_FaceDirty.pop_back();
+}
+
+/*************************************************************************
+【函数名称】        Refresh
+【函数功能】        先重算脏面的法向与面积，再由相邻面重算脏顶点法向；
+                   脏数据多时并行
+【参数】            无
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::Refresh(){
+    //去掉已删除与重复登记的标签
+    std::vector<size_t> Faces;
+    Faces.reserve(m_DirtyFaces.size());
+    for (auto FaceTag : m_DirtyFaces) {
+        if (FaceTag < m_FaceDirty.size() && m_FaceDirty[FaceTag] != 0) {
+            m_FaceDirty[FaceTag] = 0;
+            Faces.push_back(FaceTag);
+        }
+    }
+    m_DirtyFaces.clear();
+    if (Faces.size() < PARALLEL_REFRESH_MIN) {
+        ComputeFaces(Faces.data(), Faces.size());
+    }
+    else {
+        Parallel::For(0, Faces.size(), [&](size_t First, size_t Last){
+            ComputeFaces(Faces.data() + First, Last - First);
+        });
+    }
+    for (auto Vertex : m_DirtyVertices) {
+        m_VertexDirty[Vertex] = 0;
+    }
+    if (m_DirtyVertices.size() < PARALLEL_REFRESH_MIN) {
+        for (auto Vertex : m_DirtyVertices) {
+            ComputeVertex(Vertex);
+        }
+    }
+    else {
+        Parallel::For(0, m_DirtyVertices.size(),
+            [&](size_t First, size_t Last){
+            for (size_t i = First; i < Last; i++) {
+                ComputeVertex(m_DirtyVertices[i]);
+            }
+        });
+    }
+    m_DirtyVertices.clear();
+}
+
+/*************************************************************************
+【函数名称】        IsDirty
+【函数功能】        判断是否有待重算的脏面或脏顶点
+【参数】            无
+【返回值】          有返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool NormalBuffer3D::IsDirty() const{
+    return !m_DirtyFaces.empty() || !m_DirtyVertices.empty();
+}
+
+/*************************************************************************
+【函数名称】        NeedRebuild
+【函数功能】        判断孤立顶点是否超过顶点数一半（删改后遗留），
+                   超过时建议重建以回收空间
+【参数】            无
+【返回值】          需要重建返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool NormalBuffer3D::NeedRebuild() const{
+    return m_ullIsolatedNum > PARALLEL_REFRESH_MIN
+        && m_ullIsolatedNum * 2 > m_VertexX.size();
+}
+
+/*************************************************************************
+【函数名称】        FaceNum
+【函数功能】        获取面数
+【参数】            无
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t NormalBuffer3D::FaceNum() const{
+    return m_FaceVertices.size();
+}
+
+/*************************************************************************
+【函数名称】        VertexNum
+【函数功能】        获取顶点数（含孤立顶点）
+【参数】            无
+【返回值】          size_t，顶点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t NormalBuffer3D::VertexNum() const{
+    return m_VertexX.size();
+}
+
+/*************************************************************************
+【函数名称】        FindVertex
+【函数功能】        查找坐标完全相同的顶点：先在构建时的顶点中按字典序
+                   二分查找，再查新增顶点的哈希表
+【参数】            const Coord3D& Point：坐标
+                   size_t& Vertex：找到时为顶点编号
+【返回值】          找到返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool NormalBuffer3D::FindVertex(const Coord3D& Point, size_t& Vertex) const{
+    size_t Low = 0;
+    size_t High = m_ullSortedNum;
+    while (Low < High) {
+        size_t Middle = Low + (High - Low) / 2;
+        Coord3D Current{m_VertexX[Middle], m_VertexY[Middle],
+            m_VertexZ[Middle]};
+        if (Current < Point) {
+            Low = Middle + 1;
+        }
+        else {
+            High = Middle;
+        }
+    }
+    if (Low < m_ullSortedNum && m_VertexX[Low] == Point[0]
+        && m_VertexY[Low] == Point[1] && m_VertexZ[Low] == Point[2]) {
+        Vertex = Low;
+        return true;
+    }
+    auto It = m_VertexMap.find(Point);
+    if (It == m_VertexMap.end()) {
+        return false;
+    }
+    Vertex = It->second;
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        FaceNormal
+【函数功能】        获取指定标签面的单位法向
+【参数】            size_t FaceTag：面标签（调用者保证不越界）
+【返回值】          Coord3D，单位法向，退化面为零向量
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D NormalBuffer3D::FaceNormal(size_t FaceTag) const{
+    return Coord3D{m_FaceNormalX[FaceTag], m_FaceNormalY[FaceTag],
+        m_FaceNormalZ[FaceTag]};
+}
+
+/*************************************************************************
+【函数名称】        VertexNormal
+【函数功能】        获取指定顶点的单位法向
+【参数】            size_t Vertex：顶点编号（调用者保证不越界）
+【返回值】          Coord3D，单位法向，孤立顶点或法向抵消时为零向量
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D NormalBuffer3D::VertexNormal(size_t Vertex) const{
+    return Coord3D{m_VertexNormalX[Vertex], m_VertexNormalY[Vertex],
+        m_VertexNormalZ[Vertex]};
+}
+
+/*************************************************************************
+【函数名称】        CoordHash::operator()
+【函数功能】        坐标哈希：三个分量的位模式乘大奇数后异或，
+                   -0.0先规整为0.0，使与相等比较一致
+【参数】            const Coord3D& Point：坐标
+【返回值】          size_t，哈希值
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t NormalBuffer3D::CoordHash::operator()(const Coord3D& Point) const{
+    const uint64_t Multipliers[3] = {0x9E3779B97F4A7C15ull,
+        0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull};
+    uint64_t Hash = 0;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        double Value = Point[Axis] == 0.0 ? 0.0 : Point[Axis];
+        uint64_t Bits;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+        Hash ^= Bits * Multipliers[Axis];
+    }
+    return static_cast<size_t>(Hash ^ (Hash >> 29));
+}
+
+/*************************************************************************
+【函数名称】        FaceKernel
+【函数功能】        面法向内核：N = (B - A)×(C - A)，面积为|N|/2，
+                   单位法向为N/|N|（|N|为0时取零向量）；循环体无分支，
+                   各数组连续，编译器可自动向量化
+【参数】            size_t Count：面数
+                   const double* AX...CZ：三顶点坐标分量数组
+                   double* NX, NY, NZ：输出单位法向分量
+                   double* Area：输出面积
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::FaceKernel(size_t Count, const double* AX,
+    const double* AY, const double* AZ, const double* BX,
+    const double* BY, const double* BZ, const double* CX,
+    const double* CY, const double* CZ, double* NX, double* NY,
+    double* NZ, double* Area){
+    for (size_t i = 0; i < Count; i++) {
+        double UX = BX[i] - AX[i];
+        double UY = BY[i] - AY[i];
+        double UZ = BZ[i] - AZ[i];
+        double VX = CX[i] - AX[i];
+        double VY = CY[i] - AY[i];
+        double VZ = CZ[i] - AZ[i];
+        double X = UY * VZ - UZ * VY;
+        double Y = UZ * VX - UX * VZ;
+        double Z = UX * VY - UY * VX;
+        double Length = std::sqrt(X * X + Y * Y + Z * Z);
+        double Inverse = Length > 0.0 ? 1.0 / Length : 0.0;
+        NX[i] = X * Inverse;
+        NY[i] = Y * Inverse;
+        NZ[i] = Z * Inverse;
+        Area[i] = 0.5 * Length;
+    }
+}
+
+/*************************************************************************
+【函数名称】        ComputeFaces
+【函数功能】        按KERNEL_BLOCK分块：把指定面的顶点坐标收集到栈上SoA
+                   数组，调用面法向内核，再把结果散写回面缓冲区
+【参数】            const size_t* FaceTags：面标签数组
+                   size_t Count：面数
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::ComputeFaces(const size_t* FaceTags, size_t Count){
+    //0~8为三顶点坐标分量，9~12为单位法向与面积
+    double Block[13][KERNEL_BLOCK];
+    for (size_t Begin = 0; Begin < Count; Begin += KERNEL_BLOCK) {
+        size_t Size = std::min(KERNEL_BLOCK, Count - Begin);
+        for (size_t i = 0; i < Size; i++) {
+            const std::array<size_t, 3>& Corners
+                = m_FaceVertices[FaceTags[Begin + i]];
+            for (size_t k = 0; k < 3; k++) {
+                Block[3 * k][i] = m_VertexX[Corners[k]];
+                Block[3 * k + 1][i] = m_VertexY[Corners[k]];
+                Block[3 * k + 2][i] = m_VertexZ[Corners[k]];
+            }
+        }
+        FaceKernel(Size, Block[0], Block[1], Block[2], Block[3], Block[4],
+            Block[5], Block[6], Block[7], Block[8], Block[9], Block[10],
+            Block[11], Block[12]);
+        for (size_t i = 0; i < Size; i++) {
+            size_t FaceTag = FaceTags[Begin + i];
+            m_FaceNormalX[FaceTag] = Block[9][i];
+            m_FaceNormalY[FaceTag] = Block[10][i];
+            m_FaceNormalZ[FaceTag] = Block[11][i];
+            m_FaceArea[FaceTag] = Block[12][i];
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        ComputeVertex
+【函数功能】        顶点法向：相邻面“面积×单位法向”之和单位化
+                   （面含重复顶点时按登记次数计入）
+【参数】            size_t Vertex：顶点编号
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::ComputeVertex(size_t Vertex){
+    double X = 0.0;
+    double Y = 0.0;
+    double Z = 0.0;
+    for (auto FaceTag : m_VertexFaces[Vertex]) {
+        X += m_FaceArea[FaceTag] * m_FaceNormalX[FaceTag];
+        Y += m_FaceArea[FaceTag] * m_FaceNormalY[FaceTag];
+        Z += m_FaceArea[FaceTag] * m_FaceNormalZ[FaceTag];
+    }
+    double Length = std::sqrt(X * X + Y * Y + Z * Z);
+    double Inverse = Length > 0.0 ? 1.0 / Length : 0.0;
+    m_VertexNormalX[Vertex] = X * Inverse;
+    m_VertexNormalY[Vertex] = Y * Inverse;
+    m_VertexNormalZ[Vertex] = Z * Inverse;
+}
+
+/*************************************************************************
+【函数名称】        AcquireVertex
+【函数功能】        查找坐标对应的顶点，不存在时在末尾新建（先为孤立顶点）
+【参数】            const Coord3D& Point：坐标
+【返回值】          size_t，顶点编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t NormalBuffer3D::AcquireVertex(const Coord3D& Point){
+    size_t Vertex;
+    if (FindVertex(Point, Vertex)) {
+        return Vertex;
+    }
+    auto Result = m_VertexMap.emplace(Point, m_VertexX.size());
+    if (Result.second) {
+        m_VertexX.push_back(Point[0]);
+        m_VertexY.push_back(Point[1]);
+        m_VertexZ.push_back(Point[2]);
+        m_VertexNormalX.push_back(0.0);
+        m_VertexNormalY.push_back(0.0);
+        m_VertexNormalZ.push_back(0.0);
+        m_VertexFaces.emplace_back();
+        m_VertexDirty.push_back(0);
+        m_ullIsolatedNum++;
+    }
+    return Result.first->second;
+}
+
+/*************************************************************************
+【函数名称】        AttachFace
+【函数功能】        把面登记到其三个顶点的相邻面表，顶点标记为脏
+【参数】            size_t FaceTag：面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::AttachFace(size_t FaceTag){
+    for (auto Vertex : m_FaceVertices[FaceTag]) {
+        if (m_VertexFaces[Vertex].empty()) {
+            m_ullIsolatedNum--;
+        }
+        m_VertexFaces[Vertex].push_back(FaceTag);
+        MarkVertex(Vertex);
+    }
+}
+
+/*************************************************************************
+【函数名称】        DetachFace
+【函数功能】        把面从其三个顶点的相邻面表移除（交换-弹出），
+                   顶点标记为脏
+【参数】            size_t FaceTag：面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::DetachFace(size_t FaceTag){
+    for (auto Vertex : m_FaceVertices[FaceTag]) {
+        std::vector<size_t>& Faces = m_VertexFaces[Vertex];
+        auto It = std::find(Faces.begin(), Faces.end(), FaceTag);
+        *It = Faces.back();
+        Faces.pop_back();
+        if (Faces.empty()) {
+            m_ullIsolatedNum++;
+        }
+        MarkVertex(Vertex);
+    }
+}
+
+/*************************************************************************
+【函数名称】        MarkFace
+【函数功能】        标记面为脏（已标记时不重复登记）
+【参数】            size_t FaceTag：面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::MarkFace(size_t FaceTag){
+    if (m_FaceDirty[FaceTag] == 0) {
+        m_FaceDirty[FaceTag] = 1;
+        m_DirtyFaces.push_back(FaceTag);
+    }
+}
+
+/*************************************************************************
+【函数名称】        MarkVertex
+【函数功能】        标记顶点为脏（已标记时不重复登记）
+【参数】            size_t Vertex：顶点编号
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void NormalBuffer3D::MarkVertex(size_t Vertex){
+    if (m_VertexDirty[Vertex] == 0) {
+        m_VertexDirty[Vertex] = 1;
+        m_DirtyVertices.push_back(Vertex);
+    }
+}
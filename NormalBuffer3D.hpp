@@ -0,0 +1,165 @@
+/*************************************************************************
+【文件名】                 NormalBuffer3D.hpp
+【功能模块和目的】          面法向与顶点法向缓冲区类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef NORMALBUFFER3D_HPP
+#define NORMALBUFFER3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//uint8_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::unordered_map所属头文件
+#include <unordered_map>
+
+/*************************************************************************
+【类名】             NormalBuffer3D
+【功能】             面单位法向、面积与面积加权顶点单位法向的缓冲区
+【接口说明】         各分量按结构数组（SoA）连续存放，便于批量读取与向量化；
+                    由网格索引构建（只保留被面引用的顶点），面法向以
+                    分块收集坐标后的无分支内核并行计算，顶点法向为
+                    相邻面“面积×单位法向”之和的单位化；
+                    支持插入、按标签更新与交换-弹出删除（与Model3D标签
+                    约定一致），修改只登记脏面与脏顶点，Refresh时
+                    只重算脏面及其邻域顶点；顶点编号为缓冲区自有编号，
+                    可由坐标查找：构建时的顶点沿用网格索引的字典序，
+                    二分查找，之后新增的顶点登记在哈希表中；
+                    孤立顶点过多时提示重建
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class NormalBuffer3D{
+public:
+    //默认构造函数，空缓冲区
+    NormalBuffer3D() = default;
+    //拷贝构造函数
+    NormalBuffer3D(const NormalBuffer3D& Source);
+    //虚析构函数
+    virtual ~NormalBuffer3D() = default;
+    //赋值运算符
+    NormalBuffer3D& operator=(const NormalBuffer3D& Source);
+
+    //Setter
+    //由网格索引并行构建（面标签同网格索引），构建后无脏数据
+    void Build(const MeshIndex3D& Index);
+    //插入一个面，标签为当前面数
+    void InsertFace(const Triangle3D& Triangle);
+    //更新指定标签面的坐标
+    void UpdateFace(size_t FaceTag, const Triangle3D& Triangle);
+    //交换-弹出删除指定标签的面（最后一个面接替该标签）
+    void RemoveFace(size_t FaceTag);
+    //重算脏面法向与受影响顶点的法向
+    void Refresh();
+
+    //Getter
+    //是否有待重算的脏面或脏顶点
+    bool IsDirty() const;
+    //孤立顶点过多，建议重建
+    bool NeedRebuild() const;
+    //面数
+    size_t FaceNum() const;
+    //顶点数（含孤立顶点）
+    size_t VertexNum() const;
+    //查找坐标完全相同的顶点，找到返回true
+    bool FindVertex(const Coord3D& Point, size_t& Vertex) const;
+    //指定标签面的单位法向（退化面为零向量）
+    Coord3D FaceNormal(size_t FaceTag) const;
+    //指定顶点的单位法向（孤立顶点与法向抵消时为零向量）
+    Coord3D VertexNormal(size_t Vertex) const;
+
+    //Getter数据成员（Refresh后与几何一致）
+    //面单位法向X、Y、Z分量
+    const std::vector<double>& FaceNormalX{m_FaceNormalX};
+    const std::vector<double>& FaceNormalY{m_FaceNormalY};
+    const std::vector<double>& FaceNormalZ{m_FaceNormalZ};
+    //面面积
+    const std::vector<double>& FaceArea{m_FaceArea};
+    //顶点单位法向X、Y、Z分量
+    const std::vector<double>& VertexNormalX{m_VertexNormalX};
+    const std::vector<double>& VertexNormalY{m_VertexNormalY};
+    const std::vector<double>& VertexNormalZ{m_VertexNormalZ};
+    //顶点坐标X、Y、Z分量
+    const std::vector<double>& VertexX{m_VertexX};
+    const std::vector<double>& VertexY{m_VertexY};
+    const std::vector<double>& VertexZ{m_VertexZ};
+    //每个面的三个顶点编号
+    const std::vector<std::array<size_t, 3>>& FaceVertices{m_FaceVertices};
+
+    //静态常量：面法向内核每块面数（块内坐标收集到栈上SoA数组）
+    static constexpr size_t KERNEL_BLOCK{256};
+    //静态常量：脏面或脏顶点不少于该数时并行重算
+    static constexpr size_t PARALLEL_REFRESH_MIN{4096};
+
+private:
+    //坐标哈希（±0视为相同）
+    class CoordHash{
+    public:
+        size_t operator()(const Coord3D& Point) const;
+    };
+
+    //面法向内核：由SoA三顶点坐标计算单位法向与面积，无分支可向量化
+    static void FaceKernel(size_t Count, const double* AX, const double* AY,
+        const double* AZ, const double* BX, const double* BY,
+        const double* BZ, const double* CX, const double* CY,
+        const double* CZ, double* NX, double* NY, double* NZ, double* Area);
+    //分块收集指定面的顶点坐标并调用内核，结果写回面缓冲区
+    void ComputeFaces(const size_t* FaceTags, size_t Count);
+    //由相邻面重算指定顶点的法向
+    void ComputeVertex(size_t Vertex);
+    //查找或新建坐标对应的顶点
+    size_t AcquireVertex(const Coord3D& Point);
+    //把面登记到其三个顶点的相邻面表并标记顶点为脏
+    void AttachFace(size_t FaceTag);
+    //把面从其三个顶点的相邻面表移除并标记顶点为脏
+    void DetachFace(size_t FaceTag);
+    //标记面为脏
+    void MarkFace(size_t FaceTag);
+    //标记顶点为脏
+    void MarkVertex(size_t Vertex);
+
+    //面单位法向X、Y、Z分量
+    std::vector<double> m_FaceNormalX{};
+    std::vector<double> m_FaceNormalY{};
+    std::vector<double> m_FaceNormalZ{};
+    //面面积
+    std::vector<double> m_FaceArea{};
+    //顶点单位法向X、Y、Z分量
+    std::vector<double> m_VertexNormalX{};
+    std::vector<double> m_VertexNormalY{};
+    std::vector<double> m_VertexNormalZ{};
+    //顶点坐标X、Y、Z分量
+    std::vector<double> m_VertexX{};
+    std::vector<double> m_VertexY{};
+    std::vector<double> m_VertexZ{};
+    //每个面的三个顶点编号
+    std::vector<std::array<size_t, 3>> m_FaceVertices{};
+    //每个顶点的相邻面标签（面含重复顶点时重复登记）
+    std::vector<std::vector<size_t>> m_VertexFaces{};
+    //构建时的顶点数（这些顶点按坐标字典序排列）
+    size_t m_ullSortedNum{0};
+    //构建后新增顶点的坐标到顶点编号
+    std::unordered_map<Coord3D, size_t, CoordHash> m_VertexMap{};
+    //孤立顶点（无相邻面）数
+    size_t m_ullIsolatedNum{0};
+    //脏面标签（可能含已删除或重复的标签，以标记为准）
+    std::vector<size_t> m_DirtyFaces{};
+    //面脏标记
+    std::vector<uint8_t> m_FaceDirty{};
+    //脏顶点编号
+    std::vector<size_t> m_DirtyVertices{};
+    //顶点脏标记
+    std::vector<uint8_t> m_VertexDirty{};
+};
+
+#endif //NORMALBUFFER3D_HPP
@@ -0,0 +1,234 @@
+/*************************************************************************
+【文件名】                 Parallel.hpp
+【功能模块和目的】          基于std::thread的并行循环与归约工具类
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加并行排序
+                          梁思奇 2026/10/18 并行循环中的异常传回调用线程
+*************************************************************************/
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+//size_t所属头文件
+#include <cstddef>
+//std::thread所属头文件
+#include <thread>
+//std::vector所属头文件
+#include <vector>
+//std::min、std::sort、std::inplace_merge所属头文件
+#include <algorithm>
+//std::exception_ptr所属头文件
+#include <exception>
+//std::system_error所属头文件
+#include <system_error>
+
+/*************************************************************************
+【类名】             Parallel
+【功能】             并行工具类，将区间[Begin, End)切分为连续块分配给
+                    各个线程执行，供模型的批量几何计算使用
+【接口说明】         只含静态函数：获取线程数、并行循环、并行归约、并行排序；
+                    区间较小时直接在调用线程中串行执行，避免建线程开销；
+                    块处理函数抛出的异常在所有线程汇合后于调用线程重新抛出
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加并行排序
+                    梁思奇 2026/10/18 并行循环中的异常传回调用线程
+*************************************************************************/
+class Parallel{
+public:
+    //工具类，无需实例
+    Parallel() = delete;
+
+    //获取可用线程数（至少为1）
+    static size_t ThreadCount();
+    //并行循环：Func(ChunkBegin, ChunkEnd)处理一个连续块
+    template<class FUNC>
+    static void For(size_t Begin, size_t End, FUNC Func,
+        size_t MinChunk = DEFAULT_MIN_CHUNK);
+    //并行归约：Func(ChunkBegin, ChunkEnd)返回块内结果，
+    //Combine(T, T)合并两块结果，按块顺序合并保证结果可复现
+    template<class T, class FUNC, class COMBINE>
+    static T Reduce(size_t Begin, size_t End, T Init, FUNC Func,
+        COMBINE Combine, size_t MinChunk = DEFAULT_MIN_CHUNK);
+    //并行排序：各块分别排序后两两归并
+    template<class ITER, class COMPARE>
+    static void Sort(ITER First, ITER Last, COMPARE Compare,
+        size_t MinChunk = DEFAULT_MIN_CHUNK);
+
+    //静态常量：每个线程分得的最小块大小
+    static constexpr size_t DEFAULT_MIN_CHUNK{4096};
+};
+
+/*************************************************************************
+【函数名称】        ThreadCount
+【函数功能】        获取可用线程数
+【参数】            无
+【返回值】          size_t，硬件线程数，无法获取时为1
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+inline size_t Parallel::ThreadCount(){
+    size_t Count = std::thread::hardware_concurrency();
+    return Count == 0 ? 1 : Count;
+}
+
+/*************************************************************************
+【函数名称】        For
+【函数功能】        将区间切分为连续块并行执行，调用线程也承担一块；
+                   各块的异常先行捕获，等待全部线程结束后，在调用线程
+                   重新抛出块序最小的异常；无法创建线程时该块改由调用
+                   线程执行
+【参数】            size_t Begin, size_t End：区间
+                   FUNC Func：块处理函数Func(ChunkBegin, ChunkEnd)
+                   size_t MinChunk：每块最小元素数
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】        梁思奇 2026/10/18 捕获块内异常，汇合后重新抛出
+*************************************************************************/
+template<class FUNC>
+void Parallel::For(size_t Begin, size_t End, FUNC Func, size_t MinChunk){
+    if (End <= Begin) {
+        return;
+    }
+    size_t Count = End - Begin;
+    //块数不超过线程数，且每块不少于MinChunk个元素
+    size_t ChunkNum = std::min(ThreadCount(),
+        (Count + MinChunk - 1) / (MinChunk == 0 ? 1 : MinChunk));
+    if (ChunkNum <= 1) {
+        Func(Begin, End);
+        return;
+    }
+    size_t ChunkSize = (Count + ChunkNum - 1) / ChunkNum;
+    //各块捕获的异常，异常不能越出线程函数，否则std::terminate
+    std::vector<std::exception_ptr> Errors(ChunkNum);
+    auto RunChunk = [&Errors](FUNC Chunk, size_t i, size_t First,
+        size_t Last){
+        try {
+            Chunk(First, Last);
+        }
+        catch (...) {
+            Errors[i] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> Workers;
+    //第0块留给调用线程
+    for (size_t i = 1; i < ChunkNum; i++) {
+        size_t ChunkBegin = Begin + i * ChunkSize;
+        size_t ChunkEnd = std::min(End, ChunkBegin + ChunkSize);
+        if (ChunkBegin < ChunkEnd) {
+            try {
+                Workers.emplace_back(RunChunk, Func, i, ChunkBegin,
+                    ChunkEnd);
+            }
+            catch (const std::system_error&) {
+                RunChunk(Func, i, ChunkBegin, ChunkEnd);
+            }
+        }
+    }
+    RunChunk(Func, 0, Begin, std::min(End, Begin + ChunkSize));
+    //必须等待全部线程，可汇合的线程对象析构同样会std::terminate
+    for (auto& Worker : Workers) {
+        Worker.join();
+    }
+    for (auto& Error : Errors) {
+        if (Error) {
+            std::rethrow_exception(Error);
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        Reduce
+【函数功能】        并行归约，各块结果按块顺序依次合并
+【参数】            size_t Begin, size_t End：区间
+                   T Init：初值
+                   FUNC Func：块处理函数，返回块内结果
+                   COMBINE Combine：合并函数
+                   size_t MinChunk：每块最小元素数
+【返回值】          T，归约结果
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<class T, class FUNC, class COMBINE>
+T Parallel::Reduce(size_t Begin, size_t End, T Init, FUNC Func,
+    COMBINE Combine, size_t MinChunk){
+    if (End <= Begin) {
+        return Init;
+    }
+    size_t Count = End - Begin;
+    size_t ChunkNum = std::min(ThreadCount(),
+        (Count + MinChunk - 1) / (MinChunk == 0 ? 1 : MinChunk));
+    if (ChunkNum <= 1) {
+        return Combine(Init, Func(Begin, End));
+    }
+    size_t ChunkSize = (Count + ChunkNum - 1) / ChunkNum;
+    //各块结果
+    std::vector<T> Results(ChunkNum, Init);
+    For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            size_t ChunkBegin = Begin + i * ChunkSize;
+            size_t ChunkEnd = std::min(End, ChunkBegin + ChunkSize);
+            if (ChunkBegin < ChunkEnd) {
+                Results[i] = Func(ChunkBegin, ChunkEnd);
+            }
+        }
+    }, 1);
+    //按块顺序合并
+    T Result = Init;
+    for (size_t i = 0; i < ChunkNum; i++) {
+        if (Begin + i * ChunkSize < End) {
+            Result = Combine(Result, Results[i]);
+        }
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Sort
+【函数功能】        并行排序：区间切分为与线程数相当的块，各块并行排序，
+                   再按宽度倍增逐轮并行两两归并
+【参数】            ITER First, ITER Last：随机访问迭代器区间
+                   COMPARE Compare：比较函数
+                   size_t MinChunk：每块最小元素数
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<class ITER, class COMPARE>
+void Parallel::Sort(ITER First, ITER Last, COMPARE Compare, size_t MinChunk){
+    if (Last - First <= 1) {
+        return;
+    }
+    size_t Count = static_cast<size_t>(Last - First);
+    size_t ChunkNum = std::min(ThreadCount(),
+        (Count + MinChunk - 1) / (MinChunk == 0 ? 1 : MinChunk));
+    if (ChunkNum <= 1) {
+        std::sort(First, Last, Compare);
+        return;
+    }
+    size_t ChunkSize = (Count + ChunkNum - 1) / ChunkNum;
+    //各块并行排序
+    For(0, ChunkNum, [&](size_t Begin, size_t End){
+        for (size_t i = Begin; i < End; i++) {
+            size_t ChunkBegin = std::min(Count, i * ChunkSize);
+            size_t ChunkEnd = std::min(Count, ChunkBegin + ChunkSize);
+            std::sort(First + ChunkBegin, First + ChunkEnd, Compare);
+        }
+    }, 1);
+    //逐轮两两归并，每轮内各对并行
+    for (size_t Width = ChunkSize; Width < Count; Width *= 2) {
+        size_t PairNum = (Count + 2 * Width - 1) / (2 * Width);
+        For(0, PairNum, [&](size_t Begin, size_t End){
+            for (size_t i = Begin; i < End; i++) {
+                size_t Left = i * 2 * Width;
+                size_t Mid = std::min(Count, Left + Width);
+                size_t Right = std::min(Count, Left + 2 * Width);
+                if (Mid < Right) {
+                    std::inplace_merge(First + Left, First + Mid,
+                        First + Right, Compare);
+                }
+            }
+        }, 1);
+    }
+}
+
+#endif //PARALLEL_HPP
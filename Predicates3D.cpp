@@ -0,0 +1,547 @@
+/*************************************************************************
+【文件名】                 Predicates3D.cpp
+【功能模块和目的】          鲁棒几何谓词类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加竖直线穿面判定
+                          梁思奇 2026/10/18 增加三角形相交判定
+*************************************************************************/
+
+//自身类头文件
+#include "Predicates3D.hpp"
+//std::fma、std::abs所属头文件
+#include <cmath>
+//std::min、std::max所属头文件
+#include <algorithm>
+
+/*************************************************************************
+【函数名称】        TwoSum
+【函数功能】        浮点和及其舍入误差：A + B = Sum + Error（精确）
+【参数】            double A, double B：加数
+                   double& Sum：浮点和
+                   double& Error：舍入误差
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void TwoSum(double A, double B, double& Sum, double& Error){
+    Sum = A + B;
+    double BVirtual = Sum - A;
+    double AVirtual = Sum - BVirtual;
+    Error = (A - AVirtual) + (B - BVirtual);
+}
+
+/*************************************************************************
+【函数名称】        TwoProduct
+【函数功能】        浮点积及其舍入误差：A·B = Product + Error（精确，
+                   误差由融合乘加求得）
+【参数】            double A, double B：乘数
+                   double& Product：浮点积
+                   double& Error：舍入误差
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+static void TwoProduct(double A, double B, double& Product, double& Error){
+    Product = A * B;
+    Error = std::fma(A, B, -Product);
+}
+
+/*************************************************************************
+【函数名称】        Orient3D
+【函数功能】        D相对平面ABC的方位：先以浮点计算行列式
+                   det[A - D; B - D; C - D]，与误差界比较，
+                   无法确定符号时精确求值
+【参数】            const Coord3D& A, B, C：平面上三点
+                   const Coord3D& D：待判定点
+【返回值】          double，符号精确：D在(B - A)×(C - A)一侧为正，
+                   共面为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double Predicates3D::Orient3D(const Coord3D& A, const Coord3D& B,
+    const Coord3D& C, const Coord3D& D){
+    double ADX = A[0] - D[0];
+    double ADY = A[1] - D[1];
+    double ADZ = A[2] - D[2];
+    double BDX = B[0] - D[0];
+    double BDY = B[1] - D[1];
+    double BDZ = B[2] - D[2];
+    double CDX = C[0] - D[0];
+    double CDY = C[1] - D[1];
+    double CDZ = C[2] - D[2];
+    double BDXCDY = BDX * CDY;
+    double CDXBDY = CDX * BDY;
+    double CDXADY = CDX * ADY;
+    double ADXCDY = ADX * CDY;
+    double ADXBDY = ADX * BDY;
+    double BDXADY = BDX * ADY;
+    double Det = ADZ * (BDXCDY - CDXBDY) + BDZ * (CDXADY - ADXCDY)
+        + CDZ * (ADXBDY - BDXADY);
+    double Permanent = std::abs(ADZ) * (std::abs(BDXCDY) + std::abs(CDXBDY))
+        + std::abs(BDZ) * (std::abs(CDXADY) + std::abs(ADXCDY))
+        + std::abs(CDZ) * (std::abs(ADXBDY) + std::abs(BDXADY));
+    //det[A - D; B - D; C - D]在D位于法向一侧时为负，取反
+    if (Det > ORIENT3D_ERROR_BOUND * Permanent
+        || -Det > ORIENT3D_ERROR_BOUND * Permanent) {
+        return -Det;
+    }
+    return Orient3DExact(A, B, C, D);
+}
+
+/*************************************************************************
+【函数名称】        Orient2D
+【函数功能】        投影方位：先以浮点计算(A - C)×(B - C)的Z分量，与误差界
+                   比较，无法确定符号时把三点置于Z = 0平面，以竖直方向上
+                   的点为第四点精确求Orient3D（二者符号相同）
+【参数】            const Coord3D& A, B：有向直线上两点
+                   const Coord3D& C：待判定点
+【返回值】          double，符号精确：A、B、C投影逆时针为正，共线为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double Predicates3D::Orient2D(const Coord3D& A, const Coord3D& B,
+    const Coord3D& C){
+    double Left = (A[0] - C[0]) * (B[1] - C[1]);
+    double Right = (A[1] - C[1]) * (B[0] - C[0]);
+    double Det = Left - Right;
+    if ((Left > 0.0 && Right <= 0.0) || (Left < 0.0 && Right >= 0.0)) {
+        return Det;
+    }
+    if (Left == 0.0) {
+        return Det;
+    }
+    double Bound = ORIENT2D_ERROR_BOUND * std::abs(Left + Right);
+    if (Det >= Bound || -Det >= Bound) {
+        return Det;
+    }
+    return Orient3DExact(Coord3D{{A[0], A[1], 0.0}},
+        Coord3D{{B[0], B[1], 0.0}}, Coord3D{{C[0], C[1], 0.0}},
+        Coord3D{{0.0, 0.0, 1.0}});
+}
+
+/*************************************************************************
+【函数名称】        CrossColumn
+【函数功能】        竖直线与三角形是否相交，交点高度由重心权重插值
+【参数】            const Triangle3D& Triangle：三角形
+                   double X, double Y：竖直线位置
+                   double& Z：交点高度（相交时有效）
+【返回值】          bool，相交返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::CrossColumn(const Triangle3D& Triangle, double X,
+    double Y, double& Z){
+    std::array<double, 3> Weights;
+    if (CoverColumn(Triangle, X, Y, Weights) == 0.0) {
+        return false;
+    }
+    double WeightSum = Weights[0] + Weights[1] + Weights[2];
+    Z = WeightSum > 0.0 ? (Weights[0] * Triangle[0][2] + Weights[1]
+        * Triangle[1][2] + Weights[2] * Triangle[2][2]) / WeightSum
+        : Triangle[0][2];
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        CrossAbove
+【函数功能】        自点向+Z的射线是否穿过三角形：竖直线须穿过投影，
+                   且点在平面上与法向Z分量相反的一侧（Orient3D精确判定）
+【参数】            const Triangle3D& Triangle：三角形
+                   const Coord3D& Point：射线起点
+【返回值】          bool，穿过返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::CrossAbove(const Triangle3D& Triangle,
+    const Coord3D& Point){
+    std::array<double, 3> Weights;
+    double Area = CoverColumn(Triangle, Point[0], Point[1], Weights);
+    if (Area == 0.0) {
+        return false;
+    }
+    double Side = Orient3D(Triangle[0], Triangle[1], Triangle[2], Point);
+    return Area > 0.0 ? Side < 0.0 : Side > 0.0;
+}
+
+/*************************************************************************
+【函数名称】        TrianglesIntersect
+【函数功能】        闭三角形相交判定：一个三角形的三顶点严格在另一个所在
+                   平面同侧时不相交；共面时在投影平面上判定；否则两者
+                   的交集是两平面交线上的一段，其端点必在某一三角形的
+                   边上，故相交当且仅当某条边与另一个三角形有公共点
+【参数】            const Triangle3D& First, Second：两个三角形
+【返回值】          bool，有公共点返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::TrianglesIntersect(const Triangle3D& First,
+    const Triangle3D& Second){
+    bool IsFirstDegenerate = ProjectPlane(First) == 3;
+    bool IsSecondDegenerate = ProjectPlane(Second) == 3;
+    if (IsFirstDegenerate && IsSecondDegenerate) {
+        return false;
+    }
+    if (IsFirstDegenerate || IsSecondDegenerate) {
+        const Triangle3D& Edges = IsFirstDegenerate ? First : Second;
+        const Triangle3D& Other = IsFirstDegenerate ? Second : First;
+        for (size_t k = 0; k < 3; k++) {
+            if (SegmentTriangle(Edges[k], Edges[(k + 1) % 3], Other)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    //各顶点相对另一三角形所在平面的方位
+    std::array<double, 3> FirstSides;
+    std::array<double, 3> SecondSides;
+    for (size_t k = 0; k < 3; k++) {
+        FirstSides[k] = Orient3D(Second[0], Second[1], Second[2], First[k]);
+        SecondSides[k] = Orient3D(First[0], First[1], First[2], Second[k]);
+    }
+    auto IsOneSide = [](const std::array<double, 3>& Sides){
+        return (Sides[0] > 0.0 && Sides[1] > 0.0 && Sides[2] > 0.0)
+            || (Sides[0] < 0.0 && Sides[1] < 0.0 && Sides[2] < 0.0);
+    };
+    if (IsOneSide(FirstSides) || IsOneSide(SecondSides)) {
+        return false;
+    }
+    if (SecondSides[0] == 0.0 && SecondSides[1] == 0.0
+        && SecondSides[2] == 0.0) {
+        //共面：一个三角形的边与另一个有公共点，或完全包含
+        size_t Plane = ProjectPlane(First);
+        Triangle3D FlatFirst;
+        Triangle3D FlatSecond;
+        for (size_t k = 0; k < 3; k++) {
+            FlatFirst[k] = Project(First[k], Plane);
+            FlatSecond[k] = Project(Second[k], Plane);
+        }
+        for (size_t k = 0; k < 3; k++) {
+            if (SegmentTriangle2D(FlatFirst[k], FlatFirst[(k + 1) % 3],
+                FlatSecond)) {
+                return true;
+            }
+        }
+        return PointInTriangle2D(FlatSecond[0], FlatFirst);
+    }
+    for (size_t k = 0; k < 3; k++) {
+        if (SegmentTriangle(First[k], First[(k + 1) % 3], Second)
+            || SegmentTriangle(Second[k], Second[(k + 1) % 3], First)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*************************************************************************
+【函数名称】        CoverColumn
+【函数功能】        竖直线是否穿过三角形投影：投影后按逆时针顺序，点须在
+                   每条边的左侧；恰在边上时，只有方向为“Y增大，或Y不变
+                   且X减小”的边计入（相邻两面在共享边上方向相反，
+                   恰有一个计入）；投影退化（竖直的面）时不穿过；
+                   方位由Orient2D精确判定
+【参数】            const Triangle3D& Triangle：三角形
+                   double X, double Y：竖直线位置
+                   std::array<double, 3>& Weights：三顶点的重心权重
+                   （穿过时有效，未归一）
+【返回值】          double，穿过时为投影有向面积（近似值，符号精确），
+                   否则为0
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double Predicates3D::CoverColumn(const Triangle3D& Triangle, double X,
+    double Y, std::array<double, 3>& Weights){
+    const Coord3D Point{{X, Y, 0.0}};
+    double Area = Orient2D(Triangle[0], Triangle[1], Triangle[2]);
+    if (Area == 0.0) {
+        return 0.0;
+    }
+    //投影的逆时针顶点顺序
+    std::array<size_t, 3> Order{{0, 1, 2}};
+    if (Area < 0.0) {
+        Order = {{0, 2, 1}};
+    }
+    for (size_t k = 0; k < 3; k++) {
+        const Coord3D& From = Triangle[Order[k]];
+        const Coord3D& To = Triangle[Order[(k + 1) % 3]];
+        double Weight = Orient2D(From, To, Point);
+        if (Weight < 0.0) {
+            return 0.0;
+        }
+        if (Weight == 0.0) {
+            double DX = To[0] - From[0];
+            double DY = To[1] - From[1];
+            if (!(DY > 0.0 || (DY == 0.0 && DX < 0.0))) {
+                return 0.0;
+            }
+        }
+        //边的权重属于其对顶点
+        Weights[Order[(k + 2) % 3]] = Weight;
+    }
+    return Area;
+}
+
+/*************************************************************************
+【函数名称】        ProjectPlane
+【函数功能】        依次检查三角形在XY、YZ、ZX平面上的投影方位，取第一个
+                   非零（投影不退化）的平面
+【参数】            const Triangle3D& Triangle：三角形
+【返回值】          size_t，0为XY，1为YZ，2为ZX，三点共线时为3
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t Predicates3D::ProjectPlane(const Triangle3D& Triangle){
+    for (size_t Plane = 0; Plane < 3; Plane++) {
+        if (Orient2D(Project(Triangle[0], Plane), Project(Triangle[1], Plane),
+            Project(Triangle[2], Plane)) != 0.0) {
+            return Plane;
+        }
+    }
+    return 3;
+}
+
+/*************************************************************************
+【函数名称】        Project
+【函数功能】        点投影到坐标平面：取平面的两个坐标轴分量，Z置0
+【参数】            const Coord3D& Point：点
+                   size_t Plane：0为XY，1为YZ，2为ZX
+【返回值】          Coord3D，投影点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D Predicates3D::Project(const Coord3D& Point, size_t Plane){
+    return Coord3D{{Point[Plane], Point[(Plane + 1) % 3], 0.0}};
+}
+
+/*************************************************************************
+【函数名称】        SegmentTriangle
+【函数功能】        线段与闭三角形相交判定：两端点严格在平面同侧时不相交；
+                   两端点都在平面上时在投影平面上判定；否则线段与平面
+                   交于一点，该点在三角形内当且仅当直线ST相对三条边的
+                   方位不同时出现正负
+【参数】            const Coord3D& S, T：线段端点
+                   const Triangle3D& Triangle：不退化的三角形
+【返回值】          bool，有公共点返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::SegmentTriangle(const Coord3D& S, const Coord3D& T,
+    const Triangle3D& Triangle){
+    double SideS = Orient3D(Triangle[0], Triangle[1], Triangle[2], S);
+    double SideT = Orient3D(Triangle[0], Triangle[1], Triangle[2], T);
+    if ((SideS > 0.0 && SideT > 0.0) || (SideS < 0.0 && SideT < 0.0)) {
+        return false;
+    }
+    if (SideS == 0.0 && SideT == 0.0) {
+        size_t Plane = ProjectPlane(Triangle);
+        Triangle3D Flat;
+        for (size_t k = 0; k < 3; k++) {
+            Flat[k] = Project(Triangle[k], Plane);
+        }
+        return SegmentTriangle2D(Project(S, Plane), Project(T, Plane), Flat);
+    }
+    bool IsPositive = false;
+    bool IsNegative = false;
+    for (size_t k = 0; k < 3; k++) {
+        double Side = Orient3D(S, T, Triangle[k], Triangle[(k + 1) % 3]);
+        IsPositive = IsPositive || Side > 0.0;
+        IsNegative = IsNegative || Side < 0.0;
+    }
+    return !(IsPositive && IsNegative);
+}
+
+/*************************************************************************
+【函数名称】        SegmentTriangle2D
+【函数功能】        投影平面上线段与闭三角形相交判定：端点在三角形内，
+                   或与某条边相交
+【参数】            const Coord3D& S, T：线段端点（已投影）
+                   const Triangle3D& Triangle：三角形（已投影）
+【返回值】          bool，有公共点返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::SegmentTriangle2D(const Coord3D& S, const Coord3D& T,
+    const Triangle3D& Triangle){
+    if (PointInTriangle2D(S, Triangle)) {
+        return true;
+    }
+    for (size_t k = 0; k < 3; k++) {
+        if (Segments2D(S, T, Triangle[k], Triangle[(k + 1) % 3])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*************************************************************************
+【函数名称】        Segments2D
+【函数功能】        投影平面上闭线段AB与CD相交判定：两者互相跨越，或某一
+                   端点与另一线段共线且落在其坐标范围内
+【参数】            const Coord3D& A, B：第一条线段端点
+                   const Coord3D& C, D：第二条线段端点
+【返回值】          bool，有公共点返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::Segments2D(const Coord3D& A, const Coord3D& B,
+    const Coord3D& C, const Coord3D& D){
+    double SideA = Orient2D(C, D, A);
+    double SideB = Orient2D(C, D, B);
+    double SideC = Orient2D(A, B, C);
+    double SideD = Orient2D(A, B, D);
+    if (((SideA > 0.0 && SideB < 0.0) || (SideA < 0.0 && SideB > 0.0))
+        && ((SideC > 0.0 && SideD < 0.0) || (SideC < 0.0 && SideD > 0.0))) {
+        return true;
+    }
+    //共线点P是否落在线段UV的坐标范围内
+    auto IsWithin = [](const Coord3D& U, const Coord3D& V,
+        const Coord3D& P){
+        return std::min(U[0], V[0]) <= P[0] && P[0] <= std::max(U[0], V[0])
+            && std::min(U[1], V[1]) <= P[1] && P[1] <= std::max(U[1], V[1]);
+    };
+    return (SideA == 0.0 && IsWithin(C, D, A))
+        || (SideB == 0.0 && IsWithin(C, D, B))
+        || (SideC == 0.0 && IsWithin(A, B, C))
+        || (SideD == 0.0 && IsWithin(A, B, D));
+}
+
+/*************************************************************************
+【函数名称】        PointInTriangle2D
+【函数功能】        投影平面上点在闭三角形内判定：相对三条边的方位
+                   不同时出现正负（不要求三角形的绕向）
+【参数】            const Coord3D& Point：点（已投影）
+                   const Triangle3D& Triangle：三角形（已投影）
+【返回值】          bool，在三角形内或边上返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool Predicates3D::PointInTriangle2D(const Coord3D& Point,
+    const Triangle3D& Triangle){
+    bool IsPositive = false;
+    bool IsNegative = false;
+    for (size_t k = 0; k < 3; k++) {
+        double Side = Orient2D(Triangle[k], Triangle[(k + 1) % 3], Point);
+        IsPositive = IsPositive || Side > 0.0;
+        IsNegative = IsNegative || Side < 0.0;
+    }
+    return !(IsPositive && IsNegative);
+}
+
+/*************************************************************************
+【函数名称】        Orient3DExact
+【函数功能】        以展开式精确计算det[A - D; B - D; C - D]并取反
+【参数】            const Coord3D& A, B, C, D：四点
+【返回值】          double，展开式最高分量（符号即精确符号）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double Predicates3D::Orient3DExact(const Coord3D& A, const Coord3D& B,
+    const Coord3D& C, const Coord3D& D){
+    Expansion ADX = Difference(A[0], D[0]);
+    Expansion ADY = Difference(A[1], D[1]);
+    Expansion ADZ = Difference(A[2], D[2]);
+    Expansion BDX = Difference(B[0], D[0]);
+    Expansion BDY = Difference(B[1], D[1]);
+    Expansion BDZ = Difference(B[2], D[2]);
+    Expansion CDX = Difference(C[0], D[0]);
+    Expansion CDY = Difference(C[1], D[1]);
+    Expansion CDZ = Difference(C[2], D[2]);
+    Expansion BC = Sum(Product(BDX, CDY), Negate(Product(CDX, BDY)));
+    Expansion CA = Sum(Product(CDX, ADY), Negate(Product(ADX, CDY)));
+    Expansion AB = Sum(Product(ADX, BDY), Negate(Product(BDX, ADY)));
+    Expansion Det = Sum(Sum(Product(ADZ, BC), Product(BDZ, CA)),
+        Product(CDZ, AB));
+    return Det.empty() ? 0.0 : -Det.back();
+}
+
+/*************************************************************************
+【函数名称】        Difference
+【函数功能】        精确差A - B（至多两个分量）
+【参数】            double A, double B
+【返回值】          Expansion，A - B
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Predicates3D::Expansion Predicates3D::Difference(double A, double B){
+    return Grow(Expansion{A}, -B);
+}
+
+/*************************************************************************
+【函数名称】        Grow
+【函数功能】        展开式加一个数，逐分量TwoSum，略去零分量
+【参数】            const Expansion& E：展开式
+                   double B：加数
+【返回值】          Expansion，E + B
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Predicates3D::Expansion Predicates3D::Grow(const Expansion& E, double B){
+    Expansion Result;
+    Result.reserve(E.size() + 1);
+    double Carry = B;
+    for (auto Component : E) {
+        double Error;
+        TwoSum(Carry, Component, Carry, Error);
+        if (Error != 0.0) {
+            Result.push_back(Error);
+        }
+    }
+    if (Carry != 0.0) {
+        Result.push_back(Carry);
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Sum
+【函数功能】        展开式相加（把F的分量逐个加入E）
+【参数】            const Expansion& E, const Expansion& F
+【返回值】          Expansion，E + F
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Predicates3D::Expansion Predicates3D::Sum(const Expansion& E,
+    const Expansion& F){
+    Expansion Result = E;
+    for (auto Component : F) {
+        Result = Grow(Result, Component);
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Product
+【函数功能】        展开式相乘：分量两两TwoProduct，积与误差逐个加入结果
+【参数】            const Expansion& E, const Expansion& F
+【返回值】          Expansion，E·F
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Predicates3D::Expansion Predicates3D::Product(const Expansion& E,
+    const Expansion& F){
+    Expansion Result;
+    for (auto Left : E) {
+        for (auto Right : F) {
+            double Value;
+            double Error;
+            TwoProduct(Left, Right, Value, Error);
+            Result = Grow(Result, Error);
+            Result = Grow(Result, Value);
+        }
+    }
+    return Result;
+}
+
+/*************************************************************************
+【函数名称】        Negate
+【函数功能】        展开式取负（各分量取负仍无重叠）
+【参数】            Expansion E：展开式（按值传入）
+【返回值】          Expansion，-E
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Predicates3D::Expansion Predicates3D::Negate(Expansion E){
+    for (auto& Component : E) {
+        Component = -Component;
+    }
+    return E;
+}
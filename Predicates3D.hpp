@@ -0,0 +1,102 @@
+/*************************************************************************
+【文件名】                 Predicates3D.hpp
+【功能模块和目的】          鲁棒几何谓词类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 增加竖直线穿面判定
+                          梁思奇 2026/10/18 增加三角形相交判定
+*************************************************************************/
+
+#ifndef PREDICATES3D_HPP
+#define PREDICATES3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//std::vector所属头文件
+#include <vector>
+
+/*************************************************************************
+【类名】             Predicates3D
+【功能】             符号精确的几何谓词，供凸包等组合算法做一致判定
+【接口说明】         只含静态函数；先以浮点计算并用静态误差界过滤，
+                    结果可能因舍入而变号时改用浮点展开式精确求值
+                    （Shewchuk无重叠展开式：和与积的舍入误差以
+                    额外分量保存，末分量符号即精确符号）
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 增加竖直线穿面判定：投影包含按
+                    “上-左”规则精确判定，相邻面共享边上的竖直线只穿过
+                    其中一个面，供体素化与点内外判定做奇偶计数
+                    梁思奇 2026/10/18 增加三角形相交判定，只由方位符号
+                    决定，含共面与接触情形
+*************************************************************************/
+class Predicates3D{
+public:
+    //工具类，无需实例
+    Predicates3D() = delete;
+
+    //D相对平面ABC的方位：在法向(B - A)×(C - A)一侧为正，
+    //另一侧为负，共面为0；返回值符号精确，大小为近似的6倍四面体有向体积
+    static double Orient3D(const Coord3D& A, const Coord3D& B,
+        const Coord3D& C, const Coord3D& D);
+
+    //C在XY平面投影上相对有向直线AB的方位（忽略Z）：在左侧（A、B、C
+    //逆时针）为正，右侧为负，共线为0；返回值符号精确，大小为近似的
+    //2倍三角形有向面积
+    static double Orient2D(const Coord3D& A, const Coord3D& B,
+        const Coord3D& C);
+    //过点(X, Y)的竖直线是否穿过三角形（投影边上按“上-左”规则，
+    //竖直的面不穿过），穿过时Z为交点高度
+    static bool CrossColumn(const Triangle3D& Triangle, double X, double Y,
+        double& Z);
+    //自Point向+Z的射线是否穿过三角形：竖直线穿过且Point严格在
+    //三角形所在平面之下（精确判定，Point在平面上时不穿过）
+    static bool CrossAbove(const Triangle3D& Triangle, const Coord3D& Point);
+    //两个闭三角形是否有公共点（接触也算相交）；三点共线的退化三角形
+    //按其各边判定，两个都退化时视为不相交
+    static bool TrianglesIntersect(const Triangle3D& First,
+        const Triangle3D& Second);
+
+    //静态常量：Orient3D浮点结果的相对误差界（(7 + 56ε)ε）
+    static constexpr double ORIENT3D_ERROR_BOUND{7.7715611723761027e-16};
+    //静态常量：Orient2D浮点结果的相对误差界（(3 + 16ε)ε）
+    static constexpr double ORIENT2D_ERROR_BOUND{3.3306690738754716e-16};
+
+private:
+    //浮点展开式：分量无重叠且按绝对值递增，和为所表示的精确值
+    using Expansion = std::vector<double>;
+
+    //竖直线穿过三角形投影时返回投影有向面积（非零，符号同
+    //法向Z分量），Weights为三顶点的未归一重心权重；否则返回0
+    static double CoverColumn(const Triangle3D& Triangle, double X,
+        double Y, std::array<double, 3>& Weights);
+    //三角形在XY、YZ、ZX中投影不退化的平面序号，三点共线时为3
+    static size_t ProjectPlane(const Triangle3D& Triangle);
+    //点投影到序号为Plane的坐标平面（Z置0，坐标原样复制）
+    static Coord3D Project(const Coord3D& Point, size_t Plane);
+    //线段ST与不退化的闭三角形是否有公共点
+    static bool SegmentTriangle(const Coord3D& S, const Coord3D& T,
+        const Triangle3D& Triangle);
+    //投影平面上：线段ST与闭三角形是否有公共点
+    static bool SegmentTriangle2D(const Coord3D& S, const Coord3D& T,
+        const Triangle3D& Triangle);
+    //投影平面上：两条闭线段是否有公共点
+    static bool Segments2D(const Coord3D& A, const Coord3D& B,
+        const Coord3D& C, const Coord3D& D);
+    //投影平面上：点是否在闭三角形内
+    static bool PointInTriangle2D(const Coord3D& Point,
+        const Triangle3D& Triangle);
+    //Orient3D的精确求值
+    static double Orient3DExact(const Coord3D& A, const Coord3D& B,
+        const Coord3D& C, const Coord3D& D);
+    //精确差A - B
+    static Expansion Difference(double A, double B);
+    //展开式加一个数
+    static Expansion Grow(const Expansion& E, double B);
+    //展开式相加
+    static Expansion Sum(const Expansion& E, const Expansion& F);
+    //展开式相乘
+    static Expansion Product(const Expansion& E, const Expansion& F);
+    //展开式取负
+    static Expansion Negate(Expansion E);
+};
+
+#endif //PREDICATES3D_HPP
@@ -0,0 +1,566 @@
+/*************************************************************************
+【文件名】                 SpatialGrid3D.cpp
+【功能模块和目的】          面、线元素均匀网格空间索引类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "SpatialGrid3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::min、std::max、std::find、std::sort所属头文件
+#include <algorithm>
+//std::floor、std::cbrt、std::ceil所属头文件
+#include <cmath>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        构建网格：按元素数确定单元尺寸，并行计算各元素覆盖的
+                   单元范围，再按Z层把单元分给各线程登记元素
+【参数】            const std::vector<Triangle3D>& Triangles：各面三角形
+                   const std::vector<Segment3D>& Segments：各线段
+                   const Coord3D& Min, const Coord3D& Max：网格范围
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::Build(const std::vector<Triangle3D>& Triangles,
+    const std::vector<Segment3D>& Segments,
+    const Coord3D& Min, const Coord3D& Max){
+    m_Triangles = Triangles;
+    m_Segments = Segments;
+    m_ullBuildElementNum = Triangles.size() + Segments.size();
+    m_Origin = Min;
+    //各轴跨度，过扁的轴按最长轴的千分之一计，避免单元尺寸为0
+    Coord3D Extent{0.0, 0.0, 0.0};
+    double MaxExtent = 0.0;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        Extent[Axis] = std::max(Max[Axis] - Min[Axis], 0.0);
+        MaxExtent = std::max(MaxExtent, Extent[Axis]);
+    }
+    m_Resolution = std::array<uint32_t, 3>{{1, 1, 1}};
+    m_InvCellSize = Coord3D{0.0, 0.0, 0.0};
+    if (MaxExtent > 0.0 && m_ullBuildElementNum > 0) {
+        Coord3D Span{0.0, 0.0, 0.0};
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Span[Axis] = std::max(Extent[Axis], MaxExtent * 1e-3);
+        }
+        //单元数约等于元素数（不超过上限）
+        double TargetNum = static_cast<double>(
+            std::min(m_ullBuildElementNum, MAX_CELL_NUM));
+        double CellSize = std::cbrt(Span[0] * Span[1] * Span[2] / TargetNum);
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            double Num = std::ceil(Span[Axis] / CellSize);
+            Num = std::min(std::max(Num, 1.0),
+                static_cast<double>(MAX_AXIS_CELL_NUM));
+            m_Resolution[Axis] = static_cast<uint32_t>(Num);
+        }
+        //向上取整可能使单元总数超过上限，逐轴减半
+        while (static_cast<size_t>(m_Resolution[0]) * m_Resolution[1]
+            * m_Resolution[2] > MAX_CELL_NUM) {
+            for (size_t Axis = 0; Axis < 3; Axis++) {
+                m_Resolution[Axis] = std::max(m_Resolution[Axis] / 2, 1u);
+            }
+        }
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            if (Extent[Axis] > 0.0) {
+                m_InvCellSize[Axis] = m_Resolution[Axis] / Extent[Axis];
+            }
+            else {
+                m_Resolution[Axis] = 1;
+            }
+        }
+    }
+    //并行计算各元素覆盖的单元范围
+    m_FaceRanges.resize(m_Triangles.size());
+    m_LineRanges.resize(m_Segments.size());
+    Parallel::For(0, m_Triangles.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            m_FaceRanges[i] = GetCellRange(m_Triangles[i]);
+        }
+    });
+    Parallel::For(0, m_Segments.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            m_LineRanges[i] = GetCellRange(m_Segments[i]);
+        }
+    });
+    //各线程负责一段Z层，只登记落在本段的部分，单元内按编号升序
+    m_Cells.assign(static_cast<size_t>(m_Resolution[0]) * m_Resolution[1]
+        * m_Resolution[2], std::vector<size_t>{});
+    Parallel::For(0, m_Resolution[2], [&](size_t First, size_t Last){
+        auto Register = [&](size_t ElementID, const CellRange& Range){
+            uint32_t ZBegin = std::max(Range.Min[2],
+                static_cast<uint32_t>(First));
+            uint32_t ZEnd = std::min(Range.Max[2] + 1,
+                static_cast<uint32_t>(Last));
+            for (uint32_t z = ZBegin; z < ZEnd; z++) {
+                for (uint32_t y = Range.Min[1]; y <= Range.Max[1]; y++) {
+                    for (uint32_t x = Range.Min[0]; x <= Range.Max[0]; x++) {
+                        m_Cells[CellIndex(x, y, z)].push_back(ElementID);
+                    }
+                }
+            }
+        };
+        for (size_t i = 0; i < m_FaceRanges.size(); i++) {
+            Register(FaceID(i), m_FaceRanges[i]);
+        }
+        for (size_t i = 0; i < m_LineRanges.size(); i++) {
+            Register(LineID(i), m_LineRanges[i]);
+        }
+    }, 1);
+}
+
+/*************************************************************************
+【函数名称】        InsertFace
+【函数功能】        插入一个面，标签为当前面数
+【参数】            const Triangle3D& Triangle：面的三角形
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::InsertFace(const Triangle3D& Triangle){
+    m_Triangles.push_back(Triangle);
+    m_FaceRanges.push_back(GetCellRange(Triangle));
+    InsertElement(FaceID(m_Triangles.size() - 1), m_FaceRanges.back());
+}
+
+/*************************************************************************
+【函数名称】        InsertLine
+【函数功能】        插入一条线，标签为当前线数
+【参数】            const Segment3D& Segment：线段
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::InsertLine(const Segment3D& Segment){
+    m_Segments.push_back(Segment);
+    m_LineRanges.push_back(GetCellRange(Segment));
+    InsertElement(LineID(m_Segments.size() - 1), m_LineRanges.back());
+}
+
+/*************************************************************************
+【函数名称】        UpdateFace
+【函数功能】        更新指定标签面的坐标，先从旧单元注销再登记到新单元
+【参数】            size_t FaceTag：面标签
+                   const Triangle3D& Triangle：新的三角形
+【返回值】          无，标签越界时不做处理
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::UpdateFace(size_t FaceTag, const Triangle3D& Triangle){
+    if (FaceTag >= m_Triangles.size()) {
+        return;
+    }
+    EraseElement(FaceID(FaceTag), m_FaceRanges[FaceTag]);
+    m_Triangles[FaceTag] = Triangle;
+    m_FaceRanges[FaceTag] = GetCellRange(Triangle);
+    InsertElement(FaceID(FaceTag), m_FaceRanges[FaceTag]);
+}
+
+/*************************************************************************
+【函数名称】        UpdateLine
+【函数功能】        更新指定标签线的坐标，先从旧单元注销再登记到新单元
+【参数】            size_t LineTag：线标签
+                   const Segment3D& Segment：新的线段
+【返回值】          无，标签越界时不做处理
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::UpdateLine(size_t LineTag, const Segment3D& Segment){
+    if (LineTag >= m_Segments.size()) {
+        return;
+    }
+    EraseElement(LineID(LineTag), m_LineRanges[LineTag]);
+    m_Segments[LineTag] = Segment;
+    m_LineRanges[LineTag] = GetCellRange(Segment);
+    InsertElement(LineID(LineTag), m_LineRanges[LineTag]);
+}
+
+/*************************************************************************
+【函数名称】        RemoveFace
+【函数功能】        交换-弹出删除指定标签的面：注销该面，
+                   最后一个面改用被删标签
+【参数】            size_t FaceTag：面标签
+【返回值】          无，标签越界时不做处理
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::RemoveFace(size_t FaceTag){
+    if (FaceTag >= m_Triangles.size()) {
+        return;
+    }
+    EraseElement(FaceID(FaceTag), m_FaceRanges[FaceTag]);
+    size_t LastTag = m_Triangles.size() - 1;
+    if (FaceTag != LastTag) {
+        RenameElement(FaceID(LastTag), FaceID(FaceTag), m_FaceRanges[LastTag]);
+        m_Triangles[FaceTag] = m_Triangles[LastTag];
+        m_FaceRanges[FaceTag] = m_FaceRanges[LastTag];
+    }
+    m_Triangles.pop_back();
+    m_FaceRanges.pop_back();
+}
+
+/*************************************************************************
+【函数名称】        RemoveLine
+【函数功能】        交换-弹出删除指定标签的线：注销该线，
+                   最后一条线改用被删标签
+【参数】            size_t LineTag：线标签
+【返回值】          无，标签越界时不做处理
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::RemoveLine(size_t LineTag){
+    if (LineTag >= m_Segments.size()) {
+        return;
+    }
+    EraseElement(LineID(LineTag), m_LineRanges[LineTag]);
+    size_t LastTag = m_Segments.size() - 1;
+    if (LineTag != LastTag) {
+        RenameElement(LineID(LastTag), LineID(LineTag), m_LineRanges[LastTag]);
+        m_Segments[LineTag] = m_Segments[LastTag];
+        m_LineRanges[LineTag] = m_LineRanges[LastTag];
+    }
+    m_Segments.pop_back();
+    m_LineRanges.pop_back();
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        BoxQuery
+【函数功能】        查询与包围盒相交的面、线：遍历包围盒覆盖的单元，
+                   面用分离轴定理、线用逐轴裁剪精确检验
+【参数】            const Coord3D& Min, const Coord3D& Max：包围盒角点
+                   std::vector<size_t>& FaceTags：相交面标签（重写，升序）
+                   std::vector<size_t>& LineTags：相交线标签（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::BoxQuery(const Coord3D& Min, const Coord3D& Max,
+    std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const{
+    FaceTags.clear();
+    LineTags.clear();
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        if (!(Min[Axis] <= Max[Axis])) {
+            return;
+        }
+    }
+    QueryRange(GetCellRange(Min, Max),
+        [&](size_t Tag){
+            return Geometry3D::TriangleBoxOverlap(m_Triangles[Tag], Min, Max);
+        },
+        [&](size_t Tag){
+            return Geometry3D::SegmentBoxOverlap(m_Segments[Tag], Min, Max);
+        },
+        FaceTags, LineTags);
+}
+
+/*************************************************************************
+【函数名称】        SphereQuery
+【函数功能】        查询与球相交的面、线：遍历球外接盒覆盖的单元，
+                   以元素上距球心最近点的距离精确检验
+【参数】            const Coord3D& Center：球心
+                   double Radius：半径
+                   std::vector<size_t>& FaceTags：相交面标签（重写，升序）
+                   std::vector<size_t>& LineTags：相交线标签（重写，升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::SphereQuery(const Coord3D& Center, double Radius,
+    std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const{
+    FaceTags.clear();
+    LineTags.clear();
+    if (!(Radius >= 0.0)) {
+        return;
+    }
+    double RadiusSquare = Radius * Radius;
+    auto IsInside = [&](const Coord3D& Closest){
+        Coord3D Delta = Geometry3D::Sub(Closest, Center);
+        return Geometry3D::Dot(Delta, Delta) <= RadiusSquare;
+    };
+    Coord3D Min{Center[0] - Radius, Center[1] - Radius, Center[2] - Radius};
+    Coord3D Max{Center[0] + Radius, Center[1] + Radius, Center[2] + Radius};
+    QueryRange(GetCellRange(Min, Max),
+        [&](size_t Tag){
+            return IsInside(Geometry3D::ClosestPointOnTriangle(
+                Center, m_Triangles[Tag]));
+        },
+        [&](size_t Tag){
+            return IsInside(Geometry3D::ClosestPointOnSegment(
+                Center, m_Segments[Tag]));
+        },
+        FaceTags, LineTags);
+}
+
+/*************************************************************************
+【函数名称】        NeedRebuild
+【函数功能】        判断元素数是否相对构建时变化过多（超过2倍或不足1/4），
+                   此时单元尺寸已不合适
+【参数】            无
+【返回值】          bool，建议重建返回true
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool SpatialGrid3D::NeedRebuild() const{
+    size_t ElementNum = m_Triangles.size() + m_Segments.size();
+    return ElementNum > m_ullBuildElementNum * 2 + 64
+        || ElementNum * 4 + 64 < m_ullBuildElementNum;
+}
+
+/*************************************************************************
+【函数名称】        FaceNum
+【函数功能】        获取面数
+【参数】            无
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t SpatialGrid3D::FaceNum() const{
+    return m_Triangles.size();
+}
+
+/*************************************************************************
+【函数名称】        LineNum
+【函数功能】        获取线数
+【参数】            无
+【返回值】          size_t，线数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t SpatialGrid3D::LineNum() const{
+    return m_Segments.size();
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        GetCellRange
+【函数功能】        计算包围盒覆盖的单元范围，超出网格部分截到边界单元
+【参数】            const Coord3D& Min, const Coord3D& Max：包围盒角点
+【返回值】          CellRange，各轴闭区间
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+SpatialGrid3D::CellRange SpatialGrid3D::GetCellRange(
+    const Coord3D& Min, const Coord3D& Max) const{
+    CellRange Range;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        double Last = static_cast<double>(m_Resolution[Axis] - 1);
+        double Low = std::floor((Min[Axis] - m_Origin[Axis])
+            * m_InvCellSize[Axis]);
+        double High = std::floor((Max[Axis] - m_Origin[Axis])
+            * m_InvCellSize[Axis]);
+        //NaN按0处理
+        Low = Low > 0.0 ? std::min(Low, Last) : 0.0;
+        High = High > 0.0 ? std::min(High, Last) : 0.0;
+        Range.Min[Axis] = static_cast<uint32_t>(Low);
+        Range.Max[Axis] = static_cast<uint32_t>(High);
+    }
+    return Range;
+}
+
+/*************************************************************************
+【函数名称】        GetCellRange
+【函数功能】        计算三角形包围盒覆盖的单元范围
+【参数】            const Triangle3D& Triangle：三角形
+【返回值】          CellRange，各轴闭区间
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+SpatialGrid3D::CellRange SpatialGrid3D::GetCellRange(
+    const Triangle3D& Triangle) const{
+    Coord3D Min = Triangle[0];
+    Coord3D Max = Triangle[0];
+    for (size_t k = 1; k < 3; k++) {
+        for (size_t Axis = 0; Axis < 3; Axis++) {
+            Min[Axis] = std::min(Min[Axis], Triangle[k][Axis]);
+            Max[Axis] = std::max(Max[Axis], Triangle[k][Axis]);
+        }
+    }
+    return GetCellRange(Min, Max);
+}
+
+/*************************************************************************
+【函数名称】        GetCellRange
+【函数功能】        计算线段包围盒覆盖的单元范围
+【参数】            const Segment3D& Segment：线段
+【返回值】          CellRange，各轴闭区间
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+SpatialGrid3D::CellRange SpatialGrid3D::GetCellRange(
+    const Segment3D& Segment) const{
+    Coord3D Min = Segment[0];
+    Coord3D Max = Segment[0];
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        Min[Axis] = std::min(Min[Axis], Segment[1][Axis]);
+        Max[Axis] = std::max(Max[Axis], Segment[1][Axis]);
+    }
+    return GetCellRange(Min, Max);
+}
+
+/*************************************************************************
+【函数名称】        CellIndex
+【函数功能】        计算单元线性下标（X最快变化）
+【参数】            uint32_t X, uint32_t Y, uint32_t Z：各轴单元下标
+【返回值】          size_t，线性下标
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t SpatialGrid3D::CellIndex(uint32_t X, uint32_t Y, uint32_t Z) const{
+    return (static_cast<size_t>(Z) * m_Resolution[1] + Y) * m_Resolution[0]
+        + X;
+}
+
+/*************************************************************************
+【函数名称】        InsertElement
+【函数功能】        在范围内各单元登记元素
+【参数】            size_t ElementID：元素编号
+                   const CellRange& Range：单元范围
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::InsertElement(size_t ElementID, const CellRange& Range){
+    //未构建的空网格视为单个单元
+    if (m_Cells.empty()) {
+        m_Cells.resize(1);
+    }
+    for (uint32_t z = Range.Min[2]; z <= Range.Max[2]; z++) {
+        for (uint32_t y = Range.Min[1]; y <= Range.Max[1]; y++) {
+            for (uint32_t x = Range.Min[0]; x <= Range.Max[0]; x++) {
+                m_Cells[CellIndex(x, y, z)].push_back(ElementID);
+            }
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        EraseElement
+【函数功能】        从范围内各单元注销元素（单元内交换-弹出）
+【参数】            size_t ElementID：元素编号
+                   const CellRange& Range：单元范围
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::EraseElement(size_t ElementID, const CellRange& Range){
+    for (uint32_t z = Range.Min[2]; z <= Range.Max[2]; z++) {
+        for (uint32_t y = Range.Min[1]; y <= Range.Max[1]; y++) {
+            for (uint32_t x = Range.Min[0]; x <= Range.Max[0]; x++) {
+                std::vector<size_t>& Cell = m_Cells[CellIndex(x, y, z)];
+                auto It = std::find(Cell.begin(), Cell.end(), ElementID);
+                if (It != Cell.end()) {
+                    *It = Cell.back();
+                    Cell.pop_back();
+                }
+            }
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        RenameElement
+【函数功能】        把范围内各单元中的元素编号改为新编号
+【参数】            size_t OldID：原编号
+                   size_t NewID：新编号
+                   const CellRange& Range：单元范围
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void SpatialGrid3D::RenameElement(
+    size_t OldID, size_t NewID, const CellRange& Range){
+    for (uint32_t z = Range.Min[2]; z <= Range.Max[2]; z++) {
+        for (uint32_t y = Range.Min[1]; y <= Range.Max[1]; y++) {
+            for (uint32_t x = Range.Min[0]; x <= Range.Max[0]; x++) {
+                std::vector<size_t>& Cell = m_Cells[CellIndex(x, y, z)];
+                auto It = std::find(Cell.begin(), Cell.end(), OldID);
+                if (It != Cell.end()) {
+                    *It = NewID;
+                }
+            }
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        QueryRange
+【函数功能】        遍历区域覆盖的单元：元素只在其范围与区域范围交集的
+                   最小角单元处检验一次，无需去重表
+【参数】            const CellRange& Range：区域覆盖的单元范围
+                   FACETEST IsFaceHit：面精确检验
+                   LINETEST IsLineHit：线精确检验
+                   std::vector<size_t>& FaceTags：命中面标签（追加后升序）
+                   std::vector<size_t>& LineTags：命中线标签（追加后升序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<class FACETEST, class LINETEST>
+void SpatialGrid3D::QueryRange(const CellRange& Range, FACETEST IsFaceHit,
+    LINETEST IsLineHit, std::vector<size_t>& FaceTags,
+    std::vector<size_t>& LineTags) const{
+    if (m_Cells.empty()) {
+        return;
+    }
+    //元素在当前单元处检验当且仅当当前单元为交集最小角
+    auto IsFirstCell = [&](const CellRange& Element, uint32_t X, uint32_t Y,
+        uint32_t Z){
+        return std::max(Element.Min[0], Range.Min[0]) == X
+            && std::max(Element.Min[1], Range.Min[1]) == Y
+            && std::max(Element.Min[2], Range.Min[2]) == Z;
+    };
+    for (uint32_t z = Range.Min[2]; z <= Range.Max[2]; z++) {
+        for (uint32_t y = Range.Min[1]; y <= Range.Max[1]; y++) {
+            for (uint32_t x = Range.Min[0]; x <= Range.Max[0]; x++) {
+                for (auto ElementID : m_Cells[CellIndex(x, y, z)]) {
+                    size_t Tag = ElementID >> 1;
+                    if ((ElementID & 1) == 0) {
+                        if (IsFirstCell(m_FaceRanges[Tag], x, y, z)
+                            && IsFaceHit(Tag)) {
+                            FaceTags.push_back(Tag);
+                        }
+                    }
+                    else {
+                        if (IsFirstCell(m_LineRanges[Tag], x, y, z)
+                            && IsLineHit(Tag)) {
+                            LineTags.push_back(Tag);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    std::sort(FaceTags.begin(), FaceTags.end());
+    std::sort(LineTags.begin(), LineTags.end());
+}
+
+/*************************************************************************
+【函数名称】        FaceID
+【函数功能】        由面标签得到元素编号
+【参数】            size_t FaceTag：面标签
+【返回值】          size_t，元素编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t SpatialGrid3D::FaceID(size_t FaceTag){
+    return FaceTag << 1;
+}
+
+/*************************************************************************
+【函数名称】        LineID
+【函数功能】        由线标签得到元素编号
+【参数】            size_t LineTag：线标签
+【返回值】          size_t，元素编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t SpatialGrid3D::LineID(size_t LineTag){
+    return (LineTag << 1) | 1;
+}
@@ -0,0 +1,138 @@
+/*************************************************************************
+【文件名】                 SpatialGrid3D.hpp
+【功能模块和目的】          面、线元素均匀网格空间索引类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef SPATIALGRID3D_HPP
+#define SPATIALGRID3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//uint32_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+
+/*************************************************************************
+【类名】             SpatialGrid3D
+【功能】             面、线元素的均匀网格空间索引，加速包围盒与球区域查询
+【接口说明】         网格范围取构建时的包围长方体，单元尺寸使单元数约等于
+                    元素数；每个元素登记到其包围盒覆盖的全部单元，
+                    超出网格范围的部分归入边界单元，查询结果仍精确；
+                    构建时各线程分别负责不同Z层单元，无需加锁；
+                    支持插入、按标签更新与交换-弹出删除（与Model3D标签
+                    约定一致），元素数偏离构建时过多时提示重建；
+                    查询只返回面、线标签（升序），不拷贝Face3D、Line3D对象
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class SpatialGrid3D{
+public:
+    //默认构造函数，空网格
+    SpatialGrid3D() = default;
+    //拷贝构造函数
+    SpatialGrid3D(const SpatialGrid3D& Source) = default;
+    //虚析构函数
+    virtual ~SpatialGrid3D() = default;
+    //赋值运算符
+    SpatialGrid3D& operator=(const SpatialGrid3D& Source) = default;
+
+    //Setter
+    //由三角形与线段（下标即面、线标签）在指定范围上并行构建
+    void Build(const std::vector<Triangle3D>& Triangles,
+        const std::vector<Segment3D>& Segments,
+        const Coord3D& Min, const Coord3D& Max);
+    //插入一个面，标签为当前面数
+    void InsertFace(const Triangle3D& Triangle);
+    //插入一条线，标签为当前线数
+    void InsertLine(const Segment3D& Segment);
+    //更新指定标签面的坐标
+    void UpdateFace(size_t FaceTag, const Triangle3D& Triangle);
+    //更新指定标签线的坐标
+    void UpdateLine(size_t LineTag, const Segment3D& Segment);
+    //交换-弹出删除指定标签的面（最后一个面接替该标签）
+    void RemoveFace(size_t FaceTag);
+    //交换-弹出删除指定标签的线（最后一条线接替该标签）
+    void RemoveLine(size_t LineTag);
+
+    //Getter
+    //与包围盒（含边界）相交的面、线标签
+    void BoxQuery(const Coord3D& Min, const Coord3D& Max,
+        std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const;
+    //与球（含边界）相交的面、线标签
+    void SphereQuery(const Coord3D& Center, double Radius,
+        std::vector<size_t>& FaceTags, std::vector<size_t>& LineTags) const;
+    //元素数相对构建时变化过多，建议重建
+    bool NeedRebuild() const;
+    //面数
+    size_t FaceNum() const;
+    //线数
+    size_t LineNum() const;
+
+    //静态常量：单元总数上限
+    static constexpr size_t MAX_CELL_NUM{1u << 21};
+    //静态常量：单轴单元数上限
+    static constexpr uint32_t MAX_AXIS_CELL_NUM{1024};
+
+private:
+    //元素覆盖的单元范围（各轴闭区间）
+    class CellRange{
+    public:
+        //各轴最小单元下标
+        std::array<uint32_t, 3> Min;
+        //各轴最大单元下标
+        std::array<uint32_t, 3> Max;
+    };
+
+    //包围盒覆盖的单元范围（超出网格部分截到边界单元）
+    CellRange GetCellRange(const Coord3D& Min, const Coord3D& Max) const;
+    //三角形覆盖的单元范围
+    CellRange GetCellRange(const Triangle3D& Triangle) const;
+    //线段覆盖的单元范围
+    CellRange GetCellRange(const Segment3D& Segment) const;
+    //单元线性下标
+    size_t CellIndex(uint32_t X, uint32_t Y, uint32_t Z) const;
+    //在范围内各单元登记元素
+    void InsertElement(size_t ElementID, const CellRange& Range);
+    //从范围内各单元注销元素
+    void EraseElement(size_t ElementID, const CellRange& Range);
+    //把范围内各单元中的元素编号改为新编号
+    void RenameElement(size_t OldID, size_t NewID, const CellRange& Range);
+    //遍历区域覆盖的单元，每个元素只检验一次，
+    //IsFaceHit(Tag)、IsLineHit(Tag)做精确检验
+    template<class FACETEST, class LINETEST>
+    void QueryRange(const CellRange& Range, FACETEST IsFaceHit,
+        LINETEST IsLineHit, std::vector<size_t>& FaceTags,
+        std::vector<size_t>& LineTags) const;
+
+    //元素编号：标签×2 + 类型（0为面，1为线）
+    static size_t FaceID(size_t FaceTag);
+    static size_t LineID(size_t LineTag);
+
+    //各单元登记的元素编号
+    std::vector<std::vector<size_t>> m_Cells{};
+    //各面坐标
+    std::vector<Triangle3D> m_Triangles{};
+    //各面覆盖的单元范围
+    std::vector<CellRange> m_FaceRanges{};
+    //各线坐标
+    std::vector<Segment3D> m_Segments{};
+    //各线覆盖的单元范围
+    std::vector<CellRange> m_LineRanges{};
+    //网格最小角点
+    Coord3D m_Origin{{0.0, 0.0, 0.0}};
+    //各轴单元尺寸倒数
+    Coord3D m_InvCellSize{{0.0, 0.0, 0.0}};
+    //各轴单元数
+    std::array<uint32_t, 3> m_Resolution{{1, 1, 1}};
+    //构建时的元素数
+    size_t m_ullBuildElementNum{0};
+};
+
+#endif //SPATIALGRID3D_HPP
@@ -0,0 +1,393 @@
+/*************************************************************************
+【文件名】                 VertexIncidence3D.cpp
+【功能模块和目的】          顶点到相邻面、线的关联索引类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+//自身类头文件
+#include "VertexIncidence3D.hpp"
+//uint64_t所属头文件
+#include <cstdint>
+//std::memcpy所属头文件
+#include <cstring>
+//std::find所属头文件
+#include <algorithm>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        由网格索引构建：沿用其顶点（字典序）与元素顶点下标，
+                   再依次登记各面、线到顶点的相邻表
+【参数】            const MeshIndex3D& Index：网格索引（标签同Model3D）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::Build(const MeshIndex3D& Index){
+    m_Vertices = Index.Vertices;
+    m_FaceVertices = Index.FaceVertices;
+    m_LineVertices = Index.LineVertices;
+    //构建时的顶点可二分查找，哈希表只登记之后新增的顶点
+    m_ullSortedNum = m_Vertices.size();
+    m_VertexMap.clear();
+    m_VertexFaces.assign(m_Vertices.size(), std::vector<size_t>());
+    m_VertexLines.assign(m_Vertices.size(), std::vector<size_t>());
+    for (size_t i = 0; i < m_FaceVertices.size(); i++) {
+        for (auto Vertex : m_FaceVertices[i]) {
+            m_VertexFaces[Vertex].push_back(i);
+        }
+    }
+    for (size_t i = 0; i < m_LineVertices.size(); i++) {
+        for (auto Vertex : m_LineVertices[i]) {
+            m_VertexLines[Vertex].push_back(i);
+        }
+    }
+    m_ullIsolatedNum = 0;
+}
+
+/*************************************************************************
+【函数名称】        InsertFace
+【函数功能】        插入一个面（标签为当前面数）并登记到其顶点
+【参数】            const Triangle3D& Triangle：三顶点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::InsertFace(const Triangle3D& Triangle){
+    m_FaceVertices.push_back({AcquireVertex(Triangle[0]),
+        AcquireVertex(Triangle[1]), AcquireVertex(Triangle[2])});
+    AttachFace(m_FaceVertices.size() - 1);
+}
+
+/*************************************************************************
+【函数名称】        UpdateFace
+【函数功能】        更新指定标签面的坐标：从旧顶点移除、登记到新顶点
+【参数】            size_t FaceTag：面标签（调用者保证不越界）
+                   const Triangle3D& Triangle：新三顶点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::UpdateFace(size_t FaceTag,
+    const Triangle3D& Triangle){
+    DetachFace(FaceTag);
+    for (size_t k = 0; k < 3; k++) {
+        m_FaceVertices[FaceTag][k] = AcquireVertex(Triangle[k]);
+    }
+    AttachFace(FaceTag);
+}
+
+/*************************************************************************
+【函数名称】        RemoveFace
+【函数功能】        交换-弹出删除指定标签的面：最后一个面移到该标签，
+                   其顶点的相邻面表同步改名
+【参数】            size_t FaceTag：面标签（调用者保证不越界）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::RemoveFace(size_t FaceTag){
+    DetachFace(FaceTag);
+    size_t LastTag = m_FaceVertices.size() - 1;
+    if (FaceTag != LastTag) {
+        for (auto Vertex : m_FaceVertices[LastTag]) {
+            std::vector<size_t>& Faces = m_VertexFaces[Vertex];
+            *std::find(Faces.begin(), Faces.end(), LastTag) = FaceTag;
+        }
+        m_FaceVertices[FaceTag] = m_FaceVertices[LastTag];
+    }
+    m_FaceVertices.pop_back();
+}
+
+/*************************************************************************
+【函数名称】        InsertLine
+【函数功能】        插入一条线（标签为当前线数）并登记到其顶点
+【参数】            const Segment3D& Segment：两端点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::InsertLine(const Segment3D& Segment){
+    m_LineVertices.push_back({AcquireVertex(Segment[0]),
+        AcquireVertex(Segment[1])});
+    AttachLine(m_LineVertices.size() - 1);
+}
+
+/*************************************************************************
+【函数名称】        UpdateLine
+【函数功能】        更新指定标签线的坐标：从旧顶点移除、登记到新顶点
+【参数】            size_t LineTag：线标签（调用者保证不越界）
+                   const Segment3D& Segment：新两端点坐标
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::UpdateLine(size_t LineTag,
+    const Segment3D& Segment){
+    DetachLine(LineTag);
+    for (size_t k = 0; k < 2; k++) {
+        m_LineVertices[LineTag][k] = AcquireVertex(Segment[k]);
+    }
+    AttachLine(LineTag);
+}
+
+/*************************************************************************
+【函数名称】        RemoveLine
+【函数功能】        交换-弹出删除指定标签的线：最后一条线移到该标签，
+                   其顶点的相邻线表同步改名
+【参数】            size_t LineTag：线标签（调用者保证不越界）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::RemoveLine(size_t LineTag){
+    DetachLine(LineTag);
+    size_t LastTag = m_LineVertices.size() - 1;
+    if (LineTag != LastTag) {
+        for (auto Vertex : m_LineVertices[LastTag]) {
+            std::vector<size_t>& Lines = m_VertexLines[Vertex];
+            *std::find(Lines.begin(), Lines.end(), LastTag) = LineTag;
+        }
+        m_LineVertices[LineTag] = m_LineVertices[LastTag];
+    }
+    m_LineVertices.pop_back();
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        NeedRebuild
+【函数功能】        判断孤立顶点是否过多（删改后遗留），过多时建议重建
+                   以回收空间
+【参数】            无
+【返回值】          需要重建返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool VertexIncidence3D::NeedRebuild() const{
+    return m_ullIsolatedNum >= REBUILD_ISOLATED_MIN
+        && m_ullIsolatedNum * 2 > m_Vertices.size();
+}
+
+/*************************************************************************
+【函数名称】        FaceNum
+【函数功能】        获取面数
+【参数】            无
+【返回值】          size_t，面数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VertexIncidence3D::FaceNum() const{
+    return m_FaceVertices.size();
+}
+
+/*************************************************************************
+【函数名称】        LineNum
+【函数功能】        获取线数
+【参数】            无
+【返回值】          size_t，线数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VertexIncidence3D::LineNum() const{
+    return m_LineVertices.size();
+}
+
+/*************************************************************************
+【函数名称】        VertexNum
+【函数功能】        获取顶点数（含孤立顶点）
+【参数】            无
+【返回值】          size_t，顶点数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VertexIncidence3D::VertexNum() const{
+    return m_Vertices.size();
+}
+
+/*************************************************************************
+【函数名称】        FindVertex
+【函数功能】        查找坐标完全相同的顶点：先在构建时的顶点中按字典序
+                   二分查找，再查新增顶点的哈希表
+【参数】            const Coord3D& Point：坐标
+                   size_t& Vertex：找到时为顶点编号
+【返回值】          找到返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool VertexIncidence3D::FindVertex(const Coord3D& Point,
+    size_t& Vertex) const{
+    auto It = std::lower_bound(m_Vertices.begin(),
+        m_Vertices.begin() + m_ullSortedNum, Point);
+    if (It != m_Vertices.begin() + m_ullSortedNum && *It == Point) {
+        Vertex = static_cast<size_t>(It - m_Vertices.begin());
+        return true;
+    }
+    auto MapIt = m_VertexMap.find(Point);
+    if (MapIt == m_VertexMap.end()) {
+        return false;
+    }
+    Vertex = MapIt->second;
+    return true;
+}
+
+/*************************************************************************
+【函数名称】        VertexFaces
+【函数功能】        获取指定顶点的相邻面标签
+【参数】            size_t Vertex：顶点编号（调用者保证不越界）
+【返回值】          const std::vector<size_t>&，相邻面标签（无序）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::vector<size_t>& VertexIncidence3D::VertexFaces(
+    size_t Vertex) const{
+    return m_VertexFaces[Vertex];
+}
+
+/*************************************************************************
+【函数名称】        VertexLines
+【函数功能】        获取指定顶点的相邻线标签
+【参数】            size_t Vertex：顶点编号（调用者保证不越界）
+【返回值】          const std::vector<size_t>&，相邻线标签（无序）
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::vector<size_t>& VertexIncidence3D::VertexLines(
+    size_t Vertex) const{
+    return m_VertexLines[Vertex];
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        CoordHash::operator()
+【函数功能】        坐标哈希：三个分量的位模式乘大奇数后异或，
+                   -0.0先规整为0.0，使与相等比较一致
+【参数】            const Coord3D& Point：坐标
+【返回值】          size_t，哈希值
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VertexIncidence3D::CoordHash::operator()(const Coord3D& Point) const{
+    const uint64_t Multipliers[3] = {0x9E3779B97F4A7C15ull,
+        0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull};
+    uint64_t Hash = 0;
+    for (size_t Axis = 0; Axis < 3; Axis++) {
+        double Value = Point[Axis] == 0.0 ? 0.0 : Point[Axis];
+        uint64_t Bits;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+        Hash ^= Bits * Multipliers[Axis];
+    }
+    return static_cast<size_t>(Hash ^ (Hash >> 29));
+}
+
+/*************************************************************************
+【函数名称】        AcquireVertex
+【函数功能】        查找坐标对应的顶点，不存在时新建孤立顶点并登记到
+                   哈希表
+【参数】            const Coord3D& Point：坐标
+【返回值】          size_t，顶点编号
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VertexIncidence3D::AcquireVertex(const Coord3D& Point){
+    size_t Vertex;
+    if (FindVertex(Point, Vertex)) {
+        return Vertex;
+    }
+    Vertex = m_Vertices.size();
+    m_VertexMap.emplace(Point, Vertex);
+    m_Vertices.push_back(Point);
+    m_VertexFaces.emplace_back();
+    m_VertexLines.emplace_back();
+    m_ullIsolatedNum++;
+    return Vertex;
+}
+
+/*************************************************************************
+【函数名称】        AttachFace
+【函数功能】        把面登记到其三个顶点的相邻面表
+【参数】            size_t FaceTag：面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::AttachFace(size_t FaceTag){
+    for (auto Vertex : m_FaceVertices[FaceTag]) {
+        if (IsIsolated(Vertex)) {
+            m_ullIsolatedNum--;
+        }
+        m_VertexFaces[Vertex].push_back(FaceTag);
+    }
+}
+
+/*************************************************************************
+【函数名称】        DetachFace
+【函数功能】        把面从其三个顶点的相邻面表移除（交换-弹出）
+【参数】            size_t FaceTag：面标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::DetachFace(size_t FaceTag){
+    for (auto Vertex : m_FaceVertices[FaceTag]) {
+        std::vector<size_t>& Faces = m_VertexFaces[Vertex];
+        auto It = std::find(Faces.begin(), Faces.end(), FaceTag);
+        *It = Faces.back();
+        Faces.pop_back();
+        if (IsIsolated(Vertex)) {
+            m_ullIsolatedNum++;
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        AttachLine
+【函数功能】        把线登记到其两个顶点的相邻线表
+【参数】            size_t LineTag：线标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::AttachLine(size_t LineTag){
+    for (auto Vertex : m_LineVertices[LineTag]) {
+        if (IsIsolated(Vertex)) {
+            m_ullIsolatedNum--;
+        }
+        m_VertexLines[Vertex].push_back(LineTag);
+    }
+}
+
+/*************************************************************************
+【函数名称】        DetachLine
+【函数功能】        把线从其两个顶点的相邻线表移除（交换-弹出）
+【参数】            size_t LineTag：线标签
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VertexIncidence3D::DetachLine(size_t LineTag){
+    for (auto Vertex : m_LineVertices[LineTag]) {
+        std::vector<size_t>& Lines = m_VertexLines[Vertex];
+        auto It = std::find(Lines.begin(), Lines.end(), LineTag);
+        *It = Lines.back();
+        Lines.pop_back();
+        if (IsIsolated(Vertex)) {
+            m_ullIsolatedNum++;
+        }
+    }
+}
+
+/*************************************************************************
+【函数名称】        IsIsolated
+【函数功能】        判断顶点是否没有相邻面与相邻线
+【参数】            size_t Vertex：顶点编号
+【返回值】          孤立返回true，否则返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool VertexIncidence3D::IsIsolated(size_t Vertex) const{
+    return m_VertexFaces[Vertex].empty() && m_VertexLines[Vertex].empty();
+}
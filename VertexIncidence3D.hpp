@@ -0,0 +1,121 @@
+/*************************************************************************
+【文件名】                 VertexIncidence3D.hpp
+【功能模块和目的】          顶点到相邻面、线的关联索引类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+
+#ifndef VERTEXINCIDENCE3D_HPP
+#define VERTEXINCIDENCE3D_HPP
+
+//轻量坐标类型所属头文件
+#include "Geometry3D.hpp"
+//MeshIndex3D类所属头文件
+#include "MeshIndex3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::unordered_map所属头文件
+#include <unordered_map>
+
+/*************************************************************************
+【类名】             VertexIncidence3D
+【功能】             顶点关联索引：坐标完全相同的点为同一顶点，记录每个
+                    顶点的相邻面与相邻线标签
+【接口说明】         由网格索引构建（O(n)），顶点编号为索引自有编号，
+                    可由坐标查找：构建时的顶点沿用网格索引的字典序，
+                    二分查找，之后新增的顶点登记在哈希表中；
+                    支持面、线的插入、按标签更新与交换-弹出删除（与
+                    Model3D标签约定一致），每次只改动所涉顶点的相邻表，
+                    O(顶点度数)；孤立顶点过多时提示重建
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+class VertexIncidence3D{
+public:
+    //默认构造函数，空索引
+    VertexIncidence3D() = default;
+    //拷贝构造函数
+    VertexIncidence3D(const VertexIncidence3D& Source) = default;
+    //虚析构函数
+    virtual ~VertexIncidence3D() = default;
+    //赋值运算符
+    VertexIncidence3D& operator=(const VertexIncidence3D& Source) = default;
+
+    //Setter
+    //由网格索引构建（面、线标签同网格索引）
+    void Build(const MeshIndex3D& Index);
+    //插入一个面，标签为当前面数
+    void InsertFace(const Triangle3D& Triangle);
+    //更新指定标签面的坐标
+    void UpdateFace(size_t FaceTag, const Triangle3D& Triangle);
+    //交换-弹出删除指定标签的面（最后一个面接替该标签）
+    void RemoveFace(size_t FaceTag);
+    //插入一条线，标签为当前线数
+    void InsertLine(const Segment3D& Segment);
+    //更新指定标签线的坐标
+    void UpdateLine(size_t LineTag, const Segment3D& Segment);
+    //交换-弹出删除指定标签的线（最后一条线接替该标签）
+    void RemoveLine(size_t LineTag);
+
+    //Getter
+    //孤立顶点过多，建议重建
+    bool NeedRebuild() const;
+    //面数
+    size_t FaceNum() const;
+    //线数
+    size_t LineNum() const;
+    //顶点数（含孤立顶点）
+    size_t VertexNum() const;
+    //查找坐标完全相同的顶点，找到返回true
+    bool FindVertex(const Coord3D& Point, size_t& Vertex) const;
+    //指定顶点的相邻面标签（无序）
+    const std::vector<size_t>& VertexFaces(size_t Vertex) const;
+    //指定顶点的相邻线标签（无序）
+    const std::vector<size_t>& VertexLines(size_t Vertex) const;
+
+    //静态常量：孤立顶点不少于该数且超过顶点数一半时建议重建
+    static constexpr size_t REBUILD_ISOLATED_MIN{4096};
+
+private:
+    //坐标哈希（±0视为相同）
+    class CoordHash{
+    public:
+        size_t operator()(const Coord3D& Point) const;
+    };
+
+    //查找或新建坐标对应的顶点
+    size_t AcquireVertex(const Coord3D& Point);
+    //把面登记到其三个顶点的相邻面表
+    void AttachFace(size_t FaceTag);
+    //把面从其三个顶点的相邻面表移除
+    void DetachFace(size_t FaceTag);
+    //把线登记到其两个顶点的相邻线表
+    void AttachLine(size_t LineTag);
+    //把线从其两个顶点的相邻线表移除
+    void DetachLine(size_t LineTag);
+    //顶点是否没有相邻面与相邻线
+    bool IsIsolated(size_t Vertex) const;
+
+    //顶点坐标
+    std::vector<Coord3D> m_Vertices{};
+    //每个面的三个顶点编号
+    std::vector<std::array<size_t, 3>> m_FaceVertices{};
+    //每条线的两个顶点编号
+    std::vector<std::array<size_t, 2>> m_LineVertices{};
+    //每个顶点的相邻面标签
+    std::vector<std::vector<size_t>> m_VertexFaces{};
+    //每个顶点的相邻线标签
+    std::vector<std::vector<size_t>> m_VertexLines{};
+    //构建时的顶点数（这些顶点按坐标字典序排列）
+    size_t m_ullSortedNum{0};
+    //构建后新增顶点的坐标到顶点编号
+    std::unordered_map<Coord3D, size_t, CoordHash> m_VertexMap{};
+    //孤立顶点（无相邻面、线）数
+    size_t m_ullIsolatedNum{0};
+};
+
+#endif //VERTEXINCIDENCE3D_HPP
@@ -3,6 +3,9 @@
 【功能模块和目的】          界面类实现
 【开发者及日期】            梁思奇 2024/8/11
 【更改记录】               梁思奇 2024/8/13 改进功能函数实现方式
+                          梁思奇 2026/10/18 导入模型时可选焊接顶点
+                          梁思奇 2026/10/18 模型信息显示体积、质心与惯性张量
+                          梁思奇 2026/10/18 增加模型整体变换菜单
 *************************************************************************/
 
 //自身类头文件
@@ -15,6 +18,8 @@
 #include <memory>
 //控制器类所属头文件
 #include "Controller.hpp"
+//std::array所属头文件
+#include <array>
 //使用std命名空间
 using namespace std;
 
@@ -169,7 +174,7 @@ string View::CreateNewModelMenu() const{
 【参数】            无
 【返回值】          空字符串string
 【开发者及日期】    梁思奇 2024/8/11
-【更改记录】         
+【更改记录】        梁思奇 2026/10/18 增加焊接容差输入
 *************************************************************************/
 string View::ImportModelMenu() const{
     //获取控制器实例指针
@@ -211,7 +216,12 @@ string View::ImportModelMenu() const{
         size_t Tag;
         cin >> Tag;
         cin.get();
-        RES Temp = CtrlerPtr->ImportModel(FileName, Tag);
+        //提示用户输入焊接容差，相距不超过容差的点合并为一点
+        cout << "Weld tolerance(0 to keep points as read):";
+        double Tolerance = 0.0;
+        cin >> Tolerance;
+        cin.get();
+        RES Temp = CtrlerPtr->ImportModel(FileName, Tag, Tolerance);
         //如果导入失败，显示错误信息
         if (Temp != RES::SUCCESS) {
             cout << CtrlerPtr->RESNAME[static_cast<size_t>(Temp)] << endl;
@@ -452,7 +462,7 @@ string View::ChooseModelMenu() const{
 【参数】            无
 【返回值】          空字符串string
 【开发者及日期】    梁思奇 2024/8/11
-【更改记录】
+【更改记录】        梁思奇 2026/10/18 增加模型整体变换
 *************************************************************************/
 string View::ModifyModelMenu() const{
     //获取控制器实例指针
@@ -462,7 +472,7 @@ string View::ModifyModelMenu() const{
     //用户选择的操作数，初始化为0（无效值）
     int InputNumber = 0;
     //当前菜单循环显示，用户不跳转菜单时停留此界面
-    while (InputNumber != 8) {
+    while (InputNumber != 9) {
         //显示编辑模型菜单
         cout << "-----Modify Current Model-----" << endl;
         //如果没有选择模型
@@ -498,9 +508,11 @@ string View::ModifyModelMenu() const{
         cout << "5. Add Line" << endl;        
         cout << "6. Change Line Points" << endl;
         cout << "7. Delete Line" << endl;
-        cout << "8. Go Back Main Menu" << endl;
+        cout << "Model Operation:" << endl;
+        cout << "8. Transform Model" << endl;
+        cout << "9. Go Back Main Menu" << endl;
         cout << "Please choose the operation number:" << endl;
-        cout << "(1/2/3/4/5/6/7/8):";
+        cout << "(1/2/3/4/5/6/7/8/9):";
         //获取用户输入
         getline(cin, UserInput);
         //尝试将用户输入转换为整数
@@ -534,10 +546,13 @@ string View::ModifyModelMenu() const{
                 cout << DeleteLineMenu() << endl;
                 break;
             case 8 :
+                cout << TransformModelMenu() << endl;
+                break;
+            case 9 :
                 //返回主菜单
                 break; 
             default :
-                cout << "Invalid input, please enter a number between 1-8!"
+                cout << "Invalid input, please enter a number between 1-9!"
                     << endl;
                 //无效输入，重置为0以继续显示菜单
                 InputNumber = 0; 
@@ -557,7 +572,8 @@ string View::ModifyModelMenu() const{
 【参数】            无
 【返回值】          空字符串string
 【开发者及日期】    梁思奇 2024/8/11
-【更改记录】
+【更改记录】        梁思奇 2026/10/18 显示体积、质心与惯性张量
+                   梁思奇 2026/10/18 改为只获取当前模型信息
 *************************************************************************/
 string View::ListModelInfoMenu() const{
     //获取控制器实例指针
@@ -568,25 +584,39 @@ string View::ListModelInfoMenu() const{
     while (UserInput != "Y" && UserInput != "y") {
         //显示列出模型信息菜单
         cout << "-----List Current Model All Infomation-----" << endl;
-        //模型信息列表
-        ModelInfoList InfoList;
-        //调用控制器功能获取模型信息
-        CtrlerPtr->ShowAllModels(InfoList);
+        //当前模型信息
+        ModelInfo TempModel{};
+        //调用控制器功能获取当前模型信息（含质量属性）
+        CtrlerPtr->ShowThisModel(TempModel);
         //当前模型标签
         cout << "Current model: Model[" << CtrlerPtr->ChosenModelTag 
             << "]" << endl;
         cout << "Name: "
-            << InfoList[CtrlerPtr->ChosenModelTag].Name << endl;
+            << TempModel.Name << endl;
         cout << "Count face number: "
-            << InfoList[CtrlerPtr->ChosenModelTag].FaceNumber << endl;
+            << TempModel.FaceNumber << endl;
         cout << "Sum face area: "
-            << InfoList[CtrlerPtr->ChosenModelTag].AreaSum << endl;
+            << TempModel.AreaSum << endl;
         cout << "Count line number: "
-            << InfoList[CtrlerPtr->ChosenModelTag].LineNumber << endl;
+            << TempModel.LineNumber << endl;
         cout << "Sum line length: "
-            << InfoList[CtrlerPtr->ChosenModelTag].LengthSum << endl;
+            << TempModel.LengthSum << endl;
         cout << "EncaseBox volume: "
-            << InfoList[CtrlerPtr->ChosenModelTag].Volume << endl;
+            << TempModel.Volume << endl;
+        //质量属性（封闭网格有效）
+        cout << "Enclosed volume: " << TempModel.SignedVolume << endl;
+        cout << "Surface centroid: (" << TempModel.SurfaceCentroid.X 
+            << ", " << TempModel.SurfaceCentroid.Y 
+            << ", " << TempModel.SurfaceCentroid.Z << ")" << endl;
+        cout << "Volume centroid: (" << TempModel.VolumeCentroid.X 
+            << ", " << TempModel.VolumeCentroid.Y 
+            << ", " << TempModel.VolumeCentroid.Z << ")" << endl;
+        cout << "Inertia tensor:" << endl;
+        for (size_t Row = 0; Row < 3; Row++) {
+            cout << "  " << TempModel.Inertia[Row][0] 
+                << " " << TempModel.Inertia[Row][1] 
+                << " " << TempModel.Inertia[Row][2] << endl;
+        }
         //面信息列表
         FaceInfoList FaceInfoList;
         //调用控制器功能得到模型所有面信息
@@ -1090,3 +1120,135 @@ string View::DeleteLineMenu() const{
     //返回空字符串，回到ModifyModelMenu
     return "";
 }
+
+/*************************************************************************
+【函数名称】        TransformModelMenu
+【函数功能】        显示模型整体变换菜单，用户选择平移、旋转、缩放或一般
+                   仿射变换并输入参数，对当前模型的全部点做变换，之后
+                   显示新的面积、长度总和与包围长方体；用户可以选择返回
+                   上一级菜单或继续变换
+【参数】            无
+【返回值】          空字符串string
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+string View::TransformModelMenu() const{
+    //获取控制器实例指针
+    shared_ptr<Controller> CtrlerPtr = Controller::GetControllerPtr();
+    //用户输入
+    string UserInput;
+    //当前菜单循环显示，用户不跳转菜单时停留此界面
+    while (UserInput != "Y" && UserInput != "y") {
+        //显示模型整体变换菜单
+        cout << "-----Transform Model-----" << endl;
+        cout << "1. Translate" << endl;
+        cout << "2. Rotate around an axis through the origin" << endl;
+        cout << "3. Scale about the origin" << endl;
+        cout << "4. General affine matrix" << endl;
+        cout << "Please choose the transform number:" << endl;
+        cout << "(1/2/3/4):";
+        //获取用户输入
+        getline(cin, UserInput);
+        //用户选择的变换，初始化为0（无效值）
+        int InputNumber = 0;
+        //尝试将用户输入转换为整数
+        try {
+            InputNumber = stoi(UserInput);
+        } catch (...) {
+            //无效输入
+            InputNumber = 0;
+        }
+        //变换结果
+        RES Temp = RES::SUCCESS;
+        //根据用户输入读取参数并调用相应的控制器功能
+        switch (InputNumber) {
+            case 1 : {
+                double DX;
+                double DY;
+                double DZ;
+                cout << "Offset.X :";
+                cin >> DX;
+                cout << "Offset.Y :";
+                cin >> DY;
+                cout << "Offset.Z :";
+                cin >> DZ;
+                cin.get();
+                Temp = CtrlerPtr->ModelTranslate(DX, DY, DZ);
+                break;
+            }
+            case 2 : {
+                double AxisX;
+                double AxisY;
+                double AxisZ;
+                double Degree;
+                cout << "Axis.X :";
+                cin >> AxisX;
+                cout << "Axis.Y :";
+                cin >> AxisY;
+                cout << "Axis.Z :";
+                cin >> AxisZ;
+                cout << "Angle (degree) :";
+                cin >> Degree;
+                cin.get();
+                Temp = CtrlerPtr->ModelRotate(AxisX, AxisY, AxisZ, Degree);
+                break;
+            }
+            case 3 : {
+                double Factor;
+                cout << "Factor :";
+                cin >> Factor;
+                cin.get();
+                Temp = CtrlerPtr->ModelScale(Factor);
+                break;
+            }
+            case 4 : {
+                //末行固定为(0, 0, 0, 1)
+                array<double, 16> Matrix{};
+                Matrix[15] = 1.0;
+                cout << "Please enter the first 3 rows of the matrix:" 
+                    << endl;
+                for (size_t Row = 0; Row < 3; Row++) {
+                    for (size_t Column = 0; Column < 4; Column++) {
+                        cout << "M[" << Row << "][" << Column << "] :";
+                        cin >> Matrix[4 * Row + Column];
+                    }
+                }
+                cin.get();
+                Temp = CtrlerPtr->ModelTransform(Matrix);
+                break;
+            }
+            default :
+                cout << "Invalid input, please enter a number between 1-4!"
+                    << endl;
+                break;
+        }
+        //如果变换失败，显示错误信息
+        if (Temp != RES::SUCCESS) {
+            cout << CtrlerPtr->RESNAME[static_cast<size_t>(Temp)] << endl;
+        }
+        //变换成功时显示新的面积、长度总和与包围长方体
+        else if (InputNumber >= 1 && InputNumber <= 4) {
+            //模型信息列表
+            ModelInfoList InfoList;
+            CtrlerPtr->ShowAllModels(InfoList);
+            const ModelInfo& TempModel = InfoList[CtrlerPtr->ChosenModelTag];
+            cout << "Sum face area: " << TempModel.AreaSum << endl;
+            cout << "Sum line length: " << TempModel.LengthSum << endl;
+            cout << "EncaseBox volume: " << TempModel.Volume << endl;
+        }
+        //清空输入
+        UserInput.clear();
+        //用户选择是否返回上一级菜单
+        while (UserInput != "Y" && UserInput != "y" 
+            && UserInput != "N" && UserInput != "n") {
+            cout << endl << "Go back to ModifyModelMenu?" << endl;
+            cout << "Enter Y(Yes) to go back" << endl;
+            cout << "Enter N(No) to apply another transform" << endl;
+            cout << "(Y/N):";
+            //获取用户输入
+            getline(cin, UserInput);
+        }
+    }
+    //返回空字符串，回到ModifyModelMenu
+    return "";
+}
@@ -3,6 +3,7 @@
 【功能模块和目的】          界面类声明
 【开发者及日期】            梁思奇 2024/8/11
 【更改记录】               梁思奇 2024/8/13 改进功能函数实现方式
+                          梁思奇 2026/10/18 增加模型整体变换菜单
 *************************************************************************/
 
 #ifndef VIEW_HPP
@@ -18,6 +19,7 @@
                     增删改各类元素等控制器功能的显示窗口
 【开发者及日期】     梁思奇 2024/8/11
 【更改记录】         梁思奇 2024/8/13 改进功能函数实现方式
+                    梁思奇 2026/10/18 增加模型整体变换菜单
 *************************************************************************/
 class View{
 public:
@@ -64,6 +66,9 @@ public:
     std::string ChangeLinePointMenu() const;
     //显示删除线菜单
     std::string DeleteLineMenu() const;
+    //模型整体变换
+    //显示平移、旋转、缩放或仿射变换模型菜单
+    std::string TransformModelMenu() const;
 };
 
 #endif //VIEW_HPP
@@ -0,0 +1,602 @@
+/*************************************************************************
+【文件名】                 VoxelGrid3D.cpp
+【功能模块和目的】          稀疏分块位图体素网格类实现
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 竖直线穿面判定移入Predicates3D
+*************************************************************************/
+
+//自身类头文件
+#include "VoxelGrid3D.hpp"
+//Predicates3D类所属头文件
+#include "Predicates3D.hpp"
+//并行工具类所属头文件
+#include "Parallel.hpp"
+//std::floor、std::ceil、std::abs所属头文件
+#include <cmath>
+//std::min、std::max、std::sort、std::lower_bound、std::any_of所属头文件
+#include <algorithm>
+//std::numeric_limits所属头文件
+#include <limits>
+//std::bitset所属头文件
+#include <bitset>
+
+//Setter函数实现
+
+/*************************************************************************
+【函数名称】        Build
+【函数功能】        体素化：网格范围取三角形的包围长方体，先做表面体素化，
+                   需要时再按奇偶规则填充内部，最后合并存储
+【参数】            const std::vector<Triangle3D>& Triangles：三角形
+                   double VoxelSize：体素边长
+                   bool IsSolid：是否填充内部
+【返回值】          bool，成功返回true；三角形为空、边长不为正或单轴
+                   体素数超过上限时返回false，网格为空
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool VoxelGrid3D::Build(const std::vector<Triangle3D>& Triangles,
+    double VoxelSize, bool IsSolid){
+    m_BlockKeys.clear();
+    m_Blocks.clear();
+    m_ullVoxelNum = 0;
+    m_Resolution = {{0, 0, 0}};
+    if (Triangles.empty() || !(VoxelSize > 0.0)) {
+        return false;
+    }
+    //包围长方体（并行归约）
+    const double Inf = std::numeric_limits<double>::infinity();
+    using Box = std::array<Coord3D, 2>;
+    Box Bounds = Parallel::Reduce(0, Triangles.size(),
+        Box{{{{Inf, Inf, Inf}}, {{-Inf, -Inf, -Inf}}}},
+        [&](size_t First, size_t Last){
+        Box Local{{{{Inf, Inf, Inf}}, {{-Inf, -Inf, -Inf}}}};
+        for (size_t i = First; i < Last; i++) {
+            for (const Coord3D& Vertex : Triangles[i]) {
+                for (size_t a = 0; a < 3; a++) {
+                    Local[0][a] = std::min(Local[0][a], Vertex[a]);
+                    Local[1][a] = std::max(Local[1][a], Vertex[a]);
+                }
+            }
+        }
+        return Local;
+    }, [](const Box& Lhs, const Box& Rhs){
+        Box Result;
+        for (size_t a = 0; a < 3; a++) {
+            Result[0][a] = std::min(Lhs[0][a], Rhs[0][a]);
+            Result[1][a] = std::max(Lhs[1][a], Rhs[1][a]);
+        }
+        return Result;
+    });
+    for (size_t a = 0; a < 3; a++) {
+        double Extent = (Bounds[1][a] - Bounds[0][a]) / VoxelSize;
+        if (!(Extent < static_cast<double>(MAX_AXIS_VOXEL_NUM))) {
+            m_Resolution = {{0, 0, 0}};
+            return false;
+        }
+        m_Resolution[a] = static_cast<size_t>(Extent) + 1;
+    }
+    m_Origin = Bounds[0];
+    m_rVoxelSize = VoxelSize;
+    std::vector<KeyedBlock> Blocks;
+    VoxelizeSurface(Triangles, Blocks);
+    if (IsSolid) {
+        FillSolid(Triangles, Blocks);
+    }
+    Store(Blocks);
+    return true;
+}
+
+//Getter函数实现
+
+/*************************************************************************
+【函数名称】        Test
+【函数功能】        判断体素是否被占据：二分查找所在块后取位
+【参数】            size_t X, size_t Y, size_t Z：体素下标
+【返回值】          bool，被占据返回true，超出网格返回false
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+bool VoxelGrid3D::Test(size_t X, size_t Y, size_t Z) const{
+    if (X >= m_Resolution[0] || Y >= m_Resolution[1]
+        || Z >= m_Resolution[2]) {
+        return false;
+    }
+    uint64_t Key = BlockKey(X / BLOCK_EDGE, Y / BLOCK_EDGE, Z / BLOCK_EDGE);
+    auto It = std::lower_bound(m_BlockKeys.begin(), m_BlockKeys.end(), Key);
+    if (It == m_BlockKeys.end() || *It != Key) {
+        return false;
+    }
+    const Block& Bits = m_Blocks[It - m_BlockKeys.begin()];
+    return (Bits[Y % BLOCK_EDGE] >> ((X % BLOCK_EDGE) * BLOCK_EDGE
+        + Z % BLOCK_EDGE)) & 1;
+}
+
+/*************************************************************************
+【函数名称】        VoxelCenter
+【函数功能】        获取体素中心坐标
+【参数】            size_t X, size_t Y, size_t Z：体素下标
+【返回值】          Coord3D，体素中心
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+Coord3D VoxelGrid3D::VoxelCenter(size_t X, size_t Y, size_t Z) const{
+    return {{m_Origin[0] + (static_cast<double>(X) + 0.5) * m_rVoxelSize,
+        m_Origin[1] + (static_cast<double>(Y) + 0.5) * m_rVoxelSize,
+        m_Origin[2] + (static_cast<double>(Z) + 0.5) * m_rVoxelSize}};
+}
+
+/*************************************************************************
+【函数名称】        Origin
+【函数功能】        获取网格最小角点
+【参数】            无
+【返回值】          const Coord3D&，网格最小角点
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const Coord3D& VoxelGrid3D::Origin() const{
+    return m_Origin;
+}
+
+/*************************************************************************
+【函数名称】        VoxelSize
+【函数功能】        获取体素边长
+【参数】            无
+【返回值】          double，体素边长
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+double VoxelGrid3D::VoxelSize() const{
+    return m_rVoxelSize;
+}
+
+/*************************************************************************
+【函数名称】        Resolution
+【函数功能】        获取各轴体素数
+【参数】            无
+【返回值】          const std::array<size_t, 3>&，各轴体素数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+const std::array<size_t, 3>& VoxelGrid3D::Resolution() const{
+    return m_Resolution;
+}
+
+/*************************************************************************
+【函数名称】        VoxelNum
+【函数功能】        获取被占据的体素数
+【参数】            无
+【返回值】          size_t，被占据的体素数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VoxelGrid3D::VoxelNum() const{
+    return m_ullVoxelNum;
+}
+
+/*************************************************************************
+【函数名称】        BlockNum
+【函数功能】        获取存储的块数
+【参数】            无
+【返回值】          size_t，块数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VoxelGrid3D::BlockNum() const{
+    return m_Blocks.size();
+}
+
+/*************************************************************************
+【函数名称】        MemoryBytes
+【函数功能】        获取块存储（块与键）占用的字节数
+【参数】            无
+【返回值】          size_t，字节数
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+size_t VoxelGrid3D::MemoryBytes() const{
+    return m_Blocks.size() * (sizeof(Block) + sizeof(uint64_t));
+}
+
+//私有函数实现
+
+/*************************************************************************
+【函数名称】        BlockSlab::Reset
+【函数功能】        设定目录尺寸并清空缓冲区
+【参数】            size_t Width：第一轴块数
+                   size_t Depth：第二轴块数
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VoxelGrid3D::BlockSlab::Reset(size_t Width, size_t Depth){
+    this->Width = Width;
+    Directory.assign(Width * Depth, 0);
+    Blocks.clear();
+    Touched.clear();
+}
+
+/*************************************************************************
+【函数名称】        BlockSlab::At
+【函数功能】        取目录(A, B)处的块，不存在时新建全零块并登记
+【参数】            size_t A：第一轴块下标
+                   size_t B：第二轴块下标
+【返回值】          Block&，块
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+VoxelGrid3D::Block& VoxelGrid3D::BlockSlab::At(size_t A, size_t B){
+    size_t Index = B * Width + A;
+    if (Directory[Index] == 0) {
+        Blocks.push_back(Block{});
+        Touched.push_back(Index);
+        Directory[Index] = static_cast<uint32_t>(Blocks.size());
+    }
+    return Blocks[Directory[Index] - 1];
+}
+
+/*************************************************************************
+【函数名称】        BlockSlab::Drain
+【函数功能】        依次取出已建的块及其目录下标，只清理用到的目录项
+【参数】            std::vector<std::pair<size_t, Block>>& Output：
+                   取出的块（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VoxelGrid3D::BlockSlab::Drain(
+    std::vector<std::pair<size_t, Block>>& Output){
+    Output.clear();
+    for (size_t i = 0; i < Blocks.size(); i++) {
+        Output.emplace_back(Touched[i], Blocks[i]);
+        Directory[Touched[i]] = 0;
+    }
+    Blocks.clear();
+    Touched.clear();
+}
+
+/*************************************************************************
+【函数名称】        BlockKey
+【函数功能】        块坐标打包为键：各轴21位，Z最高、X最低
+【参数】            size_t BX, size_t BY, size_t BZ：块坐标
+【返回值】          uint64_t，键
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+uint64_t VoxelGrid3D::BlockKey(size_t BX, size_t BY, size_t BZ){
+    return (static_cast<uint64_t>(BZ) << 42)
+        | (static_cast<uint64_t>(BY) << 21) | static_cast<uint64_t>(BX);
+}
+
+/*************************************************************************
+【函数名称】        Bucket
+【函数功能】        并行计数排序：单元按块分给各线程，各块分别对所跨越的
+                   桶计数，按（桶，块）顺序求前缀和后并行填入，
+                   桶内单元保持下标升序
+【参数】            size_t Num：单元数
+                   size_t BucketNum：桶数
+                   SPAN Span：Span(i)返回单元i跨越的桶区间（左闭右开）
+                   std::vector<size_t>& Starts：各桶起点（会被重写）
+                   std::vector<size_t>& Items：各桶单元（会被重写）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+template<class SPAN>
+void VoxelGrid3D::Bucket(size_t Num, size_t BucketNum, SPAN Span,
+    std::vector<size_t>& Starts, std::vector<size_t>& Items){
+    const size_t ChunkNum = std::max(size_t{1}, std::min(
+        Parallel::ThreadCount(), (Num + Parallel::DEFAULT_MIN_CHUNK - 1)
+        / Parallel::DEFAULT_MIN_CHUNK));
+    const size_t ChunkSize = (Num + ChunkNum - 1) / ChunkNum;
+    std::vector<size_t> Offsets(ChunkNum * BucketNum, 0);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t* Counts = Offsets.data() + c * BucketNum;
+            size_t End = std::min(Num, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                std::array<size_t, 2> Range = Span(i);
+                for (size_t b = Range[0]; b < Range[1]; b++) {
+                    Counts[b]++;
+                }
+            }
+        }
+    }, 1);
+    Starts.assign(BucketNum + 1, 0);
+    size_t Total = 0;
+    for (size_t b = 0; b < BucketNum; b++) {
+        Starts[b] = Total;
+        for (size_t c = 0; c < ChunkNum; c++) {
+            size_t Count = Offsets[c * BucketNum + b];
+            Offsets[c * BucketNum + b] = Total;
+            Total += Count;
+        }
+    }
+    Starts[BucketNum] = Total;
+    Items.resize(Total);
+    Parallel::For(0, ChunkNum, [&](size_t First, size_t Last){
+        for (size_t c = First; c < Last; c++) {
+            size_t* Cursors = Offsets.data() + c * BucketNum;
+            size_t End = std::min(Num, (c + 1) * ChunkSize);
+            for (size_t i = c * ChunkSize; i < End; i++) {
+                std::array<size_t, 2> Range = Span(i);
+                for (size_t b = Range[0]; b < Range[1]; b++) {
+                    Items[Cursors[b]++] = i;
+                }
+            }
+        }
+    }, 1);
+}
+
+/*************************************************************************
+【函数名称】        VoxelizeSurface
+【函数功能】        表面体素化：面按所跨越的Z向块层分桶，各块层并行处理；
+                   对面包围盒内的每行体素，先由面所在平面与盒的距离
+                   条件求出X向可能相交的区间（前后各放宽一个体素），
+                   区间内尚未占据的体素再做三角形-盒分离轴检验
+【参数】            const std::vector<Triangle3D>& Triangles：三角形
+                   std::vector<KeyedBlock>& Output：结果块（追加）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VoxelGrid3D::VoxelizeSurface(const std::vector<Triangle3D>& Triangles,
+    std::vector<KeyedBlock>& Output) const{
+    const double Size = m_rVoxelSize;
+    auto ToVoxel = [&](double Value, size_t Axis){
+        double Index = std::floor((Value - m_Origin[Axis]) / Size);
+        Index = std::min(std::max(Index, 0.0),
+            static_cast<double>(m_Resolution[Axis] - 1));
+        return static_cast<size_t>(Index);
+    };
+    //各面包围盒覆盖的体素范围：各轴最小下标与最大下标（闭区间）
+    std::vector<std::array<uint32_t, 6>> Ranges(Triangles.size());
+    Parallel::For(0, Triangles.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            const Triangle3D& T = Triangles[i];
+            for (size_t a = 0; a < 3; a++) {
+                auto Range = std::minmax({T[0][a], T[1][a], T[2][a]});
+                Ranges[i][a] = static_cast<uint32_t>(ToVoxel(Range.first, a));
+                Ranges[i][a + 3]
+                    = static_cast<uint32_t>(ToVoxel(Range.second, a));
+            }
+        }
+    });
+    const size_t BX = (m_Resolution[0] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    const size_t BY = (m_Resolution[1] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    const size_t BZ = (m_Resolution[2] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    std::vector<size_t> Starts;
+    std::vector<size_t> Items;
+    Bucket(Triangles.size(), BZ, [&](size_t i){
+        return std::array<size_t, 2>{{Ranges[i][2] / BLOCK_EDGE,
+            Ranges[i][5] / BLOCK_EDGE + 1}};
+    }, Starts, Items);
+    //各块层的结果，最后按层顺序拼接
+    std::vector<std::vector<KeyedBlock>> Results(BZ);
+    Parallel::For(0, BZ, [&](size_t First, size_t Last){
+        BlockSlab Slab;
+        Slab.Reset(BX, BY);
+        std::vector<std::pair<size_t, Block>> Drained;
+        for (size_t bz = First; bz < Last; bz++) {
+            size_t ZBegin = bz * BLOCK_EDGE;
+            size_t ZEnd = std::min(m_Resolution[2], ZBegin + BLOCK_EDGE);
+            for (size_t p = Starts[bz]; p < Starts[bz + 1]; p++) {
+                const Triangle3D& T = Triangles[Items[p]];
+                const std::array<uint32_t, 6>& R = Ranges[Items[p]];
+                //平面与盒相交当且仅当|Normal·Center - Offset| ≤ Radius
+                Coord3D Normal = Geometry3D::Cross(
+                    Geometry3D::Sub(T[1], T[0]), Geometry3D::Sub(T[2], T[0]));
+                double Offset = Geometry3D::Dot(Normal, T[0]);
+                double Radius = 0.5 * Size * (std::abs(Normal[0])
+                    + std::abs(Normal[1]) + std::abs(Normal[2]));
+                size_t ZFirst = std::max<size_t>(R[2], ZBegin);
+                size_t ZLast = std::min<size_t>(R[5] + size_t{1}, ZEnd);
+                for (size_t z = ZFirst; z < ZLast; z++) {
+                    double CZ = m_Origin[2] + (z + 0.5) * Size;
+                    for (size_t y = R[1]; y <= R[4]; y++) {
+                        double CY = m_Origin[1] + (y + 0.5) * Size;
+                        size_t XFirst = R[0];
+                        size_t XLast = R[3];
+                        if (Normal[0] != 0.0) {
+                            double Rest = Offset - Normal[1] * CY
+                                - Normal[2] * CZ;
+                            double A = (Rest - Radius) / Normal[0];
+                            double B = (Rest + Radius) / Normal[0];
+                            if (A > B) {
+                                std::swap(A, B);
+                            }
+                            A = std::floor((A - m_Origin[0]) / Size - 0.5);
+                            B = std::ceil((B - m_Origin[0]) / Size - 0.5);
+                            XFirst = std::max(XFirst, static_cast<size_t>(
+                                std::max(A - 1.0, 0.0)));
+                            XLast = std::min(XLast, static_cast<size_t>(
+                                std::max(B + 1.0, 0.0)));
+                        }
+                        for (size_t x = XFirst; x <= XLast; x++) {
+                            uint64_t& Word = Slab.At(x / BLOCK_EDGE,
+                                y / BLOCK_EDGE)[y % BLOCK_EDGE];
+                            uint64_t Bit = uint64_t{1} << ((x % BLOCK_EDGE)
+                                * BLOCK_EDGE + z % BLOCK_EDGE);
+                            if (Word & Bit) {
+                                continue;
+                            }
+                            Coord3D Min{{m_Origin[0] + x * Size,
+                                m_Origin[1] + y * Size, CZ - 0.5 * Size}};
+                            Coord3D Max{{Min[0] + Size, Min[1] + Size,
+                                CZ + 0.5 * Size}};
+                            if (Geometry3D::TriangleBoxOverlap(T, Min, Max)) {
+                                Word |= Bit;
+                            }
+                        }
+                    }
+                }
+            }
+            Slab.Drain(Drained);
+            for (const auto& Item : Drained) {
+                Results[bz].emplace_back(BlockKey(Item.first % BX,
+                    Item.first / BX, bz), Item.second);
+            }
+        }
+    }, 1);
+    for (const std::vector<KeyedBlock>& Result : Results) {
+        Output.insert(Output.end(), Result.begin(), Result.end());
+    }
+}
+
+/*************************************************************************
+【函数名称】        FillSolid
+【函数功能】        奇偶填充：面按其投影覆盖的体素中心列所在的Y向块行分桶，
+                   各块行并行处理；每行体素中心的竖直射线收集与各面的
+                   交点高度，按列排序后两两配对，中心在每对之间的体素
+                   被填充（同一块内一列的填充为一次按位或）
+【参数】            const std::vector<Triangle3D>& Triangles：三角形
+                   std::vector<KeyedBlock>& Output：结果块（追加）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VoxelGrid3D::FillSolid(const std::vector<Triangle3D>& Triangles,
+    std::vector<KeyedBlock>& Output) const{
+    const double Size = m_rVoxelSize;
+    //中心落在[Low, High]内的体素下标区间（左闭右开）
+    auto CenterRange = [&](double Low, double High, size_t Axis){
+        double First = std::ceil((Low - m_Origin[Axis]) / Size - 0.5);
+        double Last = std::floor((High - m_Origin[Axis]) / Size - 0.5);
+        First = std::max(First, 0.0);
+        Last = std::min(Last, static_cast<double>(m_Resolution[Axis] - 1));
+        if (First > Last) {
+            return std::array<size_t, 2>{{0, 0}};
+        }
+        return std::array<size_t, 2>{{static_cast<size_t>(First),
+            static_cast<size_t>(Last) + 1}};
+    };
+    //各面投影覆盖的体素中心列：X区间与Y区间（左闭右开）
+    std::vector<std::array<size_t, 4>> Columns(Triangles.size());
+    Parallel::For(0, Triangles.size(), [&](size_t First, size_t Last){
+        for (size_t i = First; i < Last; i++) {
+            const Triangle3D& T = Triangles[i];
+            auto XRange = std::minmax({T[0][0], T[1][0], T[2][0]});
+            auto YRange = std::minmax({T[0][1], T[1][1], T[2][1]});
+            std::array<size_t, 2> X = CenterRange(XRange.first,
+                XRange.second, 0);
+            std::array<size_t, 2> Y = CenterRange(YRange.first,
+                YRange.second, 1);
+            Columns[i] = {{X[0], X[1], Y[0], Y[1]}};
+        }
+    });
+    const size_t BX = (m_Resolution[0] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    const size_t BY = (m_Resolution[1] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    const size_t BZ = (m_Resolution[2] + BLOCK_EDGE - 1) / BLOCK_EDGE;
+    std::vector<size_t> Starts;
+    std::vector<size_t> Items;
+    Bucket(Triangles.size(), BY, [&](size_t i){
+        if (Columns[i][0] == Columns[i][1]
+            || Columns[i][2] == Columns[i][3]) {
+            return std::array<size_t, 2>{{0, 0}};
+        }
+        return std::array<size_t, 2>{{Columns[i][2] / BLOCK_EDGE,
+            (Columns[i][3] - 1) / BLOCK_EDGE + 1}};
+    }, Starts, Items);
+    std::vector<std::vector<KeyedBlock>> Results(BY);
+    Parallel::For(0, BY, [&](size_t First, size_t Last){
+        BlockSlab Slab;
+        Slab.Reset(BX, BZ);
+        std::vector<std::pair<size_t, Block>> Drained;
+        //一行射线的交点（列下标，高度）
+        std::vector<std::pair<size_t, double>> Crossings;
+        for (size_t by = First; by < Last; by++) {
+            size_t YEnd = std::min(m_Resolution[1], (by + 1) * BLOCK_EDGE);
+            for (size_t y = by * BLOCK_EDGE; y < YEnd; y++) {
+                double CY = m_Origin[1] + (y + 0.5) * Size;
+                Crossings.clear();
+                for (size_t p = Starts[by]; p < Starts[by + 1]; p++) {
+                    const Triangle3D& T = Triangles[Items[p]];
+                    const std::array<size_t, 4>& C = Columns[Items[p]];
+                    if (y < C[2] || y >= C[3]) {
+                        continue;
+                    }
+                    for (size_t x = C[0]; x < C[1]; x++) {
+                        double Z = 0.0;
+                        if (Predicates3D::CrossColumn(T,
+                            m_Origin[0] + (x + 0.5) * Size, CY, Z)) {
+                            Crossings.emplace_back(x, Z);
+                        }
+                    }
+                }
+                std::sort(Crossings.begin(), Crossings.end());
+                //同一列的交点两两配对，填充中心在每对之间的体素
+                for (size_t p = 0; p + 1 < Crossings.size(); p++) {
+                    if (Crossings[p + 1].first != Crossings[p].first) {
+                        continue;
+                    }
+                    size_t x = Crossings[p].first;
+                    std::array<size_t, 2> Z = CenterRange(
+                        Crossings[p].second, Crossings[p + 1].second, 2);
+                    for (size_t z = Z[0]; z < Z[1];) {
+                        size_t Stop = std::min(Z[1],
+                            (z / BLOCK_EDGE + 1) * BLOCK_EDGE);
+                        uint64_t Bits = ((uint64_t{1} << (Stop - z)) - 1)
+                            << (z % BLOCK_EDGE);
+                        Slab.At(x / BLOCK_EDGE, z / BLOCK_EDGE)
+                            [y % BLOCK_EDGE] |= Bits << ((x % BLOCK_EDGE)
+                            * BLOCK_EDGE);
+                        z = Stop;
+                    }
+                    p++;
+                }
+            }
+            Slab.Drain(Drained);
+            for (const auto& Item : Drained) {
+                Results[by].emplace_back(BlockKey(Item.first % BX, by,
+                    Item.first / BX), Item.second);
+            }
+        }
+    }, 1);
+    for (const std::vector<KeyedBlock>& Result : Results) {
+        Output.insert(Output.end(), Result.begin(), Result.end());
+    }
+}
+
+/*************************************************************************
+【函数名称】        Store
+【函数功能】        块按键并行排序，同键的块按位或合并，全零的块丢弃，
+                   之后并行统计被占据的体素数
+【参数】            std::vector<KeyedBlock>& Blocks：块（会被排序）
+【返回值】          无
+【开发者及日期】    梁思奇 2026/10/18
+【更改记录】
+*************************************************************************/
+void VoxelGrid3D::Store(std::vector<KeyedBlock>& Blocks){
+    Parallel::Sort(Blocks.begin(), Blocks.end(),
+        [](const KeyedBlock& Lhs, const KeyedBlock& Rhs){
+        return Lhs.first < Rhs.first;
+    });
+    m_BlockKeys.clear();
+    m_Blocks.clear();
+    for (const KeyedBlock& Item : Blocks) {
+        if (!std::any_of(Item.second.begin(), Item.second.end(),
+            [](uint64_t Word){ return Word != 0; })) {
+            continue;
+        }
+        if (!m_BlockKeys.empty() && m_BlockKeys.back() == Item.first) {
+            for (size_t w = 0; w < BLOCK_EDGE; w++) {
+                m_Blocks.back()[w] |= Item.second[w];
+            }
+        }
+        else {
+            m_BlockKeys.push_back(Item.first);
+            m_Blocks.push_back(Item.second);
+        }
+    }
+    m_ullVoxelNum = Parallel::Reduce(0, m_Blocks.size(), size_t{0},
+        [&](size_t First, size_t Last){
+        size_t Count = 0;
+        for (size_t i = First; i < Last; i++) {
+            for (uint64_t Word : m_Blocks[i]) {
+                Count += std::bitset<64>(Word).count();
+            }
+        }
+        return Count;
+    }, [](size_t Lhs, size_t Rhs){
+        return Lhs + Rhs;
+    });
+}
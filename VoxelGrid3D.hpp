@@ -0,0 +1,143 @@
+/*************************************************************************
+【文件名】                 VoxelGrid3D.hpp
+【功能模块和目的】          稀疏分块位图体素网格类声明
+【开发者及日期】            梁思奇 2026/10/18
+【更改记录】               梁思奇 2026/10/18 竖直线穿面判定移入Predicates3D
+*************************************************************************/
+
+#ifndef VOXELGRID3D_HPP
+#define VOXELGRID3D_HPP
+
+//轻量坐标类型与几何内核所属头文件
+#include "Geometry3D.hpp"
+//size_t所属头文件
+#include <cstddef>
+//uint32_t、uint64_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::array所属头文件
+#include <array>
+//std::pair所属头文件
+#include <utility>
+
+/*************************************************************************
+【类名】             VoxelGrid3D
+【功能】             三角形集合的体素化结果：轴对齐、边长相等的体素网格，
+                    每个体素一位
+【接口说明】         网格范围取三角形的包围长方体，体素(X, Y, Z)占据
+                    [Origin + (X, Y, Z) × VoxelSize, 再加VoxelSize)；
+                    存储按8×8×8的块分块，每块512位（8个64位字，第y%8个
+                    字的第(x%8) × 8 + z%8位），只存含有体素的块，块按
+                    键（块坐标按Z、Y、X优先级打包）升序排列，查询二分；
+                    表面体素化：面按所跨越的Z向块层分桶（并行计数排序），
+                    各线程分别负责不同块层，面包围盒内每行体素先由面所在
+                    平面缩小X范围，再做三角形-盒分离轴检验，无需加锁；
+                    实体体素化：在表面体素之外，沿Z向穿过各体素中心的
+                    竖直射线按奇偶规则填充内部：面按所覆盖的Y向块行
+                    分桶，各线程分别负责不同块行，射线是否穿过面的投影
+                    由精确的二维方位判定，恰在投影边上时按“上-左”规则
+                    只归入共享该边的两个面之一，封闭网格的每条射线因此
+                    穿过偶数次；不封闭处多余的一次穿过被忽略
+【开发者及日期】      梁思奇 2026/10/18
+【更改记录】         梁思奇 2026/10/18 竖直线穿面判定改用
+                    Predicates3D::CrossColumn，与点内外判定共用
+*************************************************************************/
+class VoxelGrid3D{
+public:
+    //默认构造函数，空网格
+    VoxelGrid3D() = default;
+    //拷贝构造函数
+    VoxelGrid3D(const VoxelGrid3D& Source) = default;
+    //虚析构函数
+    virtual ~VoxelGrid3D() = default;
+    //赋值运算符
+    VoxelGrid3D& operator=(const VoxelGrid3D& Source) = default;
+
+    //Setter
+    //以边长VoxelSize体素化三角形集合，IsSolid为true时填充内部；
+    //三角形为空、边长不为正或单轴体素数超过MAX_AXIS_VOXEL_NUM时
+    //返回false，网格为空
+    bool Build(const std::vector<Triangle3D>& Triangles, double VoxelSize,
+        bool IsSolid);
+
+    //Getter
+    //体素(X, Y, Z)是否被占据，超出网格时为false
+    bool Test(size_t X, size_t Y, size_t Z) const;
+    //体素中心坐标
+    Coord3D VoxelCenter(size_t X, size_t Y, size_t Z) const;
+    //网格最小角点
+    const Coord3D& Origin() const;
+    //体素边长
+    double VoxelSize() const;
+    //各轴体素数
+    const std::array<size_t, 3>& Resolution() const;
+    //被占据的体素数
+    size_t VoxelNum() const;
+    //存储的块数
+    size_t BlockNum() const;
+    //块存储占用的字节数
+    size_t MemoryBytes() const;
+
+    //静态常量：块的边长（体素数）
+    static constexpr size_t BLOCK_EDGE{8};
+    //静态常量：单轴体素数上限
+    static constexpr size_t MAX_AXIS_VOXEL_NUM{size_t{1} << 20};
+
+private:
+    //一个块：512位
+    using Block = std::array<uint64_t, BLOCK_EDGE>;
+    //带键的块
+    using KeyedBlock = std::pair<uint64_t, Block>;
+    //一层（或一行）块的构建缓冲区：二维目录指向已建的块，
+    //各线程各用一个，换层时只清理用到的目录项
+    class BlockSlab{
+    public:
+        //设定目录尺寸（两轴块数）并清空
+        void Reset(size_t Width, size_t Depth);
+        //取目录(A, B)处的块，不存在时新建全零块
+        Block& At(size_t A, size_t B);
+        //依次取出已建的块（目录下标与块），并清空
+        void Drain(std::vector<std::pair<size_t, Block>>& Output);
+
+        //目录宽度（第一轴块数）
+        size_t Width{0};
+        //目录：块在Blocks中的下标加1，0表示无块
+        std::vector<uint32_t> Directory{};
+        //已建的块
+        std::vector<Block> Blocks{};
+        //已建块的目录下标（与Blocks一一对应）
+        std::vector<size_t> Touched{};
+    };
+
+    //块坐标打包为键（Z、Y、X优先级）
+    static uint64_t BlockKey(size_t BX, size_t BY, size_t BZ);
+    //按单元所跨越的区间[Span(i)[0], Span(i)[1])把单元分入各桶：
+    //并行计数排序，桶b的单元为Items[Starts[b], Starts[b + 1])
+    template<class SPAN>
+    static void Bucket(size_t Num, size_t BucketNum, SPAN Span,
+        std::vector<size_t>& Starts, std::vector<size_t>& Items);
+    //表面体素化，结果块追加到Output
+    void VoxelizeSurface(const std::vector<Triangle3D>& Triangles,
+        std::vector<KeyedBlock>& Output) const;
+    //按奇偶规则填充内部，结果块追加到Output
+    void FillSolid(const std::vector<Triangle3D>& Triangles,
+        std::vector<KeyedBlock>& Output) const;
+    //块按键排序、同键合并后存储，并统计体素数
+    void Store(std::vector<KeyedBlock>& Blocks);
+
+    //网格最小角点
+    Coord3D m_Origin{{0.0, 0.0, 0.0}};
+    //体素边长
+    double m_rVoxelSize{0.0};
+    //各轴体素数
+    std::array<size_t, 3> m_Resolution{{0, 0, 0}};
+    //各块的键（升序）
+    std::vector<uint64_t> m_BlockKeys{};
+    //各块（与键一一对应）
+    std::vector<Block> m_Blocks{};
+    //被占据的体素数
+    size_t m_ullVoxelNum{0};
+};
+
+#endif //VOXELGRID3D_HPP